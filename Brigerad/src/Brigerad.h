@@ -20,6 +20,7 @@
 
 #include "Brigerad/Renderer/Renderer.h"
 #include "Brigerad/Renderer/Renderer2D.h"
+#include "Brigerad/Renderer/StaticBatch.h"
 #include "Brigerad/Renderer/RenderCommand.h"
 
 #include "Brigerad/Renderer/Shader.h"
@@ -13,9 +13,13 @@
 
 #include "Input.h"
 #include "Brigerad/Core/Time.h"
+#include "Brigerad/Debug/FrameStats.h"
 #include "KeyCodes.h"
 
+#include "Brigerad/Renderer/RenderThread.h"
 #include "Brigerad/Script/ScriptEngine.h"
+#include "Brigerad/Utils/SerialPortRegistry.h"
+#include "Brigerad/Utils/ThreadPool.h"
 
 namespace Brigerad
 {
@@ -31,25 +35,36 @@ Application* Application::s_instance = nullptr;
  * @brief   Construct a new Application:: Application object
  *          This creates a new window and binds the event function to it.
  */
-Application::Application(const std::string& name)
+Application::Application(const std::string& name, bool useRenderThread)
 {
     BR_PROFILE_FUNCTION();
 
     // Don't allow multiple instances of Application.
     BR_CORE_ASSERT(!s_instance, "Application already exists!");
-    s_instance = this;
+    s_instance     = this;
+    m_mainThreadId = std::this_thread::get_id();
 
     // Create the window for the application.
     m_window = Scope<Window>(Window::Create(WindowProps(name)));
     // Bind the Application's events to the window's.
-    m_window->SetEventCallback(BIND_EVENT_FN(OnEvent));
+    m_window->SetEventCallback(BIND_EVENT_FN(OnWindowEvent));
+
+    // Everything that touches the graphics context from here on goes through the render thread.
+    if (useRenderThread)
+    {
+        RenderThread::Init(m_window->GetContext());
+    }
 
     // Initialize the rendering pipeline.
     Renderer::Init();
+    FrameStats::Init();
 
     // Initialize the Lua scripting engine.
     ScriptEngine::Init();
 
+    // Start watching for serial ports being plugged in and out.
+    SerialPortRegistry::Init();
+
     // Initialize all ImGui related things.
     m_imguiLayer = new ImGuiLayer();
 
@@ -63,8 +78,18 @@ Application::Application(const std::string& name)
  */
 Application::~Application()
 {
+    // The layers and the window are destroyed after this, on the main thread.
+    Renderer::Shutdown();
+    FrameStats::Shutdown();
+    RenderThread::Shutdown();
+
+    SerialPortRegistry::Shutdown();
+
     // Gracefully shut down the scripting engine.
     ScriptEngine::Shutdown();
+
+    // Nothing runs the systems of the scenes anymore, the layers only remain to be destroyed.
+    ThreadPool::ShutdownShared();
 }
 
 /**
@@ -77,15 +102,53 @@ void Application::Run()
 {
     BR_PROFILE_FUNCTION();
 
+    m_lastFrameTimeNs = GetTimeNs();
+
     // For as long as the application should be running:
     while (m_running)
     {
         BR_PROFILE_SCOPE("RunLoop");
 
+        // A recording has a frame for every frame to draw.
+        if (m_onDemandRendering && m_player == nullptr)
+        {
+            WaitForRedraw();
+        }
+        RenderThread::BeginFrame();
+
         // Get the time elapsed since the last frame.
-        float    time     = float(GetTime());
-        Timestep timestep = time - m_lastFrameTime;
-        m_lastFrameTime   = time;
+        // The clock is kept in integer nanoseconds, a float of the uptime loses precision in hours.
+        int64_t time        = GetTimeNs();
+        int64_t frameTimeNs = time - m_lastFrameTimeNs;
+        m_lastFrameTimeNs   = time;
+
+        // Read the inputs once, every query made during the frame is answered from that.
+        if (m_player != nullptr && !m_player->NextFrame(frameTimeNs))
+        {
+            StopPlayback();
+        }
+        if (m_player != nullptr)
+        {
+            Input::NewFrame(m_player->GetSnapshot());
+        }
+        else
+        {
+            Input::NewFrame();
+        }
+        if (m_recorder != nullptr)
+        {
+            m_recorder->RecordFrame(frameTimeNs, Input::GetSnapshot());
+        }
+        Timestep timestep = float(frameTimeNs * 1e-9);
+
+        // After the wait for the pace of a recording.
+        FrameStats::BeginFrame();
+
+        // Step the simulation, even when minimized.
+        {
+            FrameStats::ScopedPhase phase(FrameStats::Phase::FixedUpdate);
+            RunFixedUpdates(frameTimeNs);
+        }
 
         // If the window is not minimized:
         // (If the window is minimized, we don't want to waste time rendering stuff!)
@@ -94,6 +157,7 @@ void Application::Run()
             {
                 // Update all Application Layers.
                 BR_PROFILE_SCOPE("Layer Stack OnUpdate");
+                FrameStats::ScopedPhase phase(FrameStats::Phase::Update);
                 for (Layer* layer : m_layerStack)
                 {
                     layer->OnUpdate(timestep);
@@ -101,6 +165,7 @@ void Application::Run()
             }
 
             // Render all ImGui Layers.
+            FrameStats::ScopedPhase phase(FrameStats::Phase::ImGui);
             m_imguiLayer->Begin();
             {
                 BR_PROFILE_SCOPE("LayerStack OnImGuiRender");
@@ -111,19 +176,191 @@ void Application::Run()
             }
             m_imguiLayer->End();
         }
+        FrameStats::EndRendering();
+
+        // Collect the garbage of the scripts a bit every frame instead of all at once.
+        ScriptEngine::StepGarbageCollector(m_scriptGcBudgetMs);
+
+        {
+            FrameStats::ScopedPhase phase(FrameStats::Phase::Present);
+
+            // Do the per-frame window updating tasks.
+            m_window->OnUpdate();
+            if (m_player != nullptr)
+            {
+                // In place of the events of the window, ignored while playing back.
+                m_player->DispatchEvents(BIND_EVENT_FN(OnEvent));
+            }
+
+            // Hand the frame to the render thread and start recording the next one.
+            RenderThread::EndFrame();
+        }
 
-        // Do the per-frame window updating tasks.
-        m_window->OnUpdate();
+        // Dispatch the events that were raised by other threads during the frame.
+        DispatchQueuedEvents();
 
         // Execute the post-frame task queue.
+        // Their effects, like a new layer, are only visible in the next frame.
+        if (!m_postFrameTasks.empty())
+        {
+            RequestRedraw();
+        }
         for (const auto& task : m_postFrameTasks)
         {
             task();
         }
         m_postFrameTasks.clear();
+
+        FrameStats::EndFrame();
+    }
+}
+
+/**
+ * @brief   Set the rate of the fixed update steps.
+ *
+ * @param   hz       Steps per second.
+ * @param   maxSteps Maximum number of steps in a single frame.
+ */
+void Application::SetFixedUpdateRate(double hz, uint32_t maxSteps)
+{
+    BR_CORE_ASSERT(hz > 0.0 && maxSteps > 0, "Invalid fixed update rate!");
+
+    m_fixedStepNs   = int64_t(1e9 / hz);
+    m_maxFixedSteps = maxSteps;
+    m_accumulatorNs = 0;
+}
+
+/**
+ * @brief   Enable or disable on-demand rendering.
+ *
+ * @param   enabled     True to only draw frames when needed.
+ * @param   maxIdleTime Longest time to go without drawing a frame, in seconds.
+ */
+void Application::SetOnDemandRendering(bool enabled, double maxIdleTime)
+{
+    m_onDemandRendering = enabled;
+    m_maxIdleTime       = maxIdleTime;
+}
+
+/**
+ * @brief   Ask for more frames to be drawn in on-demand mode.
+ *
+ * @param   frames The minimum number of frames to draw.
+ */
+void Application::RequestRedraw(uint32_t frames)
+{
+    uint32_t current = m_redrawFrames.load();
+    while (current < frames && !m_redrawFrames.compare_exchange_weak(current, frames))
+    {
+    }
+
+    if (m_onDemandRendering && std::this_thread::get_id() != m_mainThreadId)
+    {
+        m_window->Wake();
+    }
+}
+
+/**
+ * @brief   Start recording the inputs of every frame.
+ *
+ * @param   path The file to write the recording to.
+ * @retval  True if the recording started.
+ */
+bool Application::StartRecording(const std::string& path)
+{
+    if (m_player != nullptr)
+    {
+        BR_CORE_ERROR("Can't record the inputs while playing a recording back!");
+        return false;
+    }
+
+    m_recorder = InputRecorder::Create(path, m_window->GetWidth(), m_window->GetHeight());
+    return m_recorder != nullptr;
+}
+
+void Application::StopRecording()
+{
+    m_recorder.reset();
+}
+
+/**
+ * @brief   Start playing a recording back, from the next frame.
+ *
+ * @param   path          The file of the recording.
+ * @param   pace          Keep the pace of the recording or play the frames as fast as possible.
+ * @param   closeWhenDone Close the application at the end of the recording.
+ * @retval  True if the playback started.
+ */
+bool Application::StartPlayback(const std::string& path, PlaybackPace pace, bool closeWhenDone)
+{
+    StopRecording();
+    StopPlayback();
+
+    m_player = InputPlayer::Create(path, pace);
+    if (m_player == nullptr)
+    {
+        return false;
+    }
+    m_closeAfterPlayback = closeWhenDone;
+
+    // Otherwise the frames can't go faster than the display.
+    m_vsyncBeforePlayback = m_window->IsVSync();
+    if (pace == PlaybackPace::AsFastAsPossible)
+    {
+        m_window->SetVSync(false);
+    }
+
+    // Start from the size the window had when the recording started.
+    WindowResizeEvent resize(m_player->GetWidth(), m_player->GetHeight());
+    OnEvent(resize);
+
+    BR_CORE_INFO("Playing back the inputs of '{}'.", path);
+    return true;
+}
+
+void Application::StopPlayback()
+{
+    if (m_player == nullptr)
+    {
+        return;
+    }
+
+    auto stats = m_player->GetStats();
+    BR_CORE_INFO("Played back {} frames: p50 {:.2f}ms, p95 {:.2f}ms, p99 {:.2f}ms, max {:.2f}ms",
+                 stats.frames,
+                 stats.p50Ms,
+                 stats.p95Ms,
+                 stats.p99Ms,
+                 stats.maxMs);
+
+    m_window->SetVSync(m_vsyncBeforePlayback);
+    m_player.reset();
+    if (m_closeAfterPlayback)
+    {
+        Close();
     }
 }
 
+/**
+ * @brief   Callback of the window, records its events or drops them while playing back.
+ *
+ * @param   e The event raised by the window.
+ */
+void Application::OnWindowEvent(Event& e)
+{
+    if (m_recorder != nullptr)
+    {
+        m_recorder->RecordEvent(e);
+    }
+    else if (m_player != nullptr && InputRecorder::IsRecorded(e) &&
+             e.GetEventType() != EventType::WindowClose)
+    {
+        return;
+    }
+
+    OnEvent(e);
+}
+
 /**
  * @brief   Callback function for all events happening in the application.
  *          It dispatches and propagates the event through all layers until it is handled.
@@ -134,6 +371,10 @@ void Application::OnEvent(Event& e)
 {
     BR_PROFILE_FUNCTION();
 
+    // ImGui takes a frame or two to react to an input, e.g. a hovered button lights up in the
+    // frame after the mouse moved.
+    RequestRedraw(3);
+
     // Creates a dispatch context with the event.
     EventDispatcher dispatcher(e);
     // Dispatch it to the proper handling function in the Application, if the type matches.
@@ -157,6 +398,107 @@ void Application::OnEvent(Event& e)
 
 
 
+/**
+ * @brief   Queue an event raised outside of the main thread.
+ *          It will be passed to OnEvent at the end of the current frame.
+ *
+ * @param   e The event to be dispatched.
+ */
+void Application::QueueEvent(Scope<Event> e)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_eventQueueMutex);
+        m_eventQueue.push_back(std::move(e));
+    }
+
+    // Don't let the event wait for the next input in on-demand mode.
+    if (m_onDemandRendering)
+    {
+        m_window->Wake();
+    }
+}
+
+/**
+ * @brief   Run as many fixed update steps as fit in the time accumulated so far.
+ *
+ * @param   frameTimeNs The time elapsed since the last frame.
+ */
+void Application::RunFixedUpdates(int64_t frameTimeNs)
+{
+    BR_PROFILE_FUNCTION();
+
+    m_accumulatorNs += frameTimeNs;
+
+    Timestep step  = GetFixedTimestep();
+    uint32_t steps = 0;
+    while (m_accumulatorNs >= m_fixedStepNs && steps < m_maxFixedSteps)
+    {
+        for (Layer* layer : m_layerStack)
+        {
+            layer->OnFixedUpdate(step);
+        }
+        m_accumulatorNs -= m_fixedStepNs;
+        steps++;
+    }
+
+    // Too far behind, e.g. after a breakpoint or a stall: drop the time that can't be caught up
+    // rather than running even more steps next frame.
+    if (m_accumulatorNs >= m_fixedStepNs)
+    {
+        m_accumulatorNs %= m_fixedStepNs;
+    }
+
+    m_interpolationAlpha = float(m_accumulatorNs) / float(m_fixedStepNs);
+}
+
+/**
+ * @brief   In on-demand mode, sleep until a frame is needed.
+ */
+void Application::WaitForRedraw()
+{
+    BR_PROFILE_FUNCTION();
+
+    uint32_t frames = m_redrawFrames.load();
+    while (frames != 0 && !m_redrawFrames.compare_exchange_weak(frames, frames - 1))
+    {
+    }
+    if (frames != 0)
+    {
+        return;
+    }
+
+    // The callbacks of the events received while waiting go through OnEvent, which asks for
+    // frames. The events of ImGui's own platform windows don't, so draw frames whenever the wait
+    // ends early.
+    int64_t start = GetTimeNs();
+    m_window->WaitEvents(m_maxIdleTime);
+    int64_t end = GetTimeNs();
+    if (end - start < int64_t(m_maxIdleTime * 1e9))
+    {
+        RequestRedraw(2);
+    }
+
+    // Nothing was simulated while sleeping, don't make the next frame catch up on it.
+    m_lastFrameTimeNs = end;
+}
+
+void Application::DispatchQueuedEvents()
+{
+    BR_PROFILE_FUNCTION();
+
+    // Take the whole queue at once, so that the lock isn't held while the layers handle them.
+    std::vector<Scope<Event>> events;
+    {
+        std::lock_guard<std::mutex> lock(m_eventQueueMutex);
+        events.swap(m_eventQueue);
+    }
+
+    for (auto& e : events)
+    {
+        OnEvent(*e);
+    }
+}
+
 /**
  * @brief   Push a new layer at the back of the layer stack.
  *
@@ -4,6 +4,7 @@
 #include "Brigerad/Core/LayerStack.h"
 #include "Brigerad/Events/ApplicationEvent.h"
 
+#include "Brigerad/Core/InputRecording.h"
 #include "Brigerad/Core/Window.h"
 
 #include "Brigerad/ImGui/ImGuiLayer.h"
@@ -16,12 +17,21 @@
 #include "Brigerad/Renderer/Renderer.h"
 #include "Brigerad/Renderer/OrthographicCamera.h"
 
+#include <atomic>
+#include <mutex>
+#include <thread>
+
 namespace Brigerad
 {
 class BRIGERAD_API Application
 {
 public:
-    Application(const std::string& name = "Brigerad Engine");
+    /**
+     * With useRenderThread, the graphics context is moved to a render thread that executes the
+     * commands of a frame while the main thread records the next one. ImGui's platform windows
+     * are then disabled.
+     */
+    Application(const std::string& name = "Brigerad Engine", bool useRenderThread = false);
     virtual ~Application();
 
     void Run();
@@ -39,6 +49,40 @@ public:
 
     inline ImGuiLayer* GetImGuiLayer() { return m_imguiLayer; }
 
+    /**
+     * Set the rate at which Layer::OnFixedUpdate is called, in Hz.
+     * maxSteps caps the steps run in a single frame: when a frame takes longer than that, the
+     * simulation slows down instead of trying to catch up forever.
+     */
+    void SetFixedUpdateRate(double hz, uint32_t maxSteps = 8);
+
+    /** Duration of a fixed update step. */
+    inline Timestep GetFixedTimestep() const { return Timestep(float(m_fixedStepNs * 1e-9)); }
+
+    /**
+     * How far between the last fixed update step and the next one the current frame is, from 0 to
+     * 1. Rendering blends the previous and current simulation states with it to stay smooth when
+     * the frame rate doesn't match the fixed update rate.
+     */
+    inline float GetInterpolationAlpha() const { return m_interpolationAlpha; }
+
+    /**
+     * In on-demand mode, a frame is only drawn when something asked for one: an input, a queued
+     * event, a call to RequestRedraw. Otherwise the main thread sleeps until the next event, or
+     * at most maxIdleTime seconds. The fixed updates don't run while sleeping.
+     */
+    void SetOnDemandRendering(bool enabled, double maxIdleTime = 0.5);
+    inline bool IsOnDemandRendering() const { return m_onDemandRendering; }
+
+    /**
+     * Ask for at least frames more frames to be drawn, e.g. while something animates.
+     * Can be called from any thread.
+     */
+    void RequestRedraw(uint32_t frames = 1);
+
+    /** Time given to the Lua garbage collector in each frame, in milliseconds. */
+    inline void SetScriptGcBudget(double ms) { m_scriptGcBudgetMs = ms; }
+
     inline void QueuePostFrameTask(const std::function<void()>& fn)
     {
         if (fn)
@@ -47,9 +91,39 @@ public:
         }
     }
 
+    /**
+     * Queue an event to be dispatched by the main thread after the current frame.
+     * Unlike OnEvent, this can be called from any thread.
+     */
+    void QueueEvent(Scope<Event> e);
+
+    /**
+     * Record the timestep, the inputs and the window events of every frame to a file, until
+     * StopRecording. Played back, the session goes through the same frames.
+     */
+    bool        StartRecording(const std::string& path);
+    void        StopRecording();
+    inline bool IsRecording() const { return m_recorder != nullptr; }
+
+    /**
+     * Replace the inputs and the timesteps with a recording. The live inputs are ignored until the
+     * end of the recording or StopPlayback, closing the window still works. The frame times of the
+     * playback are logged at the end, with closeWhenDone the application then closes.
+     */
+    bool        StartPlayback(const std::string& path,
+                              PlaybackPace       pace          = PlaybackPace::Original,
+                              bool               closeWhenDone = false);
+    void        StopPlayback();
+    inline bool IsPlayingBack() const { return m_player != nullptr; }
+
     inline static Application& Get() { return *s_instance; }
 
 private:
+    void DispatchQueuedEvents();
+    void RunFixedUpdates(int64_t frameTimeNs);
+    void WaitForRedraw();
+    void OnWindowEvent(Event& e);
+
     bool OnWindowClose(WindowCloseEvent& e);
     bool OnWindowResize(WindowResizeEvent& e);
     bool OnKeyPressed(KeyPressedEvent& e);
@@ -62,10 +136,29 @@ private:
     bool       m_minimized = false;
     LayerStack m_layerStack;
 
-    float m_lastFrameTime = 0.0f;
+    int64_t  m_lastFrameTimeNs    = 0;
+    int64_t  m_fixedStepNs        = 1000000000 / 120;
+    int64_t  m_accumulatorNs      = 0;
+    uint32_t m_maxFixedSteps      = 8;
+    float    m_interpolationAlpha = 0.0f;
+
+    bool                  m_onDemandRendering = false;
+    double                m_maxIdleTime       = 0.5;
+    std::atomic<uint32_t> m_redrawFrames      = 0;
+    std::thread::id       m_mainThreadId;
+
+    double m_scriptGcBudgetMs = 1.0;
 
     std::vector<std::function<void()>> m_postFrameTasks;
 
+    std::mutex                m_eventQueueMutex;
+    std::vector<Scope<Event>> m_eventQueue;
+
+    Scope<InputRecorder> m_recorder;
+    Scope<InputPlayer>   m_player;
+    bool                 m_closeAfterPlayback  = false;
+    bool                 m_vsyncBeforePlayback = true;
+
 private:
     static Application* s_instance;
 };
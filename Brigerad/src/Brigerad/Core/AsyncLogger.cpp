@@ -0,0 +1,269 @@
+/**
+ * @file   AsyncLogger.cpp
+ * @author Samuel Martel
+ * @date   2026/10/19
+ *
+ * @brief  Source for the AsyncLogger module.
+ */
+#include "brpch.h"
+#include "AsyncLogger.h"
+
+#include <algorithm>
+
+namespace Brigerad
+{
+static size_t RoundUpToPowerOfTwo(size_t size)
+{
+    size_t rounded = 2;
+    while (rounded < size)
+    {
+        rounded *= 2;
+    }
+    return rounded;
+}
+
+LogQueue::LogQueue(size_t size) : m_slots(RoundUpToPowerOfTwo(size))
+{
+    m_mask = m_slots.size() - 1;
+    for (size_t i = 0; i < m_slots.size(); i++)
+    {
+        m_slots[i].sequence.store(i, std::memory_order_relaxed);
+        // Most messages fit, the first round of pushes doesn't have to allocate.
+        m_slots[i].text.reserve(128);
+    }
+
+    m_thread = std::thread(&LogQueue::Run, this);
+}
+
+LogQueue::~LogQueue()
+{
+    Stop();
+}
+
+void LogQueue::Stop()
+{
+    if (!m_thread.joinable())
+    {
+        return;
+    }
+
+    // Sequentially consistent, like in Push: either a thread pushing sees the flag, or this sees
+    // it pushing and waits for the message to be in the queue.
+    m_isRunning.store(false);
+    while (m_pushing.load() != 0)
+    {
+        std::this_thread::yield();
+    }
+    m_wakeUp.notify_one();
+    m_thread.join();
+
+    // Whatever was pushed while the thread was stopping.
+    while (WriteNext())
+    {
+    }
+    for (AsyncLogger* logger : m_toFlush)
+    {
+        logger->spdlog::logger::flush();
+    }
+    m_toFlush.clear();
+}
+
+bool LogQueue::Push(AsyncLogger&                    logger,
+                    const spdlog::details::log_msg& msg,
+                    bool                            canDrop,
+                    uint64_t&                       ticket)
+{
+    m_pushing.fetch_add(1);
+    if (!m_isRunning.load())
+    {
+        m_pushing.fetch_sub(1);
+        return false;
+    }
+
+    ticket = PushSlot(logger, msg, canDrop);
+    m_pushing.fetch_sub(1, std::memory_order_release);
+    return true;
+}
+
+uint64_t LogQueue::PushSlot(AsyncLogger& logger, const spdlog::details::log_msg& msg, bool canDrop)
+{
+    // Claim the position of the next message, the slot is free once the previous round popped it.
+    uint64_t position = m_pushed.load(std::memory_order_relaxed);
+    Slot*    slot     = nullptr;
+    while (true)
+    {
+        slot                = &m_slots[position & m_mask];
+        uint64_t sequence   = slot->sequence.load(std::memory_order_acquire);
+        int64_t  difference = int64_t(sequence - position);
+        if (difference == 0)
+        {
+            if (m_pushed.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (difference < 0)
+        {
+            // Full.
+            if (canDrop)
+            {
+                m_dropped.fetch_add(1, std::memory_order_relaxed);
+                return 0;
+            }
+            std::this_thread::yield();
+            position = m_pushed.load(std::memory_order_relaxed);
+        }
+        else
+        {
+            // Another thread claimed it first.
+            position = m_pushed.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->logger   = &logger;
+    slot->level    = msg.level;
+    slot->time     = msg.time;
+    slot->threadId = msg.thread_id;
+    slot->text.assign(msg.raw.data(), msg.raw.size());
+    slot->sequence.store(position + 1, std::memory_order_release);
+
+    if (m_isIdle.load())
+    {
+        m_wakeUp.notify_one();
+    }
+
+    return position + 1;
+}
+
+void LogQueue::WaitFor(uint64_t ticket) const
+{
+    while (GetWrittenCount() < ticket)
+    {
+        std::this_thread::yield();
+    }
+}
+
+void LogQueue::WaitForAll() const
+{
+    WaitFor(m_pushed.load(std::memory_order_relaxed));
+}
+
+void LogQueue::Run()
+{
+    while (true)
+    {
+        if (WriteNext())
+        {
+            continue;
+        }
+
+        // Nothing left, get what was written out of the buffers of the sinks while there is time.
+        for (AsyncLogger* logger : m_toFlush)
+        {
+            logger->spdlog::logger::flush();
+        }
+        m_toFlush.clear();
+
+        if (!IsRunning())
+        {
+            break;
+        }
+
+        // The timeout covers a push that doesn't see the flag in time to wake the thread up.
+        std::unique_lock<std::mutex> lock(m_idleMutex);
+        m_isIdle.store(true);
+        m_wakeUp.wait_for(lock, std::chrono::milliseconds(10));
+        m_isIdle.store(false);
+    }
+}
+
+bool LogQueue::WriteNext()
+{
+    uint64_t position = m_written.load(std::memory_order_relaxed);
+    Slot&    slot     = m_slots[position & m_mask];
+    if (slot.sequence.load(std::memory_order_acquire) != position + 1)
+    {
+        return false;
+    }
+
+    uint64_t dropped = m_dropped.load(std::memory_order_relaxed);
+    if (dropped != m_reportedDropped)
+    {
+        spdlog::details::log_msg report;
+        report.logger_name = &slot.logger->name();
+        report.level       = spdlog::level::warn;
+        report.time        = slot.time;
+        report.thread_id   = slot.threadId;
+        report.raw << (dropped - m_reportedDropped) << " log messages dropped, the queue was full.";
+        slot.logger->Write(report);
+        m_reportedDropped = dropped;
+    }
+
+    spdlog::details::log_msg msg;
+    msg.logger_name = &slot.logger->name();
+    msg.level       = slot.level;
+    msg.time        = slot.time;
+    msg.thread_id   = slot.threadId;
+    msg.raw << fmt::StringRef(slot.text.data(), slot.text.size());
+    slot.logger->Write(msg);
+
+    if (std::find(m_toFlush.begin(), m_toFlush.end(), slot.logger) == m_toFlush.end())
+    {
+        m_toFlush.push_back(slot.logger);
+    }
+
+    // Free the slot for the next round.
+    slot.sequence.store(position + m_slots.size(), std::memory_order_release);
+    m_written.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+AsyncLogger::AsyncLogger(const std::string&            name,
+                         std::vector<spdlog::sink_ptr> sinks,
+                         LogQueue&                     queue)
+: spdlog::logger(name, sinks.begin(), sinks.end()), m_queue(queue)
+{
+}
+
+void AsyncLogger::flush()
+{
+    // From the thread of the queue, when a message to flush on is written.
+    if (m_queue.IsRunning() && !m_queue.IsQueueThread())
+    {
+        m_queue.WaitForAll();
+    }
+    spdlog::logger::flush();
+}
+
+void AsyncLogger::_sink_it(spdlog::details::log_msg& msg)
+{
+    uint64_t ticket = 0;
+    if (!m_queue.Push(*this, msg, msg.level < spdlog::level::warn, ticket))
+    {
+        spdlog::logger::_sink_it(msg);
+        return;
+    }
+
+    if (ticket != 0 && msg.level >= spdlog::level::err)
+    {
+        m_queue.WaitFor(ticket);
+    }
+}
+
+void AsyncLogger::Write(spdlog::details::log_msg& msg)
+{
+    // Same as what spdlog does around the sinks of a synchronous logger.
+    try
+    {
+        spdlog::logger::_sink_it(msg);
+    }
+    catch (const std::exception& ex)
+    {
+        _err_handler(ex.what());
+    }
+    catch (...)
+    {
+        _err_handler("Unknown exception in logger " + _name);
+    }
+}
+}    // namespace Brigerad
@@ -0,0 +1,129 @@
+/**
+ * @file   AsyncLogger.h
+ * @author Samuel Martel
+ * @date   2026/10/19
+ *
+ * @brief  Header for the AsyncLogger module.
+ */
+#pragma once
+
+#include "spdlog/spdlog.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Brigerad
+{
+class AsyncLogger;
+
+/**
+ * Bounded lock-free queue of log messages, written to the sinks by a background thread.
+ *
+ * Any number of threads push, the background thread is the only one to pop. Pushing copies the
+ * message into a slot that keeps its buffer from one message to the next, nothing is allocated
+ * once the slots have grown to the size of the messages.
+ */
+class LogQueue
+{
+public:
+    /** The size is rounded up to a power of two. */
+    explicit LogQueue(size_t size);
+    ~LogQueue();
+
+    /**
+     * Write what is left and stop the thread. The loggers then write on the calling thread.
+     * What other threads push in the meantime is written before it returns.
+     */
+    void Stop();
+
+    LogQueue(const LogQueue&) = delete;
+    LogQueue& operator=(const LogQueue&) = delete;
+
+    /**
+     * False if the queue is stopped, the message is left to the caller. Otherwise the ticket is
+     * that of the message, 0 if the queue was full and the message can be dropped, or it waits
+     * for room. The message is written once GetWrittenCount() reaches the ticket.
+     */
+    bool Push(AsyncLogger&                    logger,
+              const spdlog::details::log_msg& msg,
+              bool                            canDrop,
+              uint64_t&                       ticket);
+    /** Wait until the message of the ticket is written. */
+    void     WaitFor(uint64_t ticket) const;
+    /** Wait until everything pushed so far is written. */
+    void     WaitForAll() const;
+
+    inline bool     IsRunning() const { return m_isRunning.load(std::memory_order_acquire); }
+    inline uint64_t GetWrittenCount() const { return m_written.load(std::memory_order_acquire); }
+    inline uint64_t GetDroppedCount() const { return m_dropped.load(std::memory_order_relaxed); }
+    inline bool IsQueueThread() const { return std::this_thread::get_id() == m_thread.get_id(); }
+
+private:
+    // A cache line each, so that threads pushing at the same time don't share one.
+    struct alignas(64) Slot
+    {
+        // Position in the queue the slot can be pushed to, or popped at once it's one past it.
+        std::atomic<uint64_t>         sequence = 0;
+        AsyncLogger*                  logger   = nullptr;
+        spdlog::level::level_enum     level    = spdlog::level::trace;
+        spdlog::log_clock::time_point time;
+        size_t                        threadId = 0;
+        std::string                   text;
+    };
+
+    /** Push, once the queue is known to be running. */
+    uint64_t PushSlot(AsyncLogger& logger, const spdlog::details::log_msg& msg, bool canDrop);
+    void     Run();
+    bool     WriteNext();
+
+private:
+    std::vector<Slot> m_slots;
+    uint64_t          m_mask = 0;
+
+    // Apart so that the threads pushing and the one writing don't share a cache line.
+    alignas(64) std::atomic<uint64_t> m_pushed = 0;
+    alignas(64) std::atomic<uint64_t> m_written = 0;
+    std::atomic<uint64_t>             m_dropped = 0;
+    uint64_t                          m_reportedDropped = 0;
+    std::vector<AsyncLogger*>         m_toFlush;    // Written to since the queue was last idle.
+
+    std::atomic<bool>       m_isRunning = true;
+    std::atomic<uint32_t>   m_pushing   = 0;    // Threads in Push, Stop waits for them.
+    std::atomic<bool>       m_isIdle    = false;
+    std::mutex              m_idleMutex;
+    std::condition_variable m_wakeUp;
+    std::thread             m_thread;
+};
+
+/**
+ * spdlog logger that hands its messages to a LogQueue instead of writing them.
+ *
+ * The arguments are formatted on the calling thread, the pattern is applied and the sinks are
+ * written on the thread of the queue. Trace to info messages are dropped when the queue is full,
+ * warnings wait for room. Errors and critical messages wait until they are written, so that they
+ * are not lost if an assert follows.
+ */
+class AsyncLogger : public spdlog::logger
+{
+public:
+    AsyncLogger(const std::string& name, std::vector<spdlog::sink_ptr> sinks, LogQueue& queue);
+
+    /** Waits for the messages in the queue, then flushes the sinks. */
+    void flush() override;
+
+protected:
+    void _sink_it(spdlog::details::log_msg& msg) override;
+
+private:
+    friend class LogQueue;
+    /** Called by the queue, applies the pattern and writes to the sinks. */
+    void Write(spdlog::details::log_msg& msg);
+
+private:
+    LogQueue& m_queue;
+};
+}    // namespace Brigerad
@@ -1,26 +1,87 @@
 #pragma once
 
+#include "Brigerad/Debug/CommandLineTools.h"
+#include "Brigerad/Debug/LogBenchmark.h"
+#include "Brigerad/Debug/TransformBenchmark.h"
+
 #include <filesystem>
+#include <string>
 
 #if defined(BR_PLATFORM_WINDOWS) || defined(BR_PLATFORM_LINUX)
 
 extern Brigerad::Application* Brigerad::CreateApplication();
 
+// Registered here rather than next to their code: the engine is a static library, the linker
+// leaves out the files of the engine nothing refers to.
+BR_REGISTER_TOOL("log-benchmark",
+                 "[calls] [threads] Time the log calls.",
+                 [](const std::vector<std::string>& args) {
+                     Brigerad::LogBenchmark::Run(
+                       Brigerad::CommandLineTools::GetArgument(args, 0, 50000),
+                       Brigerad::CommandLineTools::GetArgument(args, 1, 4));
+                     return 0;
+                 });
+BR_REGISTER_TOOL("transform-benchmark",
+                 "[runs] Time TransformSystem against GetTransform.",
+                 [](const std::vector<std::string>& args) {
+                     Brigerad::TransformBenchmark::Run(
+                       Brigerad::CommandLineTools::GetArgument(args, 0, 5));
+                     return 0;
+                 });
+
 int main(int argc, char** argv)
 {
-    BR_PROFILE_BEGIN_SESSION("Init", "BrigeradProfile-Startup.json");
     Brigerad::Log::Init();
 
+    // --<tool> runs one of the CommandLineTools instead of the application, --help lists them.
+    int exitCode = 0;
+    if (Brigerad::CommandLineTools::Run(argc, argv, exitCode))
+    {
+        Brigerad::Log::Shutdown();
+        return exitCode;
+    }
+
+    BR_PROFILE_BEGIN_SESSION("Init", "BrigeradProfile-Startup.json");
+
     BR_CORE_WARN("Running from: {0}", std::filesystem::current_path());
 
     auto app = Brigerad::CreateApplication();
     BR_PROFILE_END_SESSION();
 
+    // --record <file> records the session, --playback <file> [--fast] plays one back and exits.
+    std::string playback;
+    bool        isFast = false;
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (arg == "--record" && i + 1 < argc)
+        {
+            app->StartRecording(argv[++i]);
+        }
+        else if (arg == "--playback" && i + 1 < argc)
+        {
+            playback = argv[++i];
+        }
+        else if (arg == "--fast")
+        {
+            isFast = true;
+        }
+    }
+    if (!playback.empty())
+    {
+        app->StartPlayback(playback,
+                           isFast ? Brigerad::PlaybackPace::AsFastAsPossible
+                                  : Brigerad::PlaybackPace::Original,
+                           true);
+    }
+
     app->Run();
 
     BR_PROFILE_BEGIN_SESSION("Shutdown", "BrigeradProfile-Shutdown.json");
     delete app;
     BR_PROFILE_END_SESSION();
+
+    Brigerad::Log::Shutdown();
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,55 @@
+#pragma once
+
+namespace Brigerad
+{
+typedef enum class GamepadButton : uint16_t
+{
+    // From glfw3.h
+    A = 0,
+    B = 1,
+    X = 2,
+    Y = 3,
+    LeftBumper = 4,
+    RightBumper = 5,
+    Back = 6,
+    Start = 7,
+    Guide = 8,
+    LeftThumb = 9,
+    RightThumb = 10,
+    DPadUp = 11,
+    DPadRight = 12,
+    DPadDown = 13,
+    DPadLeft = 14,
+
+    Last = DPadLeft,
+    Cross = A,
+    Circle = B,
+    Square = X,
+    Triangle = Y
+} Gamepad;
+
+enum class GamepadAxis : uint16_t
+{
+    // From glfw3.h
+    LeftX = 0,
+    LeftY = 1,    // -1 is up.
+    RightX = 2,
+    RightY = 3,
+    LeftTrigger = 4,
+    RightTrigger = 5,
+
+    Last = RightTrigger
+};
+
+inline std::ostream& operator<<(std::ostream& os, GamepadButton button)
+{
+    os << static_cast<int32_t>(button);
+    return os;
+}
+
+inline std::ostream& operator<<(std::ostream& os, GamepadAxis axis)
+{
+    os << static_cast<int32_t>(axis);
+    return os;
+}
+}
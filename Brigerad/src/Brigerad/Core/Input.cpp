@@ -0,0 +1,392 @@
+/**
+ * @file   Input.cpp
+ * @author Samuel Martel
+ * @date   2026/10/19
+ *
+ * @brief  Source for the Input module, the part common to every platform.
+ */
+#include "brpch.h"
+#include "Input.h"
+
+#include "yaml-cpp/yaml.h"
+
+#include <fstream>
+#include <sstream>
+#include <unordered_map>
+
+namespace Brigerad
+{
+using InputMask = std::bitset<InputSnapshot::s_buttonCount>;
+
+struct InputAction
+{
+    std::string            name;
+    std::vector<InputMask> bindings;    // Pressed when one of them is.
+};
+
+struct InputData
+{
+    InputSnapshot current;
+    InputSnapshot previous;
+
+    std::vector<InputAction>                         actions;
+    std::unordered_map<std::string, Input::ActionId> actionIds;
+    std::bitset<Input::s_maxActions>                 actionsHeld;
+    std::bitset<Input::s_maxActions>                 actionsWereHeld;
+};
+
+static InputData s_data;
+
+static bool IsHeld(size_t bit)
+{
+    return s_data.current.buttons[bit];
+}
+
+static bool IsJustPressed(size_t bit)
+{
+    return s_data.current.buttons[bit] && !s_data.previous.buttons[bit];
+}
+
+static bool IsJustReleased(size_t bit)
+{
+    return !s_data.current.buttons[bit] && s_data.previous.buttons[bit];
+}
+
+// Name of an input -> its bit in InputSnapshot::buttons.
+static const std::unordered_map<std::string, size_t>& GetInputNames()
+{
+    static const std::unordered_map<std::string, size_t> names = [] {
+        std::unordered_map<std::string, size_t> names;
+#define BR_KEY_NAME(name) {#name, KeyCode::name}
+        static const std::pair<const char*, KeyCode> keys[] = {
+          BR_KEY_NAME(Space), BR_KEY_NAME(Apostrophe), BR_KEY_NAME(Comma), BR_KEY_NAME(Minus),
+          BR_KEY_NAME(Period), BR_KEY_NAME(Slash), BR_KEY_NAME(Semicolon), BR_KEY_NAME(Equal),
+          BR_KEY_NAME(D0), BR_KEY_NAME(D1), BR_KEY_NAME(D2), BR_KEY_NAME(D3), BR_KEY_NAME(D4),
+          BR_KEY_NAME(D5), BR_KEY_NAME(D6), BR_KEY_NAME(D7), BR_KEY_NAME(D8), BR_KEY_NAME(D9),
+          BR_KEY_NAME(A), BR_KEY_NAME(B), BR_KEY_NAME(C), BR_KEY_NAME(D), BR_KEY_NAME(E),
+          BR_KEY_NAME(F), BR_KEY_NAME(G), BR_KEY_NAME(H), BR_KEY_NAME(I), BR_KEY_NAME(J),
+          BR_KEY_NAME(K), BR_KEY_NAME(L), BR_KEY_NAME(M), BR_KEY_NAME(N), BR_KEY_NAME(O),
+          BR_KEY_NAME(P), BR_KEY_NAME(Q), BR_KEY_NAME(R), BR_KEY_NAME(S), BR_KEY_NAME(T),
+          BR_KEY_NAME(U), BR_KEY_NAME(V), BR_KEY_NAME(W), BR_KEY_NAME(X), BR_KEY_NAME(Y),
+          BR_KEY_NAME(Z), BR_KEY_NAME(LeftBracket), BR_KEY_NAME(Backslash),
+          BR_KEY_NAME(RightBracket), BR_KEY_NAME(GraveAccent), BR_KEY_NAME(World1),
+          BR_KEY_NAME(World2), BR_KEY_NAME(Escape), BR_KEY_NAME(Enter), BR_KEY_NAME(Tab),
+          BR_KEY_NAME(Backspace), BR_KEY_NAME(Insert), BR_KEY_NAME(Delete), BR_KEY_NAME(Right),
+          BR_KEY_NAME(Left), BR_KEY_NAME(Down), BR_KEY_NAME(Up), BR_KEY_NAME(PageUp),
+          BR_KEY_NAME(PageDown), BR_KEY_NAME(Home), BR_KEY_NAME(End), BR_KEY_NAME(CapsLock),
+          BR_KEY_NAME(ScrollLock), BR_KEY_NAME(NumLock), BR_KEY_NAME(PrintScreen),
+          BR_KEY_NAME(Pause), BR_KEY_NAME(F1), BR_KEY_NAME(F2), BR_KEY_NAME(F3), BR_KEY_NAME(F4),
+          BR_KEY_NAME(F5), BR_KEY_NAME(F6), BR_KEY_NAME(F7), BR_KEY_NAME(F8), BR_KEY_NAME(F9),
+          BR_KEY_NAME(F10), BR_KEY_NAME(F11), BR_KEY_NAME(F12), BR_KEY_NAME(F13), BR_KEY_NAME(F14),
+          BR_KEY_NAME(F15), BR_KEY_NAME(F16), BR_KEY_NAME(F17), BR_KEY_NAME(F18), BR_KEY_NAME(F19),
+          BR_KEY_NAME(F20), BR_KEY_NAME(F21), BR_KEY_NAME(F22), BR_KEY_NAME(F23), BR_KEY_NAME(F24),
+          BR_KEY_NAME(F25), BR_KEY_NAME(KP0), BR_KEY_NAME(KP1), BR_KEY_NAME(KP2), BR_KEY_NAME(KP3),
+          BR_KEY_NAME(KP4), BR_KEY_NAME(KP5), BR_KEY_NAME(KP6), BR_KEY_NAME(KP7), BR_KEY_NAME(KP8),
+          BR_KEY_NAME(KP9), BR_KEY_NAME(KPDecimal), BR_KEY_NAME(KPDivide), BR_KEY_NAME(KPMultiply),
+          BR_KEY_NAME(KPSubtract), BR_KEY_NAME(KPAdd), BR_KEY_NAME(KPEnter), BR_KEY_NAME(KPEqual),
+          BR_KEY_NAME(LeftShift), BR_KEY_NAME(LeftControl), BR_KEY_NAME(LeftAlt),
+          BR_KEY_NAME(LeftSuper), BR_KEY_NAME(RightShift), BR_KEY_NAME(RightControl),
+          BR_KEY_NAME(RightAlt), BR_KEY_NAME(RightSuper), BR_KEY_NAME(Menu)};
+#undef BR_KEY_NAME
+        for (const auto& [name, key] : keys)
+        {
+            names[name] = size_t(key);
+        }
+
+        static const char* mouseButtons[] = {"Left", "Right", "Middle"};
+        for (size_t i = 0; i < InputSnapshot::s_mouseButtonCount; i++)
+        {
+            names["Mouse.Button" + std::to_string(i)] = InputSnapshot::s_firstMouseButton + i;
+        }
+        for (size_t i = 0; i < std::size(mouseButtons); i++)
+        {
+            names[std::string("Mouse.") + mouseButtons[i]] = InputSnapshot::s_firstMouseButton + i;
+        }
+
+        static const char* gamepadButtons[] = {"A",
+                                               "B",
+                                               "X",
+                                               "Y",
+                                               "LeftBumper",
+                                               "RightBumper",
+                                               "Back",
+                                               "Start",
+                                               "Guide",
+                                               "LeftThumb",
+                                               "RightThumb",
+                                               "DPadUp",
+                                               "DPadRight",
+                                               "DPadDown",
+                                               "DPadLeft"};
+        static_assert(std::size(gamepadButtons) == InputSnapshot::s_gamepadButtonCount,
+                      "Missing names of gamepad buttons!");
+        for (size_t i = 0; i < InputSnapshot::s_gamepadButtonCount; i++)
+        {
+            names[std::string("Gamepad.") + gamepadButtons[i]] =
+              InputSnapshot::s_firstGamepadButton + i;
+        }
+
+        static const char* gamepadAxes[] = {
+          "LeftX", "LeftY", "RightX", "RightY", "LeftTrigger", "RightTrigger"};
+        static_assert(std::size(gamepadAxes) == InputSnapshot::s_gamepadAxisCount,
+                      "Missing names of gamepad axes!");
+        for (size_t i = 0; i < InputSnapshot::s_gamepadAxisCount; i++)
+        {
+            std::string name = std::string("Gamepad.") + gamepadAxes[i];
+            names[name + "+"] = InputSnapshot::s_firstGamepadAxis + 2 * i;
+            names[name + "-"] = InputSnapshot::s_firstGamepadAxis + 2 * i + 1;
+        }
+        return names;
+    }();
+    return names;
+}
+
+void Input::NewFrame()
+{
+    BR_PROFILE_FUNCTION();
+
+    InputSnapshot snapshot;
+    Poll(snapshot);
+    NewFrame(snapshot);
+}
+
+void Input::NewFrame(const InputSnapshot& from)
+{
+    s_data.previous = s_data.current;
+    s_data.current  = from;
+
+    InputSnapshot& snapshot = s_data.current;
+    for (size_t i = 0; i < InputSnapshot::s_gamepadAxisCount; i++)
+    {
+        size_t bit                = InputSnapshot::s_firstGamepadAxis + 2 * i;
+        snapshot.buttons[bit]     = snapshot.gamepadAxes[i] >= InputSnapshot::s_axisThreshold;
+        snapshot.buttons[bit + 1] = snapshot.gamepadAxes[i] <= -InputSnapshot::s_axisThreshold;
+    }
+
+    s_data.actionsWereHeld = s_data.actionsHeld;
+    s_data.actionsHeld.reset();
+    for (size_t i = 0; i < s_data.actions.size(); i++)
+    {
+        for (const InputMask& binding : s_data.actions[i].bindings)
+        {
+            if ((snapshot.buttons & binding) == binding)
+            {
+                s_data.actionsHeld[i] = true;
+                break;
+            }
+        }
+    }
+}
+
+const InputSnapshot& Input::GetSnapshot()
+{
+    return s_data.current;
+}
+
+bool Input::IsKeyPressed(KeyCode keycode)
+{
+    return IsHeld(size_t(keycode));
+}
+
+bool Input::IsKeyJustPressed(KeyCode keycode)
+{
+    return IsJustPressed(size_t(keycode));
+}
+
+bool Input::IsKeyJustReleased(KeyCode keycode)
+{
+    return IsJustReleased(size_t(keycode));
+}
+
+bool Input::IsMouseButtonPressed(MouseCode button)
+{
+    return IsHeld(InputSnapshot::s_firstMouseButton + size_t(button));
+}
+
+bool Input::IsMouseButtonJustPressed(MouseCode button)
+{
+    return IsJustPressed(InputSnapshot::s_firstMouseButton + size_t(button));
+}
+
+bool Input::IsMouseButtonJustReleased(MouseCode button)
+{
+    return IsJustReleased(InputSnapshot::s_firstMouseButton + size_t(button));
+}
+
+float Input::GetMouseX()
+{
+    return s_data.current.mouseX;
+}
+
+float Input::GetMouseY()
+{
+    return s_data.current.mouseY;
+}
+
+std::pair<float, float> Input::GetMousePos()
+{
+    return {s_data.current.mouseX, s_data.current.mouseY};
+}
+
+bool Input::IsGamepadConnected()
+{
+    return s_data.current.hasGamepad;
+}
+
+bool Input::IsGamepadButtonPressed(GamepadButton button)
+{
+    return IsHeld(InputSnapshot::s_firstGamepadButton + size_t(button));
+}
+
+bool Input::IsGamepadButtonJustPressed(GamepadButton button)
+{
+    return IsJustPressed(InputSnapshot::s_firstGamepadButton + size_t(button));
+}
+
+bool Input::IsGamepadButtonJustReleased(GamepadButton button)
+{
+    return IsJustReleased(InputSnapshot::s_firstGamepadButton + size_t(button));
+}
+
+float Input::GetGamepadAxis(GamepadAxis axis)
+{
+    return s_data.current.gamepadAxes[size_t(axis)];
+}
+
+bool Input::LoadActions(const std::string& path)
+{
+    BR_PROFILE_FUNCTION();
+
+    std::ifstream stream(path);
+    if (!stream.is_open())
+    {
+        BR_CORE_ERROR("Unable to open input actions '{}'!", path);
+        return false;
+    }
+    std::stringstream ss;
+    ss << stream.rdbuf();
+
+    YAML::Node data;
+    try
+    {
+        data = YAML::Load(ss.str());
+    }
+    catch (const YAML::Exception& e)
+    {
+        BR_CORE_ERROR("Invalid input actions '{}': {}", path, e.what());
+        return false;
+    }
+
+    bool isValid = true;
+    for (const auto& action : data["Actions"])
+    {
+        if (!action["Name"] || !action["Bindings"])
+        {
+            BR_CORE_ERROR("Action in '{}' needs a Name and Bindings!", path);
+            isValid = false;
+            continue;
+        }
+
+        std::string name = action["Name"].as<std::string>();
+        for (const auto& binding : action["Bindings"])
+        {
+            // A single input or a sequence of inputs pressed together.
+            std::vector<std::string> inputs;
+            if (binding.IsSequence())
+            {
+                inputs = binding.as<std::vector<std::string>>();
+            }
+            else
+            {
+                inputs.push_back(binding.as<std::string>());
+            }
+            if (BindAction(name, inputs) == s_invalidAction)
+            {
+                isValid = false;
+            }
+        }
+    }
+
+    return isValid;
+}
+
+Input::ActionId Input::BindAction(const std::string& action, const std::vector<std::string>& inputs)
+{
+    const auto& names = GetInputNames();
+    InputMask   mask;
+    for (const auto& input : inputs)
+    {
+        auto it = names.find(input);
+        if (it == names.end())
+        {
+            BR_CORE_ERROR("Unknown input '{}' for action '{}'!", input, action);
+            return s_invalidAction;
+        }
+        mask[it->second] = true;
+    }
+    if (mask.none())
+    {
+        BR_CORE_ERROR("Binding of action '{}' has no input!", action);
+        return s_invalidAction;
+    }
+
+    ActionId id = GetAction(action);
+    if (id == s_invalidAction)
+    {
+        if (s_data.actions.size() == s_maxActions)
+        {
+            BR_CORE_ERROR("Too many actions, can't add '{}'!", action);
+            return s_invalidAction;
+        }
+        id = ActionId(s_data.actions.size());
+        s_data.actions.push_back({action, {}});
+        s_data.actionIds[action] = id;
+    }
+    s_data.actions[id].bindings.push_back(mask);
+    return id;
+}
+
+Input::ActionId Input::GetAction(const std::string& action)
+{
+    auto it = s_data.actionIds.find(action);
+    return it != s_data.actionIds.end() ? it->second : s_invalidAction;
+}
+
+void Input::ClearActions()
+{
+    s_data.actions.clear();
+    s_data.actionIds.clear();
+    s_data.actionsHeld.reset();
+    s_data.actionsWereHeld.reset();
+}
+
+bool Input::IsActionPressed(ActionId action)
+{
+    return action < s_maxActions && s_data.actionsHeld[action];
+}
+
+bool Input::IsActionJustPressed(ActionId action)
+{
+    return action < s_maxActions && s_data.actionsHeld[action] && !s_data.actionsWereHeld[action];
+}
+
+bool Input::IsActionJustReleased(ActionId action)
+{
+    return action < s_maxActions && !s_data.actionsHeld[action] && s_data.actionsWereHeld[action];
+}
+
+bool Input::IsActionPressed(const std::string& action)
+{
+    return IsActionPressed(GetAction(action));
+}
+
+bool Input::IsActionJustPressed(const std::string& action)
+{
+    return IsActionJustPressed(GetAction(action));
+}
+
+bool Input::IsActionJustReleased(const std::string& action)
+{
+    return IsActionJustReleased(GetAction(action));
+}
+}    // namespace Brigerad
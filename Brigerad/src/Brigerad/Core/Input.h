@@ -1,20 +1,109 @@
 #pragma once
 
 #include "Brigerad/Core/Core.h"
+#include "Brigerad/Core/GamepadCodes.h"
 #include "Brigerad/Core/KeyCodes.h"
 #include "Brigerad/Core/MouseButtonCodes.h"
 
+#include <array>
+#include <bitset>
+#include <string>
+#include <vector>
+
 namespace Brigerad
 {
+/**
+ * State of every input, taken once per frame.
+ * Plain data, copy it to keep or replay a frame.
+ */
+struct InputSnapshot
+{
+    static constexpr size_t s_keyCount           = size_t(KeyCode::Menu) + 1;
+    static constexpr size_t s_mouseButtonCount   = size_t(MouseCode::ButtonLast) + 1;
+    static constexpr size_t s_gamepadButtonCount = size_t(GamepadButton::Last) + 1;
+    static constexpr size_t s_gamepadAxisCount   = size_t(GamepadAxis::Last) + 1;
+
+    // Index of the bits of each device in buttons.
+    static constexpr size_t s_firstMouseButton   = s_keyCount;
+    static constexpr size_t s_firstGamepadButton = s_firstMouseButton + s_mouseButtonCount;
+    // Each axis has a bit for each direction, set when pushed past s_axisThreshold.
+    static constexpr size_t s_firstGamepadAxis = s_firstGamepadButton + s_gamepadButtonCount;
+    static constexpr size_t s_buttonCount      = s_firstGamepadAxis + 2 * s_gamepadAxisCount;
+    static constexpr float  s_axisThreshold    = 0.5f;
+
+    // Keys, then mouse buttons, then gamepad buttons, then gamepad axes. Set when held down.
+    std::bitset<s_buttonCount>            buttons;
+    float                                 mouseX      = 0.0f;
+    float                                 mouseY      = 0.0f;
+    bool                                  hasGamepad  = false;    // The first one connected.
+    std::array<float, s_gamepadAxisCount> gamepadAxes = {};
+};
+
+/**
+ * Queries of the state of the inputs, from the snapshot taken at the start of the frame.
+ *
+ * Pressed means held down, JustPressed and JustReleased are only true in the frame where the state
+ * changed. Actions give names to inputs, see LoadActions.
+ */
 class BRIGERAD_API Input
 {
 public:
+    using ActionId                            = uint32_t;
+    static constexpr ActionId s_invalidAction = ~ActionId(0);
+    static constexpr size_t   s_maxActions    = 128;
+
+    // Called by the application at the start of the frame.
+    static void                 NewFrame();
+    // Same, with a snapshot from elsewhere, e.g. a recording, instead of the inputs.
+    static void                 NewFrame(const InputSnapshot& snapshot);
+    static const InputSnapshot& GetSnapshot();
+
     // Public API, static interface.
     static bool IsKeyPressed(KeyCode keycode);
+    static bool IsKeyJustPressed(KeyCode keycode);
+    static bool IsKeyJustReleased(KeyCode keycode);
 
     static bool                    IsMouseButtonPressed(MouseCode button);
+    static bool                    IsMouseButtonJustPressed(MouseCode button);
+    static bool                    IsMouseButtonJustReleased(MouseCode button);
     static float                   GetMouseX();
     static float                   GetMouseY();
     static std::pair<float, float> GetMousePos();
+
+    static bool  IsGamepadConnected();
+    static bool  IsGamepadButtonPressed(GamepadButton button);
+    static bool  IsGamepadButtonJustPressed(GamepadButton button);
+    static bool  IsGamepadButtonJustReleased(GamepadButton button);
+    static float GetGamepadAxis(GamepadAxis axis);
+
+    /**
+     * Load actions from a YAML file, added to the ones already bound:
+     *
+     *   Actions:
+     *     - Name: Save
+     *       Bindings:
+     *         - [LeftControl, S]
+     *     - Name: MoveUp
+     *       Bindings: [W, Up, Gamepad.DPadUp, Gamepad.LeftY-]
+     *
+     * An action is pressed while all the inputs of one of its bindings are. Inputs are named after
+     * KeyCode, Mouse.<MouseCode>, Gamepad.<GamepadButton> and Gamepad.<GamepadAxis> followed by the
+     * direction.
+     */
+    static bool     LoadActions(const std::string& path);
+    static ActionId BindAction(const std::string& action, const std::vector<std::string>& inputs);
+    static ActionId GetAction(const std::string& action);
+    static void     ClearActions();
+
+    static bool IsActionPressed(ActionId action);
+    static bool IsActionJustPressed(ActionId action);
+    static bool IsActionJustReleased(ActionId action);
+    static bool IsActionPressed(const std::string& action);
+    static bool IsActionJustPressed(const std::string& action);
+    static bool IsActionJustReleased(const std::string& action);
+
+private:
+    // Read the state of the inputs from the platform.
+    static void Poll(InputSnapshot& snapshot);
 };
 }    // namespace Brigerad
@@ -0,0 +1,464 @@
+/**
+ * @file   InputRecording.cpp
+ * @author Samuel Martel
+ * @date   2026/10/19
+ *
+ * @brief  Source for the InputRecording module.
+ */
+#include "brpch.h"
+#include "InputRecording.h"
+
+#include "Brigerad/Core/Time.h"
+#include "Brigerad/Events/ApplicationEvent.h"
+#include "Brigerad/Events/KeyEvents.h"
+#include "Brigerad/Events/MouseEvent.h"
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
+namespace Brigerad
+{
+/*
+ * A recording is a header followed by records, each a tag and its data:
+ *
+ *   "BRIR" version width height
+ *   Frame frameTimeNs [Buttons] [Mouse] [Gamepad] [events...]
+ *   Frame ...
+ *
+ * The integers are varints. A recording cut short, e.g. by a crash, plays up to its last frame.
+ */
+static constexpr char     s_magic[4] = {'B', 'R', 'I', 'R'};
+static constexpr uint64_t s_version  = 1;
+
+enum class RecordTag : uint8_t
+{
+    Frame = 1,
+    Buttons,    // The bits of the snapshot that changed.
+    Mouse,
+    Gamepad,
+
+    KeyPressed,
+    KeyReleased,
+    KeyTyped,
+    MouseButtonPressed,
+    MouseButtonReleased,
+    MouseMoved,
+    MouseScrolled,
+    WindowResize,
+    WindowClose,
+};
+
+static bool IsEventTag(uint8_t tag)
+{
+    return tag >= uint8_t(RecordTag::KeyPressed) && tag <= uint8_t(RecordTag::WindowClose);
+}
+
+Scope<InputRecorder> InputRecorder::Create(const std::string& path, uint32_t width, uint32_t height)
+{
+    auto recorder = CreateScope<InputRecorder>();
+    recorder->m_file.open(path, std::ios::binary | std::ios::trunc);
+    if (!recorder->m_file.is_open())
+    {
+        BR_CORE_ERROR("Unable to create input recording '{}'!", path);
+        return nullptr;
+    }
+
+    recorder->m_file.write(s_magic, sizeof(s_magic));
+    recorder->WriteVarint(s_version);
+    recorder->WriteVarint(width);
+    recorder->WriteVarint(height);
+    return recorder;
+}
+
+InputRecorder::~InputRecorder()
+{
+    BR_CORE_INFO("Recorded {} frames of inputs.", m_frames);
+}
+
+void InputRecorder::RecordFrame(int64_t frameTimeNs, const InputSnapshot& snapshot)
+{
+    BR_PROFILE_FUNCTION();
+
+    WriteTag(uint8_t(RecordTag::Frame));
+    WriteVarint(uint64_t(std::max(frameTimeNs, int64_t(0))));
+
+    auto changed = snapshot.buttons ^ m_last.buttons;
+    if (changed.any())
+    {
+        WriteTag(uint8_t(RecordTag::Buttons));
+        WriteVarint(changed.count());
+        for (size_t i = 0; i < changed.size(); i++)
+        {
+            if (changed[i])
+            {
+                WriteVarint(i);
+            }
+        }
+    }
+
+    if (snapshot.mouseX != m_last.mouseX || snapshot.mouseY != m_last.mouseY)
+    {
+        WriteTag(uint8_t(RecordTag::Mouse));
+        WriteFloat(snapshot.mouseX);
+        WriteFloat(snapshot.mouseY);
+    }
+
+    if (snapshot.hasGamepad != m_last.hasGamepad || snapshot.gamepadAxes != m_last.gamepadAxes)
+    {
+        WriteTag(uint8_t(RecordTag::Gamepad));
+        WriteVarint(snapshot.hasGamepad);
+        for (float axis : snapshot.gamepadAxes)
+        {
+            WriteFloat(axis);
+        }
+    }
+
+    m_last = snapshot;
+    m_frames++;
+}
+
+void InputRecorder::RecordEvent(const Event& e)
+{
+    // The events belong to the frame before them.
+    if (m_frames == 0)
+    {
+        return;
+    }
+
+    switch (e.GetEventType())
+    {
+        case EventType::KeyPressed:
+        {
+            const auto& key = static_cast<const KeyPressedEvent&>(e);
+            WriteTag(uint8_t(RecordTag::KeyPressed));
+            WriteVarint(uint64_t(key.GetKeyCode()));
+            WriteVarint(uint64_t(key.GetRepeatCount()));
+            break;
+        }
+        case EventType::KeyReleased:
+            WriteTag(uint8_t(RecordTag::KeyReleased));
+            WriteVarint(uint64_t(static_cast<const KeyEvent&>(e).GetKeyCode()));
+            break;
+        case EventType::KeyTyped:
+            WriteTag(uint8_t(RecordTag::KeyTyped));
+            WriteVarint(uint64_t(static_cast<const KeyEvent&>(e).GetKeyCode()));
+            break;
+        case EventType::MouseButtonPressed:
+            WriteTag(uint8_t(RecordTag::MouseButtonPressed));
+            WriteVarint(uint64_t(static_cast<const MouseButtonEvent&>(e).GetMouseButton()));
+            break;
+        case EventType::MouseButtonReleased:
+            WriteTag(uint8_t(RecordTag::MouseButtonReleased));
+            WriteVarint(uint64_t(static_cast<const MouseButtonEvent&>(e).GetMouseButton()));
+            break;
+        case EventType::MouseMoved:
+        {
+            const auto& moved = static_cast<const MouseMovedEvent&>(e);
+            WriteTag(uint8_t(RecordTag::MouseMoved));
+            WriteFloat(moved.GetX());
+            WriteFloat(moved.GetY());
+            break;
+        }
+        case EventType::MouseScrolled:
+        {
+            const auto& scrolled = static_cast<const MouseScrolledEvent&>(e);
+            WriteTag(uint8_t(RecordTag::MouseScrolled));
+            WriteFloat(scrolled.GetXOffset());
+            WriteFloat(scrolled.GetYOffset());
+            break;
+        }
+        case EventType::WindowResize:
+        {
+            const auto& resize = static_cast<const WindowResizeEvent&>(e);
+            WriteTag(uint8_t(RecordTag::WindowResize));
+            WriteVarint(resize.GetWidth());
+            WriteVarint(resize.GetHeight());
+            break;
+        }
+        case EventType::WindowClose:
+            WriteTag(uint8_t(RecordTag::WindowClose));
+            break;
+        default:
+            break;
+    }
+}
+
+bool InputRecorder::IsRecorded(const Event& e)
+{
+    switch (e.GetEventType())
+    {
+        case EventType::KeyPressed:
+        case EventType::KeyReleased:
+        case EventType::KeyTyped:
+        case EventType::MouseButtonPressed:
+        case EventType::MouseButtonReleased:
+        case EventType::MouseMoved:
+        case EventType::MouseScrolled:
+        case EventType::WindowResize:
+        case EventType::WindowClose:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void InputRecorder::WriteTag(uint8_t tag)
+{
+    m_file.put(char(tag));
+}
+
+void InputRecorder::WriteVarint(uint64_t value)
+{
+    // 7 bits at a time, the high bit set when more follow.
+    while (value >= 0x80)
+    {
+        m_file.put(char(uint8_t(value) | 0x80));
+        value >>= 7;
+    }
+    m_file.put(char(value));
+}
+
+void InputRecorder::WriteFloat(float value)
+{
+    m_file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+Scope<InputPlayer> InputPlayer::Create(const std::string& path, PlaybackPace pace)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open())
+    {
+        BR_CORE_ERROR("Unable to open input recording '{}'!", path);
+        return nullptr;
+    }
+
+    auto player    = CreateScope<InputPlayer>();
+    player->m_pace = pace;
+    player->m_data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+
+    char magic[sizeof(s_magic)];
+    if (!player->Read(magic, sizeof(magic)) || std::memcmp(magic, s_magic, sizeof(magic)) != 0)
+    {
+        BR_CORE_ERROR("'{}' is not an input recording!", path);
+        return nullptr;
+    }
+    uint64_t version = player->ReadVarint();
+    if (version != s_version)
+    {
+        BR_CORE_ERROR("Input recording '{}' is version {}, expected {}!", path, version, s_version);
+        return nullptr;
+    }
+    player->m_width  = uint32_t(player->ReadVarint());
+    player->m_height = uint32_t(player->ReadVarint());
+
+    return player->m_isValid ? std::move(player) : nullptr;
+}
+
+bool InputPlayer::NextFrame(int64_t& frameTimeNs)
+{
+    BR_PROFILE_FUNCTION();
+
+    int64_t now = GetTimeNs();
+    if (m_frameStartNs != 0)
+    {
+        m_frameTimesNs.push_back(now - m_frameStartNs);
+    }
+
+    if (m_position >= m_data.size() || m_data[m_position] != uint8_t(RecordTag::Frame))
+    {
+        return false;
+    }
+    m_position++;
+    frameTimeNs = int64_t(ReadVarint());
+
+    // The changes of the snapshot.
+    while (m_isValid && m_position < m_data.size() && !IsEventTag(m_data[m_position]) &&
+           m_data[m_position] != uint8_t(RecordTag::Frame))
+    {
+        switch (RecordTag(m_data[m_position++]))
+        {
+            case RecordTag::Buttons:
+            {
+                uint64_t count = ReadVarint();
+                for (uint64_t i = 0; i < count && m_isValid; i++)
+                {
+                    uint64_t bit = ReadVarint();
+                    if (bit < m_snapshot.buttons.size())
+                    {
+                        m_snapshot.buttons.flip(size_t(bit));
+                    }
+                }
+                break;
+            }
+            case RecordTag::Mouse:
+                m_snapshot.mouseX = ReadFloat();
+                m_snapshot.mouseY = ReadFloat();
+                break;
+            case RecordTag::Gamepad:
+                m_snapshot.hasGamepad = ReadVarint() != 0;
+                for (float& axis : m_snapshot.gamepadAxes)
+                {
+                    axis = ReadFloat();
+                }
+                break;
+            default:
+                BR_CORE_ERROR("Unknown record in the input recording, stopping the playback.");
+                m_isValid = false;
+                break;
+        }
+    }
+    if (!m_isValid)
+    {
+        return false;
+    }
+
+    if (m_pace == PlaybackPace::Original && m_frameStartNs != 0)
+    {
+        int64_t wait = m_frameStartNs + frameTimeNs - now;
+        if (wait > 0)
+        {
+            std::this_thread::sleep_for(std::chrono::nanoseconds(wait));
+        }
+    }
+    m_frameStartNs = GetTimeNs();
+    return true;
+}
+
+void InputPlayer::DispatchEvents(const std::function<void(Event&)>& dispatch)
+{
+    BR_PROFILE_FUNCTION();
+
+    while (m_isValid && m_position < m_data.size() && IsEventTag(m_data[m_position]))
+    {
+        switch (RecordTag(m_data[m_position++]))
+        {
+            case RecordTag::KeyPressed:
+            {
+                auto            key    = KeyCode(ReadVarint());
+                int             repeat = int(ReadVarint());
+                KeyPressedEvent e(key, repeat);
+                dispatch(e);
+                break;
+            }
+            case RecordTag::KeyReleased:
+            {
+                KeyReleasedEvent e {KeyCode(ReadVarint())};
+                dispatch(e);
+                break;
+            }
+            case RecordTag::KeyTyped:
+            {
+                KeyTypedEvent e {KeyCode(ReadVarint())};
+                dispatch(e);
+                break;
+            }
+            case RecordTag::MouseButtonPressed:
+            {
+                MouseButtonPressedEvent e {MouseCode(ReadVarint())};
+                dispatch(e);
+                break;
+            }
+            case RecordTag::MouseButtonReleased:
+            {
+                MouseButtonReleasedEvent e {MouseCode(ReadVarint())};
+                dispatch(e);
+                break;
+            }
+            case RecordTag::MouseMoved:
+            {
+                float           x = ReadFloat();
+                float           y = ReadFloat();
+                MouseMovedEvent e(x, y);
+                dispatch(e);
+                break;
+            }
+            case RecordTag::MouseScrolled:
+            {
+                float              x = ReadFloat();
+                float              y = ReadFloat();
+                MouseScrolledEvent e(x, y);
+                dispatch(e);
+                break;
+            }
+            case RecordTag::WindowResize:
+            {
+                auto              width  = uint32_t(ReadVarint());
+                auto              height = uint32_t(ReadVarint());
+                WindowResizeEvent e(width, height);
+                dispatch(e);
+                break;
+            }
+            case RecordTag::WindowClose:
+            {
+                WindowCloseEvent e;
+                dispatch(e);
+                break;
+            }
+            default:
+                break;
+        }
+    }
+}
+
+InputPlayer::Stats InputPlayer::GetStats() const
+{
+    Stats stats;
+    stats.frames = m_frameTimesNs.size();
+    if (stats.frames == 0)
+    {
+        return stats;
+    }
+
+    std::vector<int64_t> sorted = m_frameTimesNs;
+    std::sort(sorted.begin(), sorted.end());
+    auto percentile = [&](double p) {
+        return float(sorted[size_t(p * double(sorted.size() - 1))] * 1e-6);
+    };
+    stats.p50Ms = percentile(0.50);
+    stats.p95Ms = percentile(0.95);
+    stats.p99Ms = percentile(0.99);
+    stats.maxMs = float(sorted.back() * 1e-6);
+    return stats;
+}
+
+bool InputPlayer::Read(void* data, size_t size)
+{
+    if (m_position + size > m_data.size())
+    {
+        m_isValid  = false;
+        m_position = m_data.size();
+        std::memset(data, 0, size);
+        return false;
+    }
+    std::memcpy(data, &m_data[m_position], size);
+    m_position += size;
+    return true;
+}
+
+uint64_t InputPlayer::ReadVarint()
+{
+    uint64_t value = 0;
+    for (int shift = 0; shift < 64; shift += 7)
+    {
+        uint8_t byte = 0;
+        if (!Read(&byte, 1))
+        {
+            return 0;
+        }
+        value |= uint64_t(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0)
+        {
+            break;
+        }
+    }
+    return value;
+}
+
+float InputPlayer::ReadFloat()
+{
+    float value = 0.0f;
+    Read(&value, sizeof(value));
+    return value;
+}
+}    // namespace Brigerad
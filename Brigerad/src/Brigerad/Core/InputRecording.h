@@ -0,0 +1,105 @@
+/**
+ * @file   InputRecording.h
+ * @author Samuel Martel
+ * @date   2026/10/19
+ *
+ * @brief  Header for the InputRecording module.
+ */
+#pragma once
+
+#include "Brigerad/Core/Core.h"
+#include "Brigerad/Core/Input.h"
+#include "Brigerad/Events/Event.h"
+
+#include <fstream>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Brigerad
+{
+/**
+ * Writes what a session needs to be played back to a file: the time each frame took, the input
+ * snapshot of each frame and the events of the window. Only what changed is written.
+ */
+class InputRecorder
+{
+public:
+    /** Nullptr if the file can't be written. The size of the window is restored on playback. */
+    static Scope<InputRecorder> Create(const std::string& path, uint32_t width, uint32_t height);
+    ~InputRecorder();
+
+    void RecordFrame(int64_t frameTimeNs, const InputSnapshot& snapshot);
+    void RecordEvent(const Event& e);
+
+    inline uint64_t GetFrameCount() const { return m_frames; }
+
+    /** True for the events a recording carries, the ones the window raises. */
+    static bool IsRecorded(const Event& e);
+
+private:
+    void WriteTag(uint8_t tag);
+    void WriteVarint(uint64_t value);
+    void WriteFloat(float value);
+
+private:
+    std::ofstream m_file;
+    InputSnapshot m_last;
+    uint64_t      m_frames = 0;
+};
+
+enum class PlaybackPace
+{
+    Original,            // Each frame takes at least as long as it did when recorded.
+    AsFastAsPossible,    // The next frame starts as soon as the last one is done.
+};
+
+/**
+ * Reads a recording back, frame by frame.
+ * The frames get the timestep they had when recorded, whatever time they actually take.
+ */
+class InputPlayer
+{
+public:
+    /** Nullptr if the file isn't a recording. */
+    static Scope<InputPlayer> Create(const std::string& path, PlaybackPace pace);
+
+    /** Start the next frame, false at the end of the recording. Waits at the original pace. */
+    bool NextFrame(int64_t& frameTimeNs);
+    /** Pass the events of the frame to dispatch, where the window would raise them. */
+    void DispatchEvents(const std::function<void(Event&)>& dispatch);
+
+    inline const InputSnapshot& GetSnapshot() const { return m_snapshot; }
+    inline PlaybackPace         GetPace() const { return m_pace; }
+    inline uint32_t             GetWidth() const { return m_width; }
+    inline uint32_t             GetHeight() const { return m_height; }
+
+    /** Time the frames played back took to run, not counting the waits for the original pace. */
+    struct Stats
+    {
+        size_t frames = 0;
+        float  p50Ms  = 0.0f;
+        float  p95Ms  = 0.0f;
+        float  p99Ms  = 0.0f;
+        float  maxMs  = 0.0f;
+    };
+    Stats GetStats() const;
+
+private:
+    bool     Read(void* data, size_t size);
+    uint64_t ReadVarint();
+    float    ReadFloat();
+
+private:
+    std::vector<uint8_t> m_data;
+    size_t               m_position = 0;
+    bool                 m_isValid  = true;    // False once past the end of the data.
+    PlaybackPace         m_pace     = PlaybackPace::Original;
+    uint32_t             m_width    = 0;
+    uint32_t             m_height   = 0;
+
+    InputSnapshot        m_snapshot;
+    int64_t              m_frameStartNs = 0;
+    std::vector<int64_t> m_frameTimesNs;
+};
+}    // namespace Brigerad
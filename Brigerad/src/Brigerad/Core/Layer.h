@@ -43,6 +43,14 @@ public:
     {
     }
 
+    /**
+     * Called at a fixed rate (Application::SetFixedUpdateRate), zero or more times per frame and
+     * always before OnUpdate. Use it for the simulation, OnUpdate for what depends on the frame.
+     */
+    virtual void OnFixedUpdate(Timestep timestep)
+    {
+    }
+
     virtual void OnUpdate(Timestep timestep)
     {
     }
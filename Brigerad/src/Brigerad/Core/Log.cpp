@@ -1,25 +1,104 @@
 #include "brpch.h"
 #include "Log.h"
 
+#include "Brigerad/Core/AsyncLogger.h"
+
+#include "spdlog/sinks/file_sinks.h"
 #include "spdlog/sinks/stdout_sinks.h"
+#ifdef BR_PLATFORM_WINDOWS
+#include "spdlog/sinks/wincolor_sink.h"
+#else
+#include "spdlog/sinks/ansicolor_sink.h"
+#endif
+
+#include <filesystem>
 
 namespace Brigerad
 {
 
+// Before the loggers, so that it is destroyed after them.
+Scope<LogQueue>                 Log::s_Queue;
 std::shared_ptr<spdlog::logger> Log::s_CoreLogger;
 std::shared_ptr<spdlog::logger> Log::s_ClientLogger;
 
-void Log::Init()
+static std::shared_ptr<spdlog::logger> CreateLogger(const std::string&                   name,
+                                                    const std::vector<spdlog::sink_ptr>& sinks,
+                                                    LogQueue*                            queue)
 {
+    std::shared_ptr<spdlog::logger> logger;
+    if (queue != nullptr)
+    {
+        logger = std::make_shared<AsyncLogger>(name, sinks, *queue);
+    }
+    else
+    {
+        logger = std::make_shared<spdlog::logger>(name, sinks.begin(), sinks.end());
+    }
+
     // %T -> Timestamp
     // %n -> Name of the logger
     // %v -> Message
-    spdlog::set_pattern("%^[%T] %n: %v%$");
+    logger->set_pattern("%^[%T] %n: %v%$");
+    logger->set_level(spdlog::level::level_enum(BR_LOG_LEVEL));
+    // Errors are usually followed by an assert, have them in the file first.
+    logger->flush_on(spdlog::level::err);
+    spdlog::register_logger(logger);
+    return logger;
+}
+
+void Log::Init(const LogSettings& settings)
+{
+    // The loggers share the sinks, and the thread of the queue when asynchronous.
+    std::vector<spdlog::sink_ptr> sinks;
+#ifdef BR_PLATFORM_WINDOWS
+    sinks.push_back(std::make_shared<spdlog::sinks::wincolor_stdout_sink_mt>());
+#else
+    sinks.push_back(std::make_shared<spdlog::sinks::ansicolor_stdout_sink_mt>());
+#endif
+
+    std::string fileError;
+    if (!settings.filePath.empty())
+    {
+        try
+        {
+            auto directory = std::filesystem::path(settings.filePath).parent_path();
+            if (!directory.empty())
+            {
+                std::filesystem::create_directories(directory);
+            }
+            sinks.push_back(std::make_shared<spdlog::sinks::rotating_file_sink_mt>(
+              settings.filePath, settings.maxFileSize, settings.maxFiles));
+        }
+        catch (const std::exception& ex)
+        {
+            fileError = ex.what();
+        }
+    }
+
+    if (settings.isAsync)
+    {
+        s_Queue = CreateScope<LogQueue>(settings.queueSize);
+    }
 
-    s_CoreLogger = spdlog::stdout_color_mt("BRIGERAD");
-    s_CoreLogger->set_level(spdlog::level::trace);
+    s_CoreLogger   = CreateLogger("BRIGERAD", sinks, s_Queue.get());
+    s_ClientLogger = CreateLogger("APP", sinks, s_Queue.get());
 
-    s_ClientLogger = spdlog::stdout_color_mt("APP");
-    s_ClientLogger->set_level(spdlog::level::trace);
+    if (!fileError.empty())
+    {
+        BR_CORE_WARN("Unable to log to '{}': {}", settings.filePath, fileError);
+    }
+}
+
+void Log::Shutdown()
+{
+    if (s_Queue)
+    {
+        s_Queue->Stop();
+    }
+}
+
+uint64_t Log::GetDroppedCount()
+{
+    return s_Queue ? s_Queue->GetDroppedCount() : 0;
+}
 }
-}
\ No newline at end of file
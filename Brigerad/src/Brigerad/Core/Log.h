@@ -5,12 +5,47 @@
 #include "spdlog/fmt/ostr.h"
 
 
+// Levels of the log macros, the same values as spdlog::level.
+#define BR_LOG_LEVEL_TRACE    0
+#define BR_LOG_LEVEL_INFO     2
+#define BR_LOG_LEVEL_WARN     3
+#define BR_LOG_LEVEL_ERROR    4
+#define BR_LOG_LEVEL_CRITICAL 5
+#define BR_LOG_LEVEL_OFF      6
+
+// The macros of the levels below BR_LOG_LEVEL compile to nothing, their arguments aren't evaluated.
+#ifndef BR_LOG_LEVEL
+    #ifdef BR_DIST
+        #define BR_LOG_LEVEL BR_LOG_LEVEL_INFO
+    #else
+        #define BR_LOG_LEVEL BR_LOG_LEVEL_TRACE
+    #endif
+#endif
+
 namespace Brigerad
 {
+class LogQueue;
+
+struct LogSettings
+{
+    // Write the messages from a background thread, see AsyncLogger.
+    bool        isAsync     = true;
+    size_t      queueSize   = 8192;
+    // Empty to only log to the console. The file is rotated once it reaches maxFileSize.
+    std::string filePath    = "logs/Brigerad.log";
+    size_t      maxFileSize = 5 * 1024 * 1024;
+    size_t      maxFiles    = 3;
+};
+
 class BRIGERAD_API Log
 {
 public:
-    static void Init();
+    static void Init(const LogSettings& settings = LogSettings());
+    // Write the messages left in the queue. The loggers still work afterwards, synchronously.
+    static void Shutdown();
+
+    // Messages not logged because the queue was full.
+    static uint64_t GetDroppedCount();
 
     inline static std::shared_ptr<spdlog::logger>& GetCoreLogger()
     {
@@ -27,6 +62,8 @@ private:
      * needs to have dll - interface to be used by clients of class 'Brigerad::Log'"
      */
     #pragma warning(suppress: 4251)
+    static Scope<LogQueue> s_Queue;
+    #pragma warning(suppress: 4251)
     static std::shared_ptr<spdlog::logger> s_CoreLogger;
     #pragma warning(suppress: 4251)
     static std::shared_ptr<spdlog::logger> s_ClientLogger;
@@ -34,16 +71,42 @@ private:
 
 }
 
-// Core Log Macros.
-#define BR_CORE_TRACE(...)      ::Brigerad::Log::GetCoreLogger()->trace(__VA_ARGS__)
-#define BR_CORE_INFO(...)       ::Brigerad::Log::GetCoreLogger()->info(__VA_ARGS__)
-#define BR_CORE_WARN(...)       ::Brigerad::Log::GetCoreLogger()->warn(__VA_ARGS__)
-#define BR_CORE_ERROR(...)      ::Brigerad::Log::GetCoreLogger()->error(__VA_ARGS__)
-#define BR_CORE_CRITICAL(...)   ::Brigerad::Log::GetCoreLogger()->critical(__VA_ARGS__)
-
-// Client Log Macros.
-#define BR_TRACE(...)           ::Brigerad::Log::GetClientLogger()->trace(__VA_ARGS__)
-#define BR_INFO(...)            ::Brigerad::Log::GetClientLogger()->info(__VA_ARGS__)
-#define BR_WARN(...)            ::Brigerad::Log::GetClientLogger()->warn(__VA_ARGS__)
-#define BR_ERROR(...)           ::Brigerad::Log::GetClientLogger()->error(__VA_ARGS__)
-#define BR_CRITICAL(...)        ::Brigerad::Log::GetClientLogger()->critical(__VA_ARGS__)
+#if BR_LOG_LEVEL <= BR_LOG_LEVEL_TRACE
+    #define BR_CORE_TRACE(...)      ::Brigerad::Log::GetCoreLogger()->trace(__VA_ARGS__)
+    #define BR_TRACE(...)           ::Brigerad::Log::GetClientLogger()->trace(__VA_ARGS__)
+#else
+    #define BR_CORE_TRACE(...)      (void)0
+    #define BR_TRACE(...)           (void)0
+#endif
+
+#if BR_LOG_LEVEL <= BR_LOG_LEVEL_INFO
+    #define BR_CORE_INFO(...)       ::Brigerad::Log::GetCoreLogger()->info(__VA_ARGS__)
+    #define BR_INFO(...)            ::Brigerad::Log::GetClientLogger()->info(__VA_ARGS__)
+#else
+    #define BR_CORE_INFO(...)       (void)0
+    #define BR_INFO(...)            (void)0
+#endif
+
+#if BR_LOG_LEVEL <= BR_LOG_LEVEL_WARN
+    #define BR_CORE_WARN(...)       ::Brigerad::Log::GetCoreLogger()->warn(__VA_ARGS__)
+    #define BR_WARN(...)            ::Brigerad::Log::GetClientLogger()->warn(__VA_ARGS__)
+#else
+    #define BR_CORE_WARN(...)       (void)0
+    #define BR_WARN(...)            (void)0
+#endif
+
+#if BR_LOG_LEVEL <= BR_LOG_LEVEL_ERROR
+    #define BR_CORE_ERROR(...)      ::Brigerad::Log::GetCoreLogger()->error(__VA_ARGS__)
+    #define BR_ERROR(...)           ::Brigerad::Log::GetClientLogger()->error(__VA_ARGS__)
+#else
+    #define BR_CORE_ERROR(...)      (void)0
+    #define BR_ERROR(...)           (void)0
+#endif
+
+#if BR_LOG_LEVEL <= BR_LOG_LEVEL_CRITICAL
+    #define BR_CORE_CRITICAL(...)   ::Brigerad::Log::GetCoreLogger()->critical(__VA_ARGS__)
+    #define BR_CRITICAL(...)        ::Brigerad::Log::GetClientLogger()->critical(__VA_ARGS__)
+#else
+    #define BR_CORE_CRITICAL(...)   (void)0
+    #define BR_CRITICAL(...)        (void)0
+#endif
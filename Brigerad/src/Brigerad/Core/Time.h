@@ -3,9 +3,14 @@
 #include "Platform/Windows/WindowsTime.h"
 #include "Platform/Linux/LinuxTime.h"
 
+#include <cstdint>
+
 namespace Brigerad
 {
-double GetTime()
+/**
+ * Seconds since GLFW was initialized.
+ */
+inline double GetTime()
 {
 #if BR_PLATFORM_WINDOWS
     return WindowsGetTime();
@@ -16,4 +21,19 @@ double GetTime()
 #endif
 }
 
+/**
+ * Nanoseconds of a monotonic clock with an unspecified origin.
+ * Only the difference between two readings is meaningful. It stays exact for centuries of uptime.
+ */
+inline int64_t GetTimeNs()
+{
+#if BR_PLATFORM_WINDOWS
+    return WindowsGetTimeNs();
+#elif defined(BR_PLATFORM_LINUX)
+    return LinuxGetTimeNs();
+#else
+#error Unsuported OS
+#endif
+}
+
 } // namespace Brigerad
\ No newline at end of file
@@ -5,6 +5,7 @@
 // #include "Brigerad.h"
 #include "Brigerad/Core/Core.h"
 #include "Brigerad/Events/Event.h"
+#include "Brigerad/Renderer/GraphicsContext.h"
 
 namespace Brigerad
 {
@@ -32,6 +33,11 @@ public:
 
     virtual void OnUpdate() = 0;
 
+    // Block until an event is received or the timeout, in seconds, expires.
+    virtual void WaitEvents(double timeout) = 0;
+    // Make WaitEvents return. Can be called from any thread.
+    virtual void Wake() = 0;
+
     virtual unsigned int GetWidth() const = 0;
     virtual unsigned int GetHeight() const = 0;
 
@@ -41,6 +47,7 @@ public:
     virtual bool IsVSync() const = 0;
 
     virtual void *GetNativeWindow() const = 0;
+    virtual GraphicsContext &GetContext() = 0;
 
     static Window *Create(const WindowProps &props = WindowProps());
 };
@@ -0,0 +1,74 @@
+/**
+ * @file   CommandLineTools.cpp
+ * @author Samuel Martel
+ * @date   2026/10/19
+ *
+ * @brief  Source for the CommandLineTools module.
+ */
+#include "brpch.h"
+#include "CommandLineTools.h"
+
+namespace Brigerad
+{
+struct ToolEntry
+{
+    std::string            description;
+    CommandLineTools::Tool tool;
+};
+
+// In a function, the tools register during static initialization.
+static std::map<std::string, ToolEntry>& GetTools()
+{
+    static std::map<std::string, ToolEntry> tools;
+    return tools;
+}
+
+bool CommandLineTools::Register(const std::string& name, const std::string& description, Tool tool)
+{
+    GetTools()[name] = ToolEntry {description, std::move(tool)};
+    return true;
+}
+
+bool CommandLineTools::Run(int argc, char** argv, int& exitCode)
+{
+    if (argc < 2 || std::string(argv[1]).rfind("--", 0) != 0)
+    {
+        return false;
+    }
+
+    std::string name = std::string(argv[1]).substr(2);
+    if (name == "help")
+    {
+        for (const auto& [toolName, entry] : GetTools())
+        {
+            BR_CORE_INFO("--{:<24} {}", toolName, entry.description);
+        }
+        exitCode = 0;
+        return true;
+    }
+
+    auto it = GetTools().find(name);
+    if (it == GetTools().end())
+    {
+        return false;
+    }
+
+    BR_PROFILE_FUNCTION();
+    exitCode = it->second.tool(std::vector<std::string>(argv + 2, argv + argc));
+    return true;
+}
+
+size_t CommandLineTools::GetArgument(const std::vector<std::string>& args,
+                                     size_t                          i,
+                                     size_t                          defaultValue)
+{
+    if (i >= args.size())
+    {
+        return defaultValue;
+    }
+
+    char*              end   = nullptr;
+    unsigned long long value = strtoull(args[i].c_str(), &end, 10);
+    return end != args[i].c_str() && *end == '\0' ? size_t(value) : defaultValue;
+}
+}    // namespace Brigerad
@@ -0,0 +1,46 @@
+/**
+ * @file   CommandLineTools.h
+ * @author Samuel Martel
+ * @date   2026/10/19
+ *
+ * @brief  Header for the CommandLineTools module.
+ */
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Brigerad
+{
+/**
+ * Tools run from the command line instead of the application, such as the benchmarks.
+ *
+ * `--<name> [arguments...]` runs the tool with the arguments that follow its name and exits with
+ * the code it returns. Applications register theirs before main, see BR_REGISTER_TOOL.
+ */
+class CommandLineTools
+{
+public:
+    using Tool = std::function<int(const std::vector<std::string>& args)>;
+
+    /** Always true, to register from the initializer of a static. */
+    static bool Register(const std::string& name, const std::string& description, Tool tool);
+
+    /**
+     * Run the tool named by the first argument.
+     * False if it doesn't name one, the application is started as usual then.
+     */
+    static bool Run(int argc, char** argv, int& exitCode);
+
+    /** Argument i as a number, or the default if there isn't one or it isn't a number. */
+    static size_t GetArgument(const std::vector<std::string>& args, size_t i, size_t defaultValue);
+};
+}    // namespace Brigerad
+
+#define BR_TOOL_CONCAT_IMPL(a, b) a##b
+#define BR_TOOL_CONCAT(a, b)      BR_TOOL_CONCAT_IMPL(a, b)
+// Register a tool from any source file of the application.
+#define BR_REGISTER_TOOL(name, description, tool)                                                  \
+    static const bool BR_TOOL_CONCAT(s_toolRegistered, __LINE__) =                                 \
+      ::Brigerad::CommandLineTools::Register(name, description, tool)
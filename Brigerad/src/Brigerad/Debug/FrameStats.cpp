@@ -0,0 +1,163 @@
+/**
+ * @file   FrameStats.cpp
+ * @author Samuel Martel
+ * @date   2026/10/19
+ *
+ * @brief  Source for the FrameStats module.
+ */
+#include "brpch.h"
+#include "FrameStats.h"
+
+#include "Brigerad/Core/Time.h"
+#include "Brigerad/Renderer/GpuTimer.h"
+
+#include <algorithm>
+#include <array>
+
+namespace Brigerad
+{
+struct FrameStatsData
+{
+    std::array<FrameStats::Frame, FrameStats::s_historySize> history;
+    size_t                                                   next  = 0;
+    size_t                                                   count = 0;
+
+    FrameStats::Frame current;
+    int64_t           frameStart = 0;
+    Scope<GpuTimer>   gpuTimer;
+};
+
+static FrameStatsData s_data;
+
+static float ToMs(int64_t ns)
+{
+    return float(double(ns) * 1e-6);
+}
+
+void FrameStats::Init()
+{
+    s_data.gpuTimer = GpuTimer::Create();
+}
+
+void FrameStats::Shutdown()
+{
+    s_data.gpuTimer.reset();
+}
+
+void FrameStats::BeginFrame()
+{
+    s_data.current    = Frame();
+    s_data.frameStart = GetTimeNs();
+    if (s_data.gpuTimer != nullptr)
+    {
+        s_data.gpuTimer->Begin();
+    }
+}
+
+void FrameStats::EndRendering()
+{
+    if (s_data.gpuTimer != nullptr)
+    {
+        s_data.gpuTimer->End();
+        s_data.current.gpuMs = s_data.gpuTimer->GetLastMs();
+    }
+}
+
+void FrameStats::EndFrame()
+{
+    s_data.current.totalMs = ToMs(GetTimeNs() - s_data.frameStart);
+
+    s_data.history[s_data.next] = s_data.current;
+    s_data.next                 = (s_data.next + 1) % s_historySize;
+    s_data.count                = std::min(s_data.count + 1, s_historySize);
+}
+
+void FrameStats::AddPhaseTime(Phase phase, int64_t ns)
+{
+    s_data.current.phaseMs[size_t(phase)] += ToMs(ns);
+}
+
+FrameStats::ScopedPhase::ScopedPhase(Phase phase) : m_phase(phase), m_start(GetTimeNs())
+{
+}
+
+FrameStats::ScopedPhase::~ScopedPhase()
+{
+    AddPhaseTime(m_phase, GetTimeNs() - m_start);
+}
+
+size_t FrameStats::GetFrameCount()
+{
+    return s_data.count;
+}
+
+const FrameStats::Frame& FrameStats::GetFrame(size_t index)
+{
+    return s_data.history[(s_data.next + s_historySize - s_data.count + index) % s_historySize];
+}
+
+FrameStats::Summary FrameStats::GetSummary()
+{
+    Summary summary;
+    summary.frames = s_data.count;
+    if (s_data.count == 0)
+    {
+        return summary;
+    }
+
+    std::array<float, s_historySize> totals;
+    size_t                           gpuFrames = 0;
+    float                            gpuMs     = 0.0f;
+    for (size_t i = 0; i < s_data.count; i++)
+    {
+        const Frame& frame = GetFrame(i);
+        totals[i]          = frame.totalMs;
+        summary.averageMs += frame.totalMs;
+        for (size_t phase = 0; phase < s_phaseCount; phase++)
+        {
+            summary.phaseMs[phase] += frame.phaseMs[phase];
+        }
+        if (frame.gpuMs >= 0.0f)
+        {
+            gpuMs += frame.gpuMs;
+            gpuFrames++;
+        }
+    }
+
+    float frames = float(s_data.count);
+    summary.averageMs /= frames;
+    for (float& phaseMs : summary.phaseMs)
+    {
+        phaseMs /= frames;
+    }
+    if (gpuFrames != 0)
+    {
+        summary.gpuMs = gpuMs / float(gpuFrames);
+    }
+
+    std::sort(totals.begin(), totals.begin() + s_data.count);
+    auto percentile = [&](float p) { return totals[size_t(p * (frames - 1.0f))]; };
+    summary.p50Ms   = percentile(0.50f);
+    summary.p95Ms   = percentile(0.95f);
+    summary.p99Ms   = percentile(0.99f);
+    summary.maxMs   = totals[s_data.count - 1];
+    return summary;
+}
+
+void FrameStats::GetHistogram(float* bins, size_t binCount, float binMs)
+{
+    std::fill(bins, bins + binCount, 0.0f);
+    for (size_t i = 0; i < s_data.count; i++)
+    {
+        size_t bin = size_t(GetFrame(i).totalMs / binMs);
+        bins[std::min(bin, binCount - 1)] += 1.0f;
+    }
+}
+
+const char* FrameStats::GetPhaseName(Phase phase)
+{
+    static const char* names[] = {"Fixed update", "Update", "ImGui", "Present"};
+    static_assert(sizeof(names) / sizeof(names[0]) == s_phaseCount, "Missing phase names!");
+    return names[size_t(phase)];
+}
+}    // namespace Brigerad
@@ -0,0 +1,87 @@
+/**
+ * @file   FrameStats.h
+ * @author Samuel Martel
+ * @date   2026/10/19
+ *
+ * @brief  Header for the FrameStats module.
+ */
+#pragma once
+
+#include "Brigerad/Core/Core.h"
+
+#include <cstdint>
+
+namespace Brigerad
+{
+/**
+ * Rolling history of the time taken by the last frames, split by phase, with the GPU time.
+ *
+ * Cheap enough to always run: a few clock readings per frame and one GPU timer query, read back
+ * frames later without waiting. The percentiles are only worked out when asked for.
+ */
+class FrameStats
+{
+public:
+    enum class Phase
+    {
+        FixedUpdate,
+        Update,     // Layer::OnUpdate.
+        ImGui,      // Layer::OnImGuiRender and the rendering of ImGui.
+        Present,    // Window events and buffer swap, waiting for the render thread.
+        Count
+    };
+    static constexpr size_t s_phaseCount  = size_t(Phase::Count);
+    static constexpr size_t s_historySize = 512;
+
+    struct Frame
+    {
+        float totalMs               = 0.0f;
+        float phaseMs[s_phaseCount] = {};
+        // The latest result, from a few frames ago. Negative if there is none.
+        float gpuMs = -1.0f;
+    };
+
+    struct Summary
+    {
+        size_t frames                = 0;
+        float  averageMs             = 0.0f;
+        float  p50Ms                 = 0.0f;
+        float  p95Ms                 = 0.0f;
+        float  p99Ms                 = 0.0f;
+        float  maxMs                 = 0.0f;
+        float  phaseMs[s_phaseCount] = {};       // Averages.
+        float  gpuMs                 = -1.0f;    // Average, negative if not measured.
+    };
+
+    /** The GPU timer needs the graphics context. */
+    static void Init();
+    static void Shutdown();
+
+    static void BeginFrame();
+    /** Everything of the frame is drawn, the GPU time stops here, before the buffer swap. */
+    static void EndRendering();
+    static void EndFrame();
+
+    static void AddPhaseTime(Phase phase, int64_t ns);
+
+    class ScopedPhase
+    {
+    public:
+        ScopedPhase(Phase phase);
+        ~ScopedPhase();
+
+    private:
+        Phase   m_phase;
+        int64_t m_start;
+    };
+
+    /** Frames in the history, GetFrame(0) being the oldest. */
+    static size_t       GetFrameCount();
+    static const Frame& GetFrame(size_t index);
+    static Summary      GetSummary();
+    /** Count the frames taking [i * binMs, (i + 1) * binMs), the last bin takes the slower ones. */
+    static void GetHistogram(float* bins, size_t binCount, float binMs);
+
+    static const char* GetPhaseName(Phase phase);
+};
+}    // namespace Brigerad
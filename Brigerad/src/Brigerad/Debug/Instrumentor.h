@@ -28,6 +28,7 @@
 #include <chrono>
 #include <algorithm>
 #include <fstream>
+#include <mutex>
 
 #include <thread>
 
@@ -62,6 +63,8 @@ class Instrumentor
     InstrumentationSession* m_currentSession;
     std::ofstream m_outputStream;
     int m_profileCount;
+    // Scopes are timed on every thread that runs systems or jobs.
+    std::recursive_mutex m_mutex;
 
     public:
     Instrumentor() : m_currentSession(nullptr), m_profileCount(0) {}
@@ -70,6 +73,7 @@ class Instrumentor
                       const std::string& filepath = "results.json",
                       long long duration          = 0)
     {
+        std::lock_guard lock(m_mutex);
         m_outputStream.open(filepath);
         WriteHeader();
         m_currentSession = new InstrumentationSession{ name };
@@ -77,6 +81,7 @@ class Instrumentor
 
     void EndSession()
     {
+        std::lock_guard lock(m_mutex);
         WriteFooter();
         m_outputStream.close();
         delete m_currentSession;
@@ -86,6 +91,7 @@ class Instrumentor
 
     void WriteProfile(const ProfileResult& result)
     {
+        std::lock_guard lock(m_mutex);
         if (m_currentSession == nullptr)
         {
             return;
@@ -181,7 +187,7 @@ class InstrumentationTimer
     private:
     std::chrono::time_point<std::chrono::high_resolution_clock> GetTime()
     {
-        static auto lastTime = std::chrono::high_resolution_clock::now();
+        thread_local auto lastTime = std::chrono::high_resolution_clock::now();
         auto time            = std::chrono::high_resolution_clock::now();
 
         if (time == lastTime)
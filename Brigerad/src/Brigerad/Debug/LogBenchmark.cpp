@@ -0,0 +1,129 @@
+/**
+ * @file   LogBenchmark.cpp
+ * @author Samuel Martel
+ * @date   2026/10/19
+ *
+ * @brief  Source for the LogBenchmark module.
+ */
+#include "brpch.h"
+#include "LogBenchmark.h"
+
+#include "Brigerad/Core/AsyncLogger.h"
+#include "Brigerad/Core/Time.h"
+
+#include "spdlog/sinks/file_sinks.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <thread>
+
+namespace Brigerad
+{
+// Time of each call, in nanoseconds.
+static std::vector<int64_t> TimeCalls(spdlog::logger& logger, size_t iterations)
+{
+    std::vector<int64_t> times(iterations);
+    for (size_t i = 0; i < iterations; i++)
+    {
+        int64_t start = GetTimeNs();
+        logger.trace("Deserialized node with ID = {}, name = {}", 1000000007 * i, "Benchmark");
+        times[i] = GetTimeNs() - start;
+    }
+    return times;
+}
+
+static std::vector<int64_t> TimeCalls(spdlog::logger& logger,
+                                      size_t          iterations,
+                                      size_t          threadCount)
+{
+    std::vector<std::vector<int64_t>> timesPerThread(threadCount);
+    std::vector<std::thread>          threads;
+    for (size_t i = 0; i < threadCount; i++)
+    {
+        threads.emplace_back([&, i]() { timesPerThread[i] = TimeCalls(logger, iterations); });
+    }
+
+    std::vector<int64_t> times;
+    for (size_t i = 0; i < threadCount; i++)
+    {
+        threads[i].join();
+        times.insert(times.end(), timesPerThread[i].begin(), timesPerThread[i].end());
+    }
+    return times;
+}
+
+static void Report(const std::string& name, std::vector<int64_t> times)
+{
+    std::sort(times.begin(), times.end());
+    auto percentile = [&](float p) { return times[size_t(p * float(times.size() - 1))]; };
+    BR_CORE_INFO("{:<32} p50 {:>6} ns, p99 {:>7} ns, max {:>9} ns",
+                 name,
+                 percentile(0.50f),
+                 percentile(0.99f),
+                 times.back());
+}
+
+static std::shared_ptr<spdlog::logger> Prepare(const std::shared_ptr<spdlog::logger>& logger)
+{
+    logger->set_pattern("%^[%T] %n: %v%$");
+    logger->set_level(spdlog::level::trace);
+    return logger;
+}
+
+void LogBenchmark::Run(size_t iterations, size_t threadCount, const std::string& filePath)
+{
+    BR_PROFILE_FUNCTION();
+
+    std::filesystem::path directory = std::filesystem::path(filePath).parent_path();
+    if (!directory.empty())
+    {
+        std::filesystem::create_directories(directory);
+    }
+    std::vector<spdlog::sink_ptr> sinks = {
+      std::make_shared<spdlog::sinks::rotating_file_sink_mt>(filePath, 5 * 1024 * 1024, 3)};
+
+    BR_CORE_INFO("Log call latency, {} calls per thread:", iterations);
+
+    {
+        std::vector<int64_t> times(iterations);
+        for (size_t i = 0; i < iterations; i++)
+        {
+            int64_t start = GetTimeNs();
+            times[i]      = GetTimeNs() - start;
+        }
+        Report("Clock only", std::move(times));
+    }
+
+    {
+        auto logger =
+          Prepare(std::make_shared<spdlog::logger>("Filtered", sinks.begin(), sinks.end()));
+        logger->set_level(spdlog::level::info);
+        Report("Below the level of the logger", TimeCalls(*logger, iterations));
+    }
+
+    {
+        auto logger = Prepare(std::make_shared<spdlog::logger>("Sync", sinks.begin(), sinks.end()));
+        Report("Synchronous, file", TimeCalls(*logger, iterations));
+        logger->flush();
+    }
+
+    {
+        // Room for every message, what is measured is the push, not the policy when full.
+        LogQueue queue(iterations * threadCount);
+        auto     logger = Prepare(std::make_shared<AsyncLogger>("Async", sinks, queue));
+        Report("Asynchronous, file", TimeCalls(*logger, iterations));
+        logger->flush();
+
+        Report(fmt::format("Asynchronous, file, {} threads", threadCount),
+               TimeCalls(*logger, iterations, threadCount));
+        logger->flush();
+
+        if (queue.GetDroppedCount() != 0)
+        {
+            BR_CORE_WARN("{} messages dropped.", queue.GetDroppedCount());
+        }
+        // Before the logger is gone.
+        queue.Stop();
+    }
+}
+}    // namespace Brigerad
@@ -0,0 +1,31 @@
+/**
+ * @file   LogBenchmark.h
+ * @author Samuel Martel
+ * @date   2026/10/19
+ *
+ * @brief  Header for the LogBenchmark module.
+ */
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace Brigerad
+{
+/**
+ * Time spent by the calling thread in a log call, the latency seen by the hot path.
+ *
+ * Times each call of the trace the scene serializer logs for each entity and prints the percentiles
+ * for: a message below the level of the logger, the synchronous and the asynchronous loggers
+ * writing to a file, and the asynchronous one with several threads logging.
+ * The console is left out, its speed depends on the terminal more than on the logger.
+ */
+class LogBenchmark
+{
+public:
+    /** The messages are written to filePath, rotated like the log of the application. */
+    static void Run(size_t             iterations  = 50000,
+                    size_t             threadCount = 4,
+                    const std::string& filePath    = "logs/LogBenchmark.log");
+};
+}    // namespace Brigerad
@@ -0,0 +1,159 @@
+/**
+ * @file   TransformBenchmark.cpp
+ * @author Samuel Martel
+ * @date   2026/10/19
+ *
+ * @brief  Source for the TransformBenchmark module.
+ */
+#include "brpch.h"
+#include "TransformBenchmark.h"
+
+#include "Brigerad/Core/Time.h"
+#include "Brigerad/Scene/TransformSystem.h"
+
+#include <random>
+
+namespace Brigerad
+{
+static std::vector<TransformComponent> MakeTransforms(size_t count, bool is3d)
+{
+    std::mt19937                          rng(31);
+    std::uniform_real_distribution<float> position(-1000.0f, 1000.0f);
+    std::uniform_real_distribution<float> angle(-360.0f, 360.0f);
+    std::uniform_real_distribution<float> scale(0.1f, 10.0f);
+
+    std::vector<TransformComponent> transforms(count);
+    for (TransformComponent& transform : transforms)
+    {
+        transform.position = {position(rng), position(rng), position(rng)};
+        transform.rotation = {is3d ? angle(rng) : 0.0f, is3d ? angle(rng) : 0.0f, angle(rng)};
+        transform.scale    = {scale(rng), scale(rng), scale(rng)};
+    }
+    return transforms;
+}
+
+// Best time of the runs, in milliseconds.
+template<typename Function>
+static double TimeBest(size_t runs, Function&& function)
+{
+    double best = std::numeric_limits<double>::max();
+    for (size_t i = 0; i < runs; i++)
+    {
+        int64_t start = GetTimeNs();
+        function();
+        best = std::min(best, double(GetTimeNs() - start) / 1e6);
+    }
+    return best;
+}
+
+static float GetMaxError(const std::vector<glm::mat4>& expected, const std::vector<glm::mat4>& got)
+{
+    float maxError = 0.0f;
+    for (size_t i = 0; i < expected.size(); i++)
+    {
+        float largest = 0.0f;
+        float error   = 0.0f;
+        for (int c = 0; c < 4; c++)
+        {
+            for (int r = 0; r < 4; r++)
+            {
+                largest = std::max(largest, std::abs(expected[i][c][r]));
+                error   = std::max(error, std::abs(expected[i][c][r] - got[i][c][r]));
+            }
+        }
+        maxError = std::max(maxError, error / largest);
+    }
+    return maxError;
+}
+
+// Angles past what the timed cases cover, negative and large up to where the SIMD reduction
+// gives way to std::sin and std::cos, and past it.
+static float CheckAngles()
+{
+    std::vector<float> angles = {0.0f, 90.0f, -90.0f, 180.0f, -180.0f, 720.5f, -720.5f};
+    for (float angle = 1e3f; angle <= 1e12f; angle *= 3.16f)
+    {
+        angles.push_back(angle);
+        angles.push_back(-angle);
+        angles.push_back(angle + 45.0f);
+    }
+    // Around the end of the range of the SIMD reduction, 8192 radians.
+    for (float angle = 469000.0f; angle <= 470000.0f; angle += 25.0f)
+    {
+        angles.push_back(angle);
+        angles.push_back(-angle);
+    }
+
+    std::vector<TransformComponent> transforms;
+    for (size_t i = 0; i < angles.size(); i++)
+    {
+        TransformComponent transform;
+        transform.rotation = {angles[i], angles[(i * 7 + 3) % angles.size()], angles[i]};
+        transform.scale    = {1.0f, 2.0f, 3.0f};
+        transforms.push_back(transform);
+        transform.rotation = {0.0f, 0.0f, angles[i]};
+        transforms.push_back(transform);
+    }
+
+    std::vector<glm::mat4> expected(transforms.size());
+    std::vector<glm::mat4> got(transforms.size());
+    TransformSystem::ComputeScalar(transforms.data(), transforms.size(), expected.data());
+    TransformSystem::Compute(transforms.data(), transforms.size(), got.data());
+    return GetMaxError(expected, got);
+}
+
+void TransformBenchmark::Run(size_t runs)
+{
+    BR_PROFILE_FUNCTION();
+
+    BR_CORE_INFO(
+      "TransformSystem ({}), best of {} runs:", TransformSystem::GetInstructionSet(), runs);
+    for (bool is3d : {false, true})
+    {
+        for (size_t count : {10000, 100000, 1000000})
+        {
+            std::vector<TransformComponent> transforms = MakeTransforms(count, is3d);
+            std::vector<const TransformComponent*> pointers(count);
+            for (size_t i = 0; i < count; i++)
+            {
+                pointers[i] = &transforms[i];
+            }
+            std::vector<glm::mat4> expected(count);
+            std::vector<glm::mat4> got(count);
+
+            double scalarMs = TimeBest(runs, [&]() {
+                TransformSystem::ComputeScalar(transforms.data(), count, expected.data());
+            });
+            double gatheredMs = TimeBest(runs, [&]() {
+                TransformSystem::Compute(pointers.data(), count, got.data());
+            });
+            float  maxError = GetMaxError(expected, got);
+            double packedMs = TimeBest(runs, [&]() {
+                TransformSystem::Compute(transforms.data(), count, got.data());
+            });
+            maxError = std::max(maxError, GetMaxError(expected, got));
+
+            BR_CORE_INFO("{} {:>7} entities: GetTransform {:8.3f} ms, packed {:8.3f} ms "
+                         "({:4.1f}x), gathered {:8.3f} ms ({:4.1f}x), max relative error {:.1e}",
+                         is3d ? "3D" : "2D",
+                         count,
+                         scalarMs,
+                         packedMs,
+                         scalarMs / packedMs,
+                         gatheredMs,
+                         scalarMs / gatheredMs,
+                         maxError);
+        }
+    }
+
+    float angleError = CheckAngles();
+    if (!(angleError <= 1e-5f))
+    {
+        BR_CORE_ERROR("Large and negative angles: max relative error {:.1e}", angleError);
+    }
+    else
+    {
+        BR_CORE_INFO("Large and negative angles: max relative error {:.1e}", angleError);
+    }
+}
+}    // namespace Brigerad
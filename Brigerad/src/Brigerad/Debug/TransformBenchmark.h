@@ -0,0 +1,27 @@
+/**
+ * @file   TransformBenchmark.h
+ * @author Samuel Martel
+ * @date   2026/10/19
+ *
+ * @brief  Header for the TransformBenchmark module.
+ */
+#pragma once
+
+#include <cstddef>
+
+namespace Brigerad
+{
+/**
+ * Compares TransformSystem::Compute to one GetTransform per entity, for 10k, 100k and 1M
+ * entities, rotated only around z and rotated around every axis.
+ *
+ * Prints the best of a few runs of each, the speedup and the largest error relative to the
+ * biggest element of the matrix, for the instruction set the engine was built for. Then checks
+ * large and negative angles against GetTransform, an error if they are off.
+ */
+class TransformBenchmark
+{
+public:
+    static void Run(size_t runs = 5);
+};
+}    // namespace Brigerad
@@ -38,6 +38,9 @@ enum class EventType
     // ImGui Events.
     ImGuiButtonPressed,
     ImGuiButtonReleased,
+    // Serial Events.
+    SerialPortAdded,
+    SerialPortRemoved,
 };
 
 enum EventCategory
@@ -49,6 +52,7 @@ enum EventCategory
     EventCategoryMouse       = BIT(3),
     EventCategoryMouseButton = BIT(4),
     EventCategoryImGui       = BIT(5),
+    EventCategorySerial      = BIT(6),
 };
 
 #define EVENT_CLASS_TYPE(type)                                                                     \
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "Event.h"
+
+#include "serial/serial.h"
+
+namespace Brigerad
+{
+class SerialPortEvent : public Event
+{
+public:
+    const serial::PortInfo& GetPort() const { return m_port; }
+    EVENT_CLASS_CATEGORY(EventCategorySerial)
+
+protected:
+    serial::PortInfo m_port;
+    SerialPortEvent(const serial::PortInfo& port) : m_port(port) {}
+};
+
+class BRIGERAD_API SerialPortAddedEvent : public SerialPortEvent
+{
+public:
+    SerialPortAddedEvent(const serial::PortInfo& port) : SerialPortEvent(port) {}
+
+    std::string ToString() const override
+    {
+        std::stringstream ss;
+        ss << "SerialPortAddedEvent: " << m_port.port << " (" << m_port.description << ")";
+        return ss.str();
+    }
+
+    EVENT_CLASS_TYPE(EventType::SerialPortAdded)
+};
+
+class BRIGERAD_API SerialPortRemovedEvent : public SerialPortEvent
+{
+public:
+    SerialPortRemovedEvent(const serial::PortInfo& port) : SerialPortEvent(port) {}
+
+    std::string ToString() const override
+    {
+        std::stringstream ss;
+        ss << "SerialPortRemovedEvent: " << m_port.port;
+        return ss.str();
+    }
+
+    EVENT_CLASS_TYPE(EventType::SerialPortRemoved)
+};
+}    // namespace Brigerad
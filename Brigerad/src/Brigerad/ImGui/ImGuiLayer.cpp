@@ -13,6 +13,12 @@
 #include "examples/imgui_impl_opengl3.h"
 
 #include "Brigerad/Core/Application.h"
+#include "Brigerad/Core/Input.h"
+#include "Brigerad/Debug/FrameStats.h"
+#include "Brigerad/Renderer/Renderer2D.h"
+#include "Brigerad/Renderer/RenderThread.h"
+#include "Brigerad/Script/ScriptEngine.h"
+#include "Brigerad/Script/ScriptScheduler.h"
 
 // TEMP
 #include <GLFW/glfw3.h>
@@ -47,6 +53,12 @@ void ImGuiLayer::OnAttach()
                                            //     ImGuiConfigFlags_ViewportsNoTaskBarIcons;
                                            //     io.ConfigFlags |=
                                            //     ImGuiConfigFlags_ViewportsNoMerge;
+    // The platform windows each have their own context, which would need to follow the main one
+    // on the render thread.
+    if (RenderThread::IsRunning())
+    {
+        io.ConfigFlags &= ~ImGuiConfigFlags_ViewportsEnable;
+    }
 
     io.Fonts->AddFontFromFileTTF("assets/fonts/OpenSans-Bold.ttf", 18.0f);
     io.FontDefault = io.Fonts->AddFontFromFileTTF("assets/fonts/OpenSans-Regular.ttf", 18.0f);
@@ -71,20 +83,38 @@ void ImGuiLayer::OnAttach()
 
     // Setup Platform/Renderer bindings.
     ImGui_ImplGlfw_InitForOpenGL(window, true);
-    ImGui_ImplOpenGL3_Init("#version 410");
+    RenderThread::Execute([]() {
+        ImGui_ImplOpenGL3_Init("#version 410");
+        // Otherwise created by the first NewFrame, on the main thread.
+        ImGui_ImplOpenGL3_CreateDeviceObjects();
+    });
 }
 
 void ImGuiLayer::OnDetach()
 {
     BR_PROFILE_FUNCTION();
 
-    ImGui_ImplOpenGL3_Shutdown();
+    RenderThread::Execute([]() { ImGui_ImplOpenGL3_Shutdown(); });
     ImGui_ImplGlfw_Shutdown();
     ImGui::DestroyContext();
 }
 
 void ImGuiLayer::OnEvent(Event& event)
 {
+    if (Application::Get().IsPlayingBack())
+    {
+        if (event.GetEventType() == EventType::KeyTyped)
+        {
+            m_playbackCharacters.push_back(
+              (unsigned int)static_cast<KeyTypedEvent&>(event).GetKeyCode());
+        }
+        else if (event.GetEventType() == EventType::MouseScrolled)
+        {
+            m_playbackWheelX += static_cast<MouseScrolledEvent&>(event).GetXOffset();
+            m_playbackWheelY += static_cast<MouseScrolledEvent&>(event).GetYOffset();
+        }
+    }
+
     if (m_blockImGuiEvents)
     {
         ImGuiIO& io = ImGui::GetIO();
@@ -112,6 +142,11 @@ void ImGuiLayer::OnImGuiRender()
         return;
     }
 
+    if (m_showPerformanceOverlay)
+    {
+        DrawPerformanceOverlay();
+    }
+
     if (m_showMetricWindow)
     {
         ImGui::ShowMetricsWindow(&m_showMetricWindow);
@@ -127,11 +162,53 @@ void ImGuiLayer::OnImGuiRender()
             BR_INFO("Set VSync to {0}", isVSync);
         }
 
+        if (RenderThread::IsRunning())
+        {
+            auto stats = RenderThread::GetStats();
+            ImGui::Text("Main thread: %.2fms (waiting: %.2fms)", stats.mainThreadMs, stats.waitMs);
+            ImGui::Text("Render thread: %.2fms", stats.renderThreadMs);
+        }
+
+        auto luaStats = ScriptEngine::GetMemoryStats();
+        ImGui::Text("Lua memory: %.1fKB (peak: %.1fKB, reserved: %.1fKB) in %zu state(s)",
+                    luaStats.allocator.bytesInUse / 1024.0f,
+                    luaStats.allocator.peakBytesInUse / 1024.0f,
+                    luaStats.allocator.bytesReserved / 1024.0f,
+                    luaStats.stateCount);
+        ImGui::Text("Lua blocks: %zu pooled, %zu large",
+                    luaStats.allocator.pooledBlocks,
+                    luaStats.allocator.largeBlocks);
+        ImGui::Text("Lua GC: %.2fms (behind by %.1fKB)", luaStats.gcMs, luaStats.gcDebt / 1024.0f);
+
+        auto coroutines = ScriptScheduler::GetStats();
+        ImGui::Text("Lua coroutines: %zu (%zu timed, %zu frames, %zu events), %zu resumed",
+                    coroutines.coroutines,
+                    coroutines.waitingTime,
+                    coroutines.waitingFrames,
+                    coroutines.waitingEvents,
+                    coroutines.resumed);
+
+        auto budget = ScriptEngine::GetBudgetStats();
+        ImGui::Text("Lua OnUpdate: %.2fms, %zu suspended, %zu deferred",
+                    budget.updateMs,
+                    budget.suspended,
+                    budget.deferred);
+        // Only the first few, a broken script can put every entity over budget.
+        static constexpr size_t maxOverBudget = 10;
+        for (size_t i = 0; i < budget.overBudget.size() && i < maxOverBudget; i++)
+        {
+            ImGui::BulletText("Over budget: %s", budget.overBudget[i].c_str());
+        }
+
         if (ImGui::Button("Open metric window"))
         {
             m_showMetricWindow = true;
         }
 
+        ImGui::SameLine();
+
+        ImGui::Checkbox("Performance overlay", &m_showPerformanceOverlay);
+
         if (ImGui::Button(m_isProfiling == false ? "Start Profiling" : "Stop  Profiling"))
         {
             if (m_isProfiling == false)
@@ -152,6 +229,39 @@ void ImGuiLayer::OnImGuiRender()
 
         ImGui::InputDouble("Profiling Duration", &m_profilingDuration, 0.001, 0.100, "%0.3f");
 
+        Application& app = Application::Get();
+        if (ImGui::Button(app.IsRecording() ? "Stop  Recording Inputs" : "Start Recording Inputs"))
+        {
+            if (app.IsRecording())
+            {
+                app.StopRecording();
+            }
+            else
+            {
+                app.StartRecording("BrigeradInputs.brir");
+            }
+        }
+
+        ImGui::SameLine();
+
+        if (ImGui::Button(app.IsPlayingBack() ? "Stop  Playback" : "Play Back Inputs"))
+        {
+            if (app.IsPlayingBack())
+            {
+                app.StopPlayback();
+            }
+            else
+            {
+                app.StartPlayback("BrigeradInputs.brir",
+                                  m_playbackAsFastAsPossible ? PlaybackPace::AsFastAsPossible
+                                                             : PlaybackPace::Original);
+            }
+        }
+
+        ImGui::SameLine();
+
+        ImGui::Checkbox("As fast as possible", &m_playbackAsFastAsPossible);
+
         ImGui::End();
     }
 }
@@ -162,9 +272,140 @@ void ImGuiLayer::Begin()
 
     ImGui_ImplOpenGL3_NewFrame();
     ImGui_ImplGlfw_NewFrame();
+    if (Application::Get().IsPlayingBack())
+    {
+        ApplyPlaybackInputs();
+    }
     ImGui::NewFrame();
 }
 
+/**
+ * Frame times of the last frames, in a corner of the main window.
+ */
+void ImGuiLayer::DrawPerformanceOverlay()
+{
+    const ImGuiViewport* viewport = ImGui::GetMainViewport();
+    ImGui::SetNextWindowPos(ImVec2(viewport->Pos.x + 10.0f, viewport->Pos.y + 10.0f));
+    ImGui::SetNextWindowViewport(viewport->ID);
+    ImGui::SetNextWindowBgAlpha(0.75f);
+    ImGuiWindowFlags flags = ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_AlwaysAutoResize |
+                             ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoNav |
+                             ImGuiWindowFlags_NoFocusOnAppearing | ImGuiWindowFlags_NoMove;
+    if (!ImGui::Begin("Performance", nullptr, flags))
+    {
+        ImGui::End();
+        return;
+    }
+
+    auto summary = FrameStats::GetSummary();
+    ImGui::Text("Frame: %.2fms (%.0f FPS) over %zu frames",
+                summary.averageMs,
+                summary.averageMs > 0.0f ? 1000.0f / summary.averageMs : 0.0f,
+                summary.frames);
+    ImGui::Text("p50: %.2fms  p95: %.2fms  p99: %.2fms  max: %.2fms",
+                summary.p50Ms,
+                summary.p95Ms,
+                summary.p99Ms,
+                summary.maxMs);
+
+    // The history, the newest on the right.
+    static constexpr float graphHeight = 60.0f;
+    ImGui::PlotLines(
+      "##History",
+      [](void*, int i) { return FrameStats::GetFrame(size_t(i)).totalMs; },
+      nullptr,
+      int(FrameStats::GetFrameCount()),
+      0,
+      nullptr,
+      0.0f,
+      std::max(summary.maxMs, 1.0f),
+      ImVec2(0.0f, graphHeight));
+
+    // 1ms per bin, the last one takes everything slower.
+    static constexpr size_t binCount = 40;
+    float                   bins[binCount];
+    FrameStats::GetHistogram(bins, binCount, 1.0f);
+    ImGui::PlotHistogram("##Histogram",
+                         bins,
+                         int(binCount),
+                         0,
+                         "0-40ms",
+                         0.0f,
+                         FLT_MAX,
+                         ImVec2(0.0f, graphHeight));
+
+    // Where the time of the CPU goes, on average.
+    float otherMs = summary.averageMs;
+    for (size_t i = 0; i < FrameStats::s_phaseCount; i++)
+    {
+        float ms = summary.phaseMs[i];
+        otherMs -= ms;
+        char label[64];
+        snprintf(
+          label, sizeof(label), "%s: %.2fms", FrameStats::GetPhaseName(FrameStats::Phase(i)), ms);
+        ImGui::ProgressBar(summary.averageMs > 0.0f ? ms / summary.averageMs : 0.0f,
+                           ImVec2(-1.0f, 0.0f),
+                           label);
+    }
+    ImGui::Text("Other: %.2fms", std::max(otherMs, 0.0f));
+
+    if (summary.gpuMs >= 0.0f)
+    {
+        ImGui::Text("GPU: %.2fms", summary.gpuMs);
+    }
+    else
+    {
+        ImGui::TextUnformatted("GPU: n/a");
+    }
+
+    auto renderStats = Renderer2D::GetStats();
+    ImGui::Text("Draw calls: %u, quads: %u", renderStats.drawCalls, renderStats.quadCount);
+
+    ImGui::End();
+}
+
+/**
+ * Replace what the GLFW backend read from the live inputs with the recording played back.
+ */
+void ImGuiLayer::ApplyPlaybackInputs()
+{
+    ImGuiIO&             io       = ImGui::GetIO();
+    const InputSnapshot& snapshot = Input::GetSnapshot();
+
+    // With the platform windows, ImGui works in screen coordinates.
+    ImVec2 origin = {0.0f, 0.0f};
+    if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable)
+    {
+        origin = ImGui::GetMainViewport()->Pos;
+    }
+    io.MousePos = ImVec2(origin.x + snapshot.mouseX, origin.y + snapshot.mouseY);
+    for (size_t i = 0; i < IM_ARRAYSIZE(io.MouseDown); i++)
+    {
+        io.MouseDown[i] = Input::IsMouseButtonPressed(MouseCode(i));
+    }
+
+    for (size_t key = 0; key < IM_ARRAYSIZE(io.KeysDown); key++)
+    {
+        io.KeysDown[key] = key < InputSnapshot::s_keyCount && snapshot.buttons[key];
+    }
+    io.KeyCtrl  = Input::IsKeyPressed(Key::LeftControl) || Input::IsKeyPressed(Key::RightControl);
+    io.KeyShift = Input::IsKeyPressed(Key::LeftShift) || Input::IsKeyPressed(Key::RightShift);
+    io.KeyAlt   = Input::IsKeyPressed(Key::LeftAlt) || Input::IsKeyPressed(Key::RightAlt);
+    io.KeySuper = Input::IsKeyPressed(Key::LeftSuper) || Input::IsKeyPressed(Key::RightSuper);
+
+    io.MouseWheel  = m_playbackWheelY;
+    io.MouseWheelH = m_playbackWheelX;
+    io.InputQueueCharacters.resize(0);
+    for (unsigned int c : m_playbackCharacters)
+    {
+        io.AddInputCharacter(c);
+    }
+
+    m_playbackWheelX = 0.0f;
+    m_playbackWheelY = 0.0f;
+    m_playbackCharacters.clear();
+}
+
 void ImGuiLayer::End()
 {
     BR_PROFILE_FUNCTION();
@@ -175,7 +416,14 @@ void ImGuiLayer::End()
 
     // Rendering.
     ImGui::Render();
-    ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+    if (RenderThread::IsRunning())
+    {
+        SubmitDrawData(ImGui::GetDrawData());
+    }
+    else
+    {
+        ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+    }
 
     if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable)
     {
@@ -186,4 +434,27 @@ void ImGuiLayer::End()
     }
 }
 
+void ImGuiLayer::SubmitDrawData(ImDrawData* drawData)
+{
+    BR_PROFILE_FUNCTION();
+
+    // The draw lists are rebuilt by the next frame while the render thread draws this one, so it
+    // gets its own copy.
+    ImDrawData copy = *drawData;
+    copy.CmdLists   = new ImDrawList*[drawData->CmdListsCount];
+    for (int i = 0; i < drawData->CmdListsCount; i++)
+    {
+        copy.CmdLists[i] = drawData->CmdLists[i]->CloneOutput();
+    }
+
+    RenderThread::Submit([copy]() mutable {
+        ImGui_ImplOpenGL3_RenderDrawData(&copy);
+        for (int i = 0; i < copy.CmdListsCount; i++)
+        {
+            IM_DELETE(copy.CmdLists[i]);
+        }
+        delete[] copy.CmdLists;
+    });
+}
+
 }    // namespace Brigerad
@@ -5,6 +5,8 @@
 #include "Brigerad/Events/MouseEvent.h"
 #include "Brigerad/Events/ApplicationEvent.h"
 
+struct ImDrawData;
+
 namespace Brigerad
 {
 class BRIGERAD_API ImGuiLayer : public Layer
@@ -25,6 +27,11 @@ public:
 
     inline void SetBlockEvents(bool state) { m_blockImGuiEvents = state; }
 
+private:
+    static void SubmitDrawData(ImDrawData* drawData);
+    void        ApplyPlaybackInputs();
+    void        DrawPerformanceOverlay();
+
 private:
     double m_time             = 0.0;
     bool   m_open             = false;
@@ -35,5 +42,13 @@ private:
     double m_profilingDuration  = 1.0;
 
     bool m_blockImGuiEvents = false;
+
+    bool m_showPerformanceOverlay = false;
+
+    // The inputs of the recording played back, ImGui reads the live ones from GLFW otherwise.
+    bool                      m_playbackAsFastAsPossible = false;
+    std::vector<unsigned int> m_playbackCharacters;
+    float                     m_playbackWheelX = 0.0f;
+    float                     m_playbackWheelY = 0.0f;
 };
 }    // namespace Brigerad
@@ -112,8 +112,9 @@ struct BufferElements
 class BufferLayout
 {
     public:
-    BufferLayout(const std::initializer_list<BufferElements>& elements)
-    : m_elements(elements)
+    // A per-instance layout advances once per instance instead of once per vertex.
+    BufferLayout(const std::initializer_list<BufferElements>& elements, bool perInstance = false)
+    : m_elements(elements), m_perInstance(perInstance)
     {
         CalculateOffsetsAndStride();
     }
@@ -126,6 +127,7 @@ class BufferLayout
     }
 
     inline const uint32_t GetStride() const { return m_stride; }
+    inline bool IsPerInstance() const { return m_perInstance; }
 
     std::vector<BufferElements>::iterator begin() { return m_elements.begin(); }
     std::vector<BufferElements>::iterator end() { return m_elements.end(); }
@@ -142,6 +144,7 @@ class BufferLayout
     private:
     std::vector<BufferElements> m_elements;
     uint32_t m_stride = 0;
+    bool m_perInstance = false;
 
     private:
     void CalculateOffsetsAndStride()
@@ -169,7 +172,10 @@ class VertexBuffer
     virtual const BufferLayout& GetLayout()            = 0;
     virtual void SetLayout(const BufferLayout& layout) = 0;
 
-    virtual void SetData(const void* data, uint32_t size) = 0;
+    virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) = 0;
+
+    /** Bind the buffer as the storage buffer of a compute shader, at binding. */
+    virtual void BindStorage(uint32_t binding) const = 0;
 
     virtual const uint32_t GetId() const = 0;
 
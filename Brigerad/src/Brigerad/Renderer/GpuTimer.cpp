@@ -0,0 +1,30 @@
+/**
+ * @file   GpuTimer.cpp
+ * @author Samuel Martel
+ * @date   2026/10/19
+ *
+ * @brief  Source for the GpuTimer module.
+ */
+#include "brpch.h"
+#include "GpuTimer.h"
+
+#include "Renderer.h"
+#include "Platform/OpenGL/OpenGLGpuTimer.h"
+
+namespace Brigerad
+{
+Scope<GpuTimer> GpuTimer::Create()
+{
+    switch (Renderer::GetAPI())
+    {
+        case RendererAPI::API::None:
+            BR_CORE_ASSERT(false, "RendererAPI::None is currently not supported!");
+            return nullptr;
+        case RendererAPI::API::OpenGL:
+            return CreateScope<OpenGLGpuTimer>();
+        default:
+            BR_CORE_ASSERT(false, "Invalid RendererAPI!");
+            return nullptr;
+    }
+}
+}    // namespace Brigerad
@@ -0,0 +1,33 @@
+/**
+ * @file   GpuTimer.h
+ * @author Samuel Martel
+ * @date   2026/10/19
+ *
+ * @brief  Header for the GpuTimer module.
+ */
+#pragma once
+
+#include "Brigerad/Core/Core.h"
+
+namespace Brigerad
+{
+/**
+ * Measures the time the GPU spends on the commands recorded between Begin and End.
+ *
+ * The results come back a few frames later and are only read once available: when the GPU is too
+ * far behind, measurements are skipped rather than waited for.
+ */
+class GpuTimer
+{
+public:
+    virtual ~GpuTimer() = default;
+
+    virtual void Begin() = 0;
+    virtual void End()   = 0;
+
+    /** The last result, in milliseconds. Negative until there is one. */
+    virtual float GetLastMs() const = 0;
+
+    static Scope<GpuTimer> Create();
+};
+}    // namespace Brigerad
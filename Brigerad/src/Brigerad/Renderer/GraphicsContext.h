@@ -11,6 +11,10 @@ public:
     virtual void Init()        = 0;
     virtual void SwapBuffers() = 0;
 
+    // Make the context current on the calling thread, or on none.
+    virtual void MakeCurrent()    = 0;
+    virtual void ReleaseCurrent() = 0;
+
 
     static Scope<GraphicsContext> Create(void* window);
 
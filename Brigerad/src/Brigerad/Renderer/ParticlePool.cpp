@@ -0,0 +1,140 @@
+/**
+ * @file   ParticlePool.cpp
+ * @author Samuel Martel
+ * @date   2026/10/19
+ *
+ * @brief  Source for the ParticlePool module.
+ */
+#include "brpch.h"
+#include "ParticlePool.h"
+
+#include "glm/gtc/constants.hpp"
+
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BR_PARTICLES_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace Brigerad
+{
+// xorshift32, plenty for particles and much cheaper than the <random> engines.
+static float RandomFloat(uint32_t& seed)
+{
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return float(seed >> 8) * (1.0f / 16777216.0f);
+}
+
+// Uniform in [-1, 1].
+static float RandomSigned(uint32_t& seed)
+{
+    return RandomFloat(seed) * 2.0f - 1.0f;
+}
+
+ParticlePool::ParticlePool(uint32_t capacity) : m_capacity(capacity)
+{
+    for (auto& stream : m_streams)
+    {
+        stream.resize(capacity);
+    }
+}
+
+void ParticlePool::Spawn(const glm::vec2&     origin,
+                         const ParticleProps& props,
+                         uint32_t&            seed,
+                         float (&out)[StreamCount])
+{
+    float lifetime = std::max(props.lifetime + props.lifetimeVariation * RandomSigned(seed), 1e-3f);
+
+    out[PositionX]       = origin.x + props.positionVariation.x * RandomSigned(seed);
+    out[PositionY]       = origin.y + props.positionVariation.y * RandomSigned(seed);
+    out[Rotation]        = RandomFloat(seed) * glm::two_pi<float>();
+    out[Age]             = 0.0f;
+    out[VelocityX]       = props.velocity.x + props.velocityVariation.x * RandomSigned(seed);
+    out[VelocityY]       = props.velocity.y + props.velocityVariation.y * RandomSigned(seed);
+    out[AngularVelocity] = props.angularVelocity * RandomSigned(seed);
+    out[InvLifetime]     = 1.0f / lifetime;
+}
+
+void ParticlePool::Emit(uint32_t count, const glm::vec2& origin, const ParticleProps& props)
+{
+    BR_PROFILE_FUNCTION();
+
+    count = std::min(count, m_capacity - m_count);
+    for (uint32_t i = 0; i < count; i++)
+    {
+        float particle[StreamCount];
+        Spawn(origin, props, m_seed, particle);
+
+        for (uint32_t s = 0; s < StreamCount; s++)
+        {
+            m_streams[s][m_count] = particle[s];
+        }
+        m_count++;
+    }
+}
+
+void ParticlePool::Update(float dt, const glm::vec2& gravity)
+{
+    BR_PROFILE_FUNCTION();
+
+    float* x        = m_streams[PositionX].data();
+    float* y        = m_streams[PositionY].data();
+    float* rotation = m_streams[Rotation].data();
+    float* age      = m_streams[Age].data();
+    float* vx       = m_streams[VelocityX].data();
+    float* vy       = m_streams[VelocityY].data();
+    float* spin     = m_streams[AngularVelocity].data();
+    float* invLife  = m_streams[InvLifetime].data();
+
+    uint32_t i = 0;
+#if defined(BR_PARTICLES_SSE2)
+    const __m128 dtx4 = _mm_set1_ps(dt);
+    const __m128 gx4  = _mm_set1_ps(gravity.x * dt);
+    const __m128 gy4  = _mm_set1_ps(gravity.y * dt);
+    for (; i + 4 <= m_count; i += 4)
+    {
+        __m128 velX = _mm_add_ps(_mm_loadu_ps(vx + i), gx4);
+        __m128 velY = _mm_add_ps(_mm_loadu_ps(vy + i), gy4);
+        _mm_storeu_ps(vx + i, velX);
+        _mm_storeu_ps(vy + i, velY);
+        _mm_storeu_ps(x + i, _mm_add_ps(_mm_loadu_ps(x + i), _mm_mul_ps(velX, dtx4)));
+        _mm_storeu_ps(y + i, _mm_add_ps(_mm_loadu_ps(y + i), _mm_mul_ps(velY, dtx4)));
+        _mm_storeu_ps(rotation + i,
+                      _mm_add_ps(_mm_loadu_ps(rotation + i),
+                                 _mm_mul_ps(_mm_loadu_ps(spin + i), dtx4)));
+        _mm_storeu_ps(
+          age + i,
+          _mm_add_ps(_mm_loadu_ps(age + i), _mm_mul_ps(_mm_loadu_ps(invLife + i), dtx4)));
+    }
+#endif
+    for (; i < m_count; i++)
+    {
+        vx[i] += gravity.x * dt;
+        vy[i] += gravity.y * dt;
+        x[i] += vx[i] * dt;
+        y[i] += vy[i] * dt;
+        rotation[i] += spin[i] * dt;
+        age[i] += invLife[i] * dt;
+    }
+
+    // Swap the dead particles with the last live one. The one moved in is checked in turn.
+    for (i = 0; i < m_count;)
+    {
+        if (age[i] < 1.0f)
+        {
+            i++;
+            continue;
+        }
+
+        m_count--;
+        for (auto& stream : m_streams)
+        {
+            stream[i] = stream[m_count];
+        }
+    }
+}
+}    // namespace Brigerad
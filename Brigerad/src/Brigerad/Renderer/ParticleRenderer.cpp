@@ -0,0 +1,228 @@
+/**
+ * @file   ParticleRenderer.cpp
+ * @author Samuel Martel
+ * @date   2026/10/19
+ *
+ * @brief  Source for the ParticleRenderer module.
+ */
+#include "brpch.h"
+#include "ParticleRenderer.h"
+
+#include "Brigerad/Renderer/RenderCommand.h"
+#include "Brigerad/Renderer/Shader.h"
+
+#include <algorithm>
+
+namespace Brigerad
+{
+struct ParticleRendererData
+{
+    // Compute shader work group size, must match ParticleSimulation.glsl.
+    static constexpr uint32_t groupSize = 256;
+
+    Ref<VertexBuffer> corners;
+    Ref<IndexBuffer>  indices;
+    Ref<Shader>       shader;
+    Ref<Shader>       simulationShader;    // Only when compute shaders are supported.
+
+    // The pools simulated on the CPU all go through these, one buffer per stream.
+    std::vector<Ref<VertexBuffer>> streams;
+    Ref<VertexArray>                vertexArray;
+};
+
+static ParticleRendererData s_data;
+
+static BufferLayout GetStreamLayout(uint32_t stream)
+{
+    static const char* names[ParticlePool::s_renderedStreams] = {
+      "i_PositionX", "i_PositionY", "i_Rotation", "i_Age"};
+    return BufferLayout({{ShaderDataType::Float, names[stream]}}, true);
+}
+
+void ParticleRenderer::Init()
+{
+    BR_PROFILE_FUNCTION();
+
+    // The corners of the quad every particle is an instance of.
+    float corners[] = {-0.5f, -0.5f, 0.5f, -0.5f, 0.5f, 0.5f, -0.5f, 0.5f};
+    s_data.corners  = VertexBuffer::Create(corners, sizeof(corners));
+    s_data.corners->SetLayout({{ShaderDataType::Float2, "a_Corner"}});
+
+    uint32_t indices[] = {0, 1, 2, 2, 3, 0};
+    s_data.indices     = IndexBuffer::Create(indices, 6);
+
+    for (uint32_t i = 0; i < ParticlePool::s_renderedStreams; i++)
+    {
+        auto stream = VertexBuffer::Create(s_maxParticlesPerDraw * uint32_t(sizeof(float)));
+        stream->SetLayout(GetStreamLayout(i));
+        s_data.streams.push_back(stream);
+    }
+    s_data.vertexArray = CreateVertexArray(s_data.streams);
+
+    s_data.shader = Shader::Create("assets/shaders/Particle.glsl");
+    if (SupportsGpuSimulation())
+    {
+        s_data.simulationShader = Shader::Create("assets/shaders/ParticleSimulation.glsl");
+    }
+}
+
+void ParticleRenderer::Shutdown()
+{
+    BR_PROFILE_FUNCTION();
+    s_data = ParticleRendererData();
+}
+
+bool ParticleRenderer::SupportsGpuSimulation()
+{
+    return RenderCommand::SupportsCompute();
+}
+
+void ParticleRenderer::BeginScene(const glm::mat4& viewProjection)
+{
+    s_data.shader->Bind();
+    s_data.shader->SetMat4("u_ViewProjection", viewProjection);
+}
+
+void ParticleRenderer::Draw(const ParticlePool& pool, const ParticleProps& props, float depth)
+{
+    BR_PROFILE_FUNCTION();
+
+    if (pool.GetCount() == 0)
+    {
+        return;
+    }
+
+    SetUniforms(props, depth);
+    s_data.vertexArray->Bind();
+
+    // The live particles are packed at the front of the streams, upload them as they are.
+    for (uint32_t first = 0; first < pool.GetCount(); first += s_maxParticlesPerDraw)
+    {
+        uint32_t count = std::min(pool.GetCount() - first, s_maxParticlesPerDraw);
+        for (uint32_t i = 0; i < ParticlePool::s_renderedStreams; i++)
+        {
+            s_data.streams[i]->SetData(pool.GetStream(ParticlePool::Stream(i)) + first,
+                                       count * uint32_t(sizeof(float)));
+        }
+        RenderCommand::DrawIndexedInstanced(s_data.vertexArray, 6, count);
+    }
+}
+
+void ParticleRenderer::Draw(const GpuParticlePool& pool, const ParticleProps& props, float depth)
+{
+    BR_PROFILE_FUNCTION();
+
+    SetUniforms(props, depth);
+    pool.m_vertexArray->Bind();
+    RenderCommand::DrawIndexedInstanced(pool.m_vertexArray, 6, pool.m_capacity);
+}
+
+void ParticleRenderer::Simulate(GpuParticlePool& pool, float dt, const glm::vec2& gravity)
+{
+    BR_PROFILE_FUNCTION();
+    BR_CORE_ASSERT(s_data.simulationShader, "Compute shaders are not supported!");
+
+    s_data.simulationShader->Bind();
+    s_data.simulationShader->SetFloat("u_DeltaTime", dt);
+    s_data.simulationShader->SetFloat2("u_Gravity", gravity);
+    s_data.simulationShader->SetInt("u_Count", int(pool.m_capacity));
+    pool.m_states->BindStorage(0);
+    pool.m_motions->BindStorage(1);
+
+    RenderCommand::DispatchCompute((pool.m_capacity + s_data.groupSize - 1) / s_data.groupSize);
+
+    // Back to drawing.
+    s_data.shader->Bind();
+}
+
+Ref<VertexArray> ParticleRenderer::CreateVertexArray(
+  const std::vector<Ref<VertexBuffer>>& instances)
+{
+    Ref<VertexArray> vertexArray = VertexArray::Create();
+    vertexArray->AddVertexBuffer(s_data.corners);
+    for (const auto& instance : instances)
+    {
+        vertexArray->AddVertexBuffer(instance);
+    }
+    vertexArray->SetIndexBuffer(s_data.indices);
+    return vertexArray;
+}
+
+void ParticleRenderer::SetUniforms(const ParticleProps& props, float depth)
+{
+    s_data.shader->SetFloat4("u_ColorBegin", props.colorBegin);
+    s_data.shader->SetFloat4("u_ColorEnd", props.colorEnd);
+    s_data.shader->SetFloat2("u_Size", {props.sizeBegin, props.sizeEnd});
+    s_data.shader->SetFloat("u_Depth", depth);
+}
+
+GpuParticlePool::GpuParticlePool(uint32_t capacity) : m_capacity(capacity)
+{
+    BR_PROFILE_FUNCTION();
+    BR_CORE_ASSERT(ParticleRenderer::SupportsGpuSimulation(), "Compute shaders are not supported!");
+
+    uint32_t size = capacity * uint32_t(sizeof(glm::vec4));
+    m_states      = VertexBuffer::Create(size);
+    m_motions     = VertexBuffer::Create(size);
+
+    // Every slot starts dead.
+    std::vector<glm::vec4> dead(capacity, glm::vec4 {0.0f, 0.0f, 0.0f, 1.0f});
+    m_states->SetData(dead.data(), size);
+    m_motions->SetData(dead.data(), size);
+
+    // Same attributes as the streams of the CPU pools, interleaved.
+    m_states->SetLayout(BufferLayout({{ShaderDataType::Float, "i_PositionX"},
+                                      {ShaderDataType::Float, "i_PositionY"},
+                                      {ShaderDataType::Float, "i_Rotation"},
+                                      {ShaderDataType::Float, "i_Age"}},
+                                     true));
+    m_vertexArray = ParticleRenderer::CreateVertexArray({m_states});
+}
+
+void GpuParticlePool::Emit(uint32_t count, const glm::vec2& origin, const ParticleProps& props)
+{
+    BR_PROFILE_FUNCTION();
+
+    count = std::min(count, m_capacity);
+    if (count == 0)
+    {
+        return;
+    }
+
+    m_stagedStates.resize(count);
+    m_stagedMotions.resize(count);
+    for (uint32_t i = 0; i < count; i++)
+    {
+        float particle[ParticlePool::StreamCount];
+        ParticlePool::Spawn(origin, props, m_seed, particle);
+
+        m_stagedStates[i]  = {particle[ParticlePool::PositionX],
+                             particle[ParticlePool::PositionY],
+                             particle[ParticlePool::Rotation],
+                             particle[ParticlePool::Age]};
+        m_stagedMotions[i] = {particle[ParticlePool::VelocityX],
+                              particle[ParticlePool::VelocityY],
+                              particle[ParticlePool::AngularVelocity],
+                              particle[ParticlePool::InvLifetime]};
+    }
+
+    // Overwrite the oldest slots, in two parts when reaching the end of the ring.
+    uint32_t first = std::min(count, m_capacity - m_next);
+    Upload(m_next, first, 0);
+    Upload(0, count - first, first);
+    m_next = (m_next + count) % m_capacity;
+}
+
+void GpuParticlePool::Upload(uint32_t first, uint32_t count, uint32_t staged)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    uint32_t size   = count * uint32_t(sizeof(glm::vec4));
+    uint32_t offset = first * uint32_t(sizeof(glm::vec4));
+    m_states->SetData(&m_stagedStates[staged], size, offset);
+    m_motions->SetData(&m_stagedMotions[staged], size, offset);
+}
+}    // namespace Brigerad
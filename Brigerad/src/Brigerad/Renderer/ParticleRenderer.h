@@ -0,0 +1,85 @@
+/**
+ * @file   ParticleRenderer.h
+ * @author Samuel Martel
+ * @date   2026/10/19
+ *
+ * @brief  Header for the ParticleRenderer module.
+ */
+#pragma once
+
+#include "Brigerad/Core/Core.h"
+#include "Brigerad/Renderer/Buffer.h"
+#include "Brigerad/Renderer/ParticlePool.h"
+#include "Brigerad/Renderer/VertexArray.h"
+
+#include "glm/glm.hpp"
+
+#include <vector>
+
+namespace Brigerad
+{
+/**
+ * Particles simulated by a compute shader, for when the CPU can't keep up.
+ *
+ * The particles live in a ring of GPU buffers: new particles overwrite the oldest slots and dead
+ * particles are left in place, drawn with a size of 0. Only the new particles are uploaded.
+ * Requires ParticleRenderer::SupportsGpuSimulation.
+ */
+class GpuParticlePool
+{
+public:
+    explicit GpuParticlePool(uint32_t capacity = 100000);
+
+    void     Emit(uint32_t count, const glm::vec2& origin, const ParticleProps& props);
+    uint32_t GetCapacity() const { return m_capacity; }
+
+private:
+    void Upload(uint32_t first, uint32_t count, uint32_t staged);
+
+private:
+    uint32_t m_capacity = 0;
+    uint32_t m_next     = 0;    // Slot of the next particle emitted.
+    uint32_t m_seed     = 0x9E3779B9;
+
+    // Position, rotation and age of each particle, also the instance data of the draw.
+    Ref<VertexBuffer> m_states;
+    // Velocity, angular velocity and 1 / lifetime of each particle.
+    Ref<VertexBuffer>      m_motions;
+    Ref<VertexArray>       m_vertexArray;
+    std::vector<glm::vec4> m_stagedStates;
+    std::vector<glm::vec4> m_stagedMotions;
+
+    friend class ParticleRenderer;
+};
+
+/**
+ * Draws the particles of an emitter with a single instanced draw call.
+ *
+ * Each particle is an instance of a quad. The vertex shader places, rotates and scales it and
+ * picks its color from its age and the ParticleProps of the emitter.
+ */
+class ParticleRenderer
+{
+public:
+    // Particles uploaded per draw call, bigger CPU pools take a few.
+    static constexpr uint32_t s_maxParticlesPerDraw = 100000;
+
+    static void Init();
+    static void Shutdown();
+
+    static bool SupportsGpuSimulation();
+
+    static void BeginScene(const glm::mat4& viewProjection);
+    static void Draw(const ParticlePool& pool, const ParticleProps& props, float depth = 0.0f);
+    static void Draw(const GpuParticlePool& pool, const ParticleProps& props, float depth = 0.0f);
+
+    /** Move the particles of a GPU pool forward in time. */
+    static void Simulate(GpuParticlePool& pool, float dt, const glm::vec2& gravity);
+
+private:
+    static Ref<VertexArray> CreateVertexArray(const std::vector<Ref<VertexBuffer>>& instances);
+    static void             SetUniforms(const ParticleProps& props, float depth);
+
+    friend class GpuParticlePool;
+};
+}    // namespace Brigerad
@@ -25,6 +25,21 @@ class RenderCommand
         s_rendererAPI->DrawIndexed(vertexArray, count);
     }
 
+    inline static void DrawIndexedInstanced(const Ref<VertexArray>& vertexArray,
+                                            uint32_t                indexCount,
+                                            uint32_t                instanceCount)
+    {
+        BR_PROFILE_FUNCTION();
+        s_rendererAPI->DrawIndexedInstanced(vertexArray, indexCount, instanceCount);
+    }
+
+    inline static bool SupportsCompute() { return s_rendererAPI->SupportsCompute(); }
+
+    inline static void DispatchCompute(uint32_t groupCountX)
+    {
+        s_rendererAPI->DispatchCompute(groupCountX);
+    }
+
     inline static void Init() { s_rendererAPI->Init(); }
 
     private:
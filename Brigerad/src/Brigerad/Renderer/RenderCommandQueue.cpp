@@ -0,0 +1,65 @@
+/**
+ * @file   RenderCommandQueue.cpp
+ * @author Samuel Martel
+ * @date   2026/10/19
+ *
+ * @brief  Source for the RenderCommandQueue module.
+ */
+#include "brpch.h"
+#include "RenderCommandQueue.h"
+
+namespace Brigerad
+{
+void* RenderCommandQueue::AllocateCommand(CommandFn fn, size_t size, size_t alignment)
+{
+    void* storage = Allocate(size, alignment);
+    m_commands.push_back({fn, storage});
+    return storage;
+}
+
+void* RenderCommandQueue::AllocateData(size_t size)
+{
+    return Allocate(size, alignof(std::max_align_t));
+}
+
+void RenderCommandQueue::Execute()
+{
+    BR_PROFILE_FUNCTION();
+
+    for (const Command& command : m_commands)
+    {
+        command.fn(command.storage);
+    }
+    m_commands.clear();
+
+    for (Block& block : m_blocks)
+    {
+        block.used = 0;
+    }
+    m_currentBlock = 0;
+}
+
+void* RenderCommandQueue::Allocate(size_t size, size_t alignment)
+{
+    // Fill the blocks in order, the ones that are too full for this allocation are done for this
+    // execution.
+    while (m_currentBlock < m_blocks.size())
+    {
+        Block&    block  = m_blocks[m_currentBlock];
+        uintptr_t base   = reinterpret_cast<uintptr_t>(block.data.get());
+        uintptr_t offset = ((base + block.used + alignment - 1) & ~(uintptr_t)(alignment - 1)) - base;
+        if (offset + size <= block.size)
+        {
+            block.used = offset + size;
+            return block.data.get() + offset;
+        }
+        m_currentBlock++;
+    }
+
+    Block block;
+    block.size = std::max(s_blockSize, size + alignment);
+    block.data = std::make_unique<uint8_t[]>(block.size);
+    m_blocks.push_back(std::move(block));
+    return Allocate(size, alignment);
+}
+}    // namespace Brigerad
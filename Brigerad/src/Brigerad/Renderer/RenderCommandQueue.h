@@ -0,0 +1,79 @@
+/**
+ * @file   RenderCommandQueue.h
+ * @author Samuel Martel
+ * @date   2026/10/19
+ *
+ * @brief  Header for the RenderCommandQueue module.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Brigerad
+{
+/**
+ * List of recorded commands, executed later in the order they were recorded.
+ *
+ * The commands and the data they need are stored in blocks that are reused from one execution to
+ * the next, so recording a frame doesn't allocate once the blocks are big enough.
+ */
+class RenderCommandQueue
+{
+public:
+    using CommandFn = void (*)(void*);
+
+    RenderCommandQueue() = default;
+    RenderCommandQueue(const RenderCommandQueue&) = delete;
+    RenderCommandQueue& operator=(const RenderCommandQueue&) = delete;
+
+    /**
+     * Record a command: fn is called with the returned storage, in which the caller must construct
+     * the object fn expects.
+     */
+    void* AllocateCommand(CommandFn fn, size_t size, size_t alignment);
+
+    /** Storage for data needed by a command, valid until the queue is executed. */
+    void* AllocateData(size_t size);
+
+    /** Run every command in order, then empty the queue. */
+    void Execute();
+
+    size_t GetCommandCount() const { return m_commands.size(); }
+    bool   IsEmpty() const { return m_commands.empty(); }
+
+    /** Command function that calls a functor of type F, then destroys it. */
+    template<typename F>
+    static void Invoke(void* storage)
+    {
+        F* fn = static_cast<F*>(storage);
+        (*fn)();
+        fn->~F();
+    }
+
+private:
+    void* Allocate(size_t size, size_t alignment);
+
+private:
+    static constexpr size_t s_blockSize = 1024 * 1024;
+
+    struct Block
+    {
+        std::unique_ptr<uint8_t[]> data;
+        size_t                     size = 0;
+        size_t                     used = 0;
+    };
+
+    struct Command
+    {
+        CommandFn fn;
+        void*     storage;
+    };
+
+    std::vector<Block>   m_blocks;
+    size_t               m_currentBlock = 0;
+    std::vector<Command> m_commands;
+};
+}    // namespace Brigerad
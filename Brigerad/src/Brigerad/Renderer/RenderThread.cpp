@@ -0,0 +1,206 @@
+/**
+ * @file   RenderThread.cpp
+ * @author Samuel Martel
+ * @date   2026/10/19
+ *
+ * @brief  Source for the RenderThread module.
+ */
+#include "brpch.h"
+#include "RenderThread.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+namespace Brigerad
+{
+using Clock = std::chrono::high_resolution_clock;
+
+struct RenderThreadData
+{
+    GraphicsContext* context = nullptr;
+    std::thread      thread;
+    bool             isRunning = false;
+
+    // The main thread records in queues[recording], the render thread executes submitted.
+    RenderCommandQueue  queues[2];
+    size_t              recording = 0;
+    RenderCommandQueue* submitted = nullptr;
+    bool                endsFrame = false;
+    bool                stopping  = false;
+
+    std::mutex              mutex;
+    std::condition_variable cv;
+
+    Clock::time_point   frameStart;
+    float               waitMs        = 0.0f;
+    Clock::duration     renderElapsed = {};
+    RenderThread::Stats stats;
+};
+
+static RenderThreadData  s_data;
+static thread_local bool s_isRenderThread = false;
+
+static float ToMs(Clock::duration d)
+{
+    return std::chrono::duration<float, std::milli>(d).count();
+}
+
+static void ThreadMain()
+{
+    s_isRenderThread = true;
+    s_data.context->MakeCurrent();
+
+    std::unique_lock lock(s_data.mutex);
+    while (true)
+    {
+        s_data.cv.wait(lock, [] { return s_data.submitted != nullptr || s_data.stopping; });
+        if (s_data.submitted == nullptr)
+        {
+            break;
+        }
+
+        RenderCommandQueue* queue = s_data.submitted;
+        lock.unlock();
+        auto start = Clock::now();
+        queue->Execute();
+        auto elapsed = Clock::now() - start;
+        lock.lock();
+
+        // A frame can be split by sync points, add up all of its parts.
+        s_data.renderElapsed += elapsed;
+        if (s_data.endsFrame)
+        {
+            s_data.stats.renderThreadMs = ToMs(s_data.renderElapsed);
+            s_data.renderElapsed        = {};
+        }
+        s_data.submitted = nullptr;
+        s_data.cv.notify_all();
+    }
+
+    s_data.context->ReleaseCurrent();
+}
+
+// Hand the queue being recorded to the render thread and start recording in the other one.
+static void Kick(bool endsFrame)
+{
+    std::unique_lock lock(s_data.mutex);
+
+    auto start = Clock::now();
+    s_data.cv.wait(lock, [] { return s_data.submitted == nullptr; });
+    s_data.waitMs += ToMs(Clock::now() - start);
+
+    s_data.submitted = &s_data.queues[s_data.recording];
+    s_data.endsFrame = endsFrame;
+    s_data.recording ^= 1;
+    s_data.cv.notify_all();
+}
+
+static void WaitUntilIdle()
+{
+    std::unique_lock lock(s_data.mutex);
+
+    auto start = Clock::now();
+    s_data.cv.wait(lock, [] { return s_data.submitted == nullptr; });
+    s_data.waitMs += ToMs(Clock::now() - start);
+}
+
+void RenderThread::Init(GraphicsContext& context)
+{
+    BR_PROFILE_FUNCTION();
+    BR_CORE_ASSERT(!s_data.isRunning, "Render thread already running!");
+
+    s_data.context  = &context;
+    s_data.stopping = false;
+    context.ReleaseCurrent();
+    s_data.thread     = std::thread(ThreadMain);
+    s_data.isRunning  = true;
+    s_data.frameStart = Clock::now();
+
+    BR_CORE_INFO("Rendering on a separate thread.");
+}
+
+void RenderThread::Shutdown()
+{
+    BR_PROFILE_FUNCTION();
+
+    if (!s_data.isRunning)
+    {
+        return;
+    }
+
+    Flush();
+    {
+        std::lock_guard lock(s_data.mutex);
+        s_data.stopping = true;
+    }
+    s_data.cv.notify_all();
+    s_data.thread.join();
+
+    s_data.isRunning = false;
+    s_data.context->MakeCurrent();
+}
+
+bool RenderThread::IsRunning()
+{
+    return s_data.isRunning;
+}
+
+bool RenderThread::IsRenderThread()
+{
+    return s_isRenderThread;
+}
+
+const void* RenderThread::CopyData(const void* data, size_t size)
+{
+    if (!IsRunning() || IsRenderThread())
+    {
+        return data;
+    }
+
+    void* copy = GetQueue().AllocateData(size);
+    memcpy(copy, data, size);
+    return copy;
+}
+
+void RenderThread::BeginFrame()
+{
+    s_data.frameStart = Clock::now();
+    s_data.waitMs     = 0.0f;
+}
+
+void RenderThread::EndFrame()
+{
+    BR_PROFILE_FUNCTION();
+
+    if (IsRunning())
+    {
+        Kick(true);
+    }
+
+    std::lock_guard lock(s_data.mutex);
+    s_data.stats.waitMs       = s_data.waitMs;
+    s_data.stats.mainThreadMs = ToMs(Clock::now() - s_data.frameStart) - s_data.waitMs;
+}
+
+RenderThread::Stats RenderThread::GetStats()
+{
+    std::lock_guard lock(s_data.mutex);
+    return s_data.stats;
+}
+
+RenderCommandQueue& RenderThread::GetQueue()
+{
+    return s_data.queues[s_data.recording];
+}
+
+void RenderThread::Flush()
+{
+    BR_PROFILE_FUNCTION();
+
+    Kick(false);
+    WaitUntilIdle();
+}
+}    // namespace Brigerad
@@ -0,0 +1,100 @@
+/**
+ * @file   RenderThread.h
+ * @author Samuel Martel
+ * @date   2026/10/19
+ *
+ * @brief  Header for the RenderThread module.
+ */
+#pragma once
+
+#include "Brigerad/Renderer/GraphicsContext.h"
+#include "Brigerad/Renderer/RenderCommandQueue.h"
+
+#include <type_traits>
+#include <utility>
+
+namespace Brigerad
+{
+/**
+ * Thread that owns the graphics context and executes the commands recorded by the main thread.
+ *
+ * The main thread records the commands of frame N+1 in one queue while the render thread executes
+ * the commands of frame N from the other one. Everything that touches the context goes through
+ * Submit, or through Execute when the main thread needs the result right away, like the ID of a
+ * new texture.
+ *
+ * When the render thread isn't running, both simply run the command on the spot.
+ */
+class RenderThread
+{
+public:
+    struct Stats
+    {
+        float mainThreadMs   = 0.0f;    // Recording the last frame.
+        float renderThreadMs = 0.0f;    // Executing the last frame, including the buffer swap.
+        float waitMs         = 0.0f;    // Main thread waiting for the render thread last frame.
+    };
+
+    /** Move the context, current on the calling thread, to a new render thread. */
+    static void Init(GraphicsContext& context);
+    /** Execute what's left, stop the render thread and give the context back to this thread. */
+    static void Shutdown();
+
+    static bool IsRunning();
+    static bool IsRenderThread();
+
+    /** Record a command that runs on the render thread, in order with the other commands. */
+    template<typename Fn>
+    static void Submit(Fn&& fn)
+    {
+        if (!IsRunning() || IsRenderThread())
+        {
+            fn();
+            return;
+        }
+
+        using F = std::decay_t<Fn>;
+        void* storage =
+          GetQueue().AllocateCommand(&RenderCommandQueue::Invoke<F>, sizeof(F), alignof(F));
+        new (storage) F(std::forward<Fn>(fn));
+    }
+
+    /**
+     * Sync point: run fn on the render thread after everything recorded so far and wait for it.
+     * fn can therefore capture locals by reference. Meant for the creation of resources, not for
+     * every frame.
+     */
+    template<typename Fn>
+    static void Execute(Fn&& fn)
+    {
+        if (!IsRunning() || IsRenderThread())
+        {
+            fn();
+            return;
+        }
+
+        Submit(std::forward<Fn>(fn));
+        Flush();
+    }
+
+    /**
+     * Copy data that a command will read when it runs, e.g. vertices to upload.
+     * The copy lives until the command has run. Without render thread, data is returned as is.
+     */
+    static const void* CopyData(const void* data, size_t size);
+
+    /** Start of the work of the main thread for a frame. */
+    static void BeginFrame();
+    /**
+     * Hand the commands of the frame to the render thread, waiting first for it to be done with the
+     * previous frame.
+     */
+    static void EndFrame();
+
+    static Stats GetStats();
+
+private:
+    static RenderCommandQueue& GetQueue();
+    static void                Flush();
+};
+}    // namespace Brigerad
@@ -10,6 +10,7 @@
 
 #include "RenderCommand.h"
 #include "Renderer2D.h"
+#include "ParticleRenderer.h"
 #include "Platform/OpenGL/OpenGLShader.h"
 
 namespace Brigerad
@@ -21,11 +22,20 @@ void Renderer::Init()
     BR_PROFILE_FUNCTION();
     RenderCommand::Init();
     Renderer2D::Init();
+    ParticleRenderer::Init();
+}
+
+void Renderer::Shutdown()
+{
+    BR_PROFILE_FUNCTION();
+    // Renderer2D is shut down by the layers that use it.
+    ParticleRenderer::Shutdown();
 }
 
 void Renderer::OnWindowResize(uint32_t width, uint32_t height)
 {
     RenderCommand::SetViewport(0, 0, width, height);
+    Renderer2D::SetViewportSize(width, height);
 }
 
 void Renderer::BeginScene(OrthographicCamera& camera)
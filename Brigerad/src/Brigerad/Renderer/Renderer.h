@@ -12,6 +12,7 @@ class Renderer
 {
     public:
     static void Init();
+    static void Shutdown();
     static void OnWindowResize(uint32_t width, uint32_t height);
 
     static void BeginScene(OrthographicCamera& camera);
@@ -5,24 +5,14 @@
 #include "Brigerad/Renderer/Shader.h"
 #include "Brigerad/Renderer/RenderCommand.h"
 #include "Brigerad/Renderer/FontAtlas.h"
+#include "Brigerad/Renderer/StaticBatch.h"
 
 #include "glm/gtc/matrix_transform.hpp"
 
+#include <chrono>
+
 namespace Brigerad
 {
-/**
- * @brief   Data structure that contains all the information needed by a quad.
- */
-struct QuadVertex
-{
-    glm::vec3 position;        // Screen coordinates of the quad.
-    glm::vec4 color;           // Color of the quad.
-    glm::vec2 texCoord;        // Coordinates to sample the texture from.
-    glm::vec2 tilingFactor;    // Scaling applied to the sampled texture.
-    float     texIndex;        // Index of the texture to use.
-    float     isText;          // Is the quad text data.
-};
-
 /**
  * @brief   Runtime data structure that contains all the things needed by the
  *          renderer at runtime.
@@ -43,6 +33,9 @@ struct Renderer2DData
 
     long long frameCount = 0;    // Frames rendered since the start of the application.
 
+    std::chrono::steady_clock::time_point startTime;    // Origin of the animation time.
+    float animationTime = 0.0f;    // As of the last BeginScene, see Renderer2D::GetAnimationTime.
+
     // Number of quads queued to be drawn in this frame.
     uint32_t quadIndexCount = 0;
     // Origin of the buffer of queue of quads.
@@ -58,6 +51,26 @@ struct Renderer2DData
 
     glm::vec4 quadVertexPosition[4] = {glm::vec4 {0.0f}};
 
+    // Lines and circles are batched apart, with their own shaders, but share the quad indices.
+    static const uint32_t maxLines   = maxQuads;    // Max segments per draw call.
+    static const uint32_t maxCircles = 10000;
+
+    Ref<VertexArray>  lineVertexArray;
+    Ref<VertexBuffer> lineVertexBuffer;
+    Ref<Shader>       lineShader;
+    uint32_t          lineIndexCount       = 0;
+    LineVertex*       lineVertexBufferBase = nullptr;
+    LineVertex*       lineVertexBufferPtr  = nullptr;
+
+    Ref<VertexArray>  circleVertexArray;
+    Ref<VertexBuffer> circleVertexBuffer;
+    Ref<Shader>       circleShader;
+    uint32_t          circleIndexCount       = 0;
+    CircleVertex*     circleVertexBufferBase = nullptr;
+    CircleVertex*     circleVertexBufferPtr  = nullptr;
+
+    glm::vec2 viewportSize = {1280.0f, 720.0f};    // In pixels.
+
     Renderer2D::Statistics stats;
 };
 
@@ -80,12 +93,7 @@ void Renderer2D::Init()
     s_data.vertexBuffer = VertexBuffer::Create(s_data.maxVertices * sizeof(QuadVertex));
 
     // Set up the layout of the shader.
-    s_data.vertexBuffer->SetLayout({{ShaderDataType::Float3, "a_position"},
-                                    {ShaderDataType::Float4, "a_color"},
-                                    {ShaderDataType::Float2, "a_TexCoord"},
-                                    {ShaderDataType::Float2, "a_TilingFactor"},
-                                    {ShaderDataType::Float, "a_TexIndex"},
-                                    {ShaderDataType::Float, "a_IsText"}});
+    s_data.vertexBuffer->SetLayout(QuadVertex::GetLayout());
 
     s_data.vertexArray->AddVertexBuffer(s_data.vertexBuffer);
 
@@ -118,6 +126,22 @@ void Renderer2D::Init()
     Ref<IndexBuffer> quadIB = IndexBuffer::Create(quadIndices, s_data.maxIndices);
     // Bind that index buffer to our vertex array.
     s_data.vertexArray->SetIndexBuffer(quadIB);
+
+    // Every segment of a line is a quad.
+    s_data.lineVertexArray  = VertexArray::Create();
+    s_data.lineVertexBuffer = VertexBuffer::Create(s_data.maxLines * 4 * sizeof(LineVertex));
+    s_data.lineVertexBuffer->SetLayout(LineVertex::GetLayout());
+    s_data.lineVertexArray->AddVertexBuffer(s_data.lineVertexBuffer);
+    s_data.lineVertexArray->SetIndexBuffer(quadIB);
+    s_data.lineVertexBufferBase = new LineVertex[s_data.maxLines * 4];
+
+    // And so is every circle.
+    s_data.circleVertexArray  = VertexArray::Create();
+    s_data.circleVertexBuffer = VertexBuffer::Create(s_data.maxCircles * 4 * sizeof(CircleVertex));
+    s_data.circleVertexBuffer->SetLayout(CircleVertex::GetLayout());
+    s_data.circleVertexArray->AddVertexBuffer(s_data.circleVertexBuffer);
+    s_data.circleVertexArray->SetIndexBuffer(quadIB);
+    s_data.circleVertexBufferBase = new CircleVertex[s_data.maxCircles * 4];
     // Free up the memory.
     delete[] quadIndices;
 
@@ -126,6 +150,9 @@ void Renderer2D::Init()
     uint32_t whiteTextureData = 0xFFFFFFFF;
     s_data.whiteTexture->SetData(&whiteTextureData, sizeof(whiteTextureData));
 
+    s_data.lineShader   = Shader::Create("assets/shaders/Line.glsl");
+    s_data.circleShader = Shader::Create("assets/shaders/Circle.glsl");
+
     // Load, compile and link the shader for 2D quads.
     s_data.textureShader = Shader::Create("assets/shaders/Texture.glsl");
     s_data.textureShader->Bind();
@@ -151,6 +178,8 @@ void Renderer2D::Init()
     // Load default font.
     s_data.font            = FontAtlas::Create("c:/windows/fonts/times.ttf");
     s_data.textureSlots[1] = s_data.font->GetFontMap();
+
+    s_data.startTime = std::chrono::steady_clock::now();
 }
 
 /**
@@ -161,31 +190,69 @@ void Renderer2D::Shutdown()
 {
     BR_PROFILE_FUNCTION();
     delete[] s_data.quadVertexBufferBase;
+    delete[] s_data.lineVertexBufferBase;
+    delete[] s_data.circleVertexBufferBase;
 }
 
 /**
- * @brief Set everything up in the 2D renderer to begin accepting new draw
- *        calls for this frame.
- *
- * @param camera An orthographic representation of the scene that is viewable
- *               by the user.
+ * @brief   Upload the view-projection matrix of the camera to every shader of the renderer,
+ *          leaving the quad shader bound.
  */
-void Renderer2D::BeginScene(const OrthographicCamera& camera)
+static void SetViewProjection(const glm::mat4& viewProj)
 {
-    BR_PROFILE_FUNCTION();
+    s_data.lineShader->Bind();
+    s_data.lineShader->SetMat4("u_ViewProjection", viewProj);
+    s_data.lineShader->SetFloat2("u_ViewportSize", s_data.viewportSize);
+
+    s_data.circleShader->Bind();
+    s_data.circleShader->SetMat4("u_ViewProjection", viewProj);
+
+    // In double until wrapped, float seconds lose the precision of a frame after a few hours.
+    double seconds =
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - s_data.startTime).count();
+    s_data.animationTime = float(std::fmod(seconds, double(Renderer2D::s_animationPeriod)));
 
-    // Upload the view-projection matrix of the camera into the vertex shader.
     s_data.textureShader->Bind();
-    s_data.textureShader->SetMat4("u_ViewProjection", camera.GetViewProjectionMatrix());
+    s_data.textureShader->SetMat4("u_ViewProjection", viewProj);
+    s_data.textureShader->SetFloat("u_Time", s_data.animationTime);
+    s_data.textureShader->SetFloat("u_TimePeriod", Renderer2D::s_animationPeriod);
+}
 
-    // Reset the quad buffer.
+/**
+ * @brief   Empty the queues of quads, lines and circles.
+ */
+static void ResetBatches()
+{
     s_data.quadIndexCount      = 0;
     s_data.quadVertexBufferPtr = s_data.quadVertexBufferBase;
 
+    s_data.lineIndexCount      = 0;
+    s_data.lineVertexBufferPtr = s_data.lineVertexBufferBase;
+
+    s_data.circleIndexCount      = 0;
+    s_data.circleVertexBufferPtr = s_data.circleVertexBufferBase;
+
     // Reset the texture buffer.
     // We set it to 2 instead of 0 because slot 0 is reserved to the 1x1 white texture
     // and slot 1 is reserved to the font map texture.
     s_data.textureSlotIndex = 2;
+}
+
+/**
+ * @brief Set everything up in the 2D renderer to begin accepting new draw
+ *        calls for this frame.
+ *
+ * @param camera An orthographic representation of the scene that is viewable
+ *               by the user.
+ */
+void Renderer2D::BeginScene(const OrthographicCamera& camera)
+{
+    BR_PROFILE_FUNCTION();
+
+    // Upload the view-projection matrix of the camera into the vertex shaders.
+    SetViewProjection(camera.GetViewProjectionMatrix());
+
+    ResetBatches();
 
     // Increment the frame rendered count.
     s_data.frameCount++;
@@ -197,18 +264,10 @@ void Renderer2D::BeginScene(const Camera& camera, const glm::mat4& transform)
 
     glm::mat4 viewProj = camera.GetProjection() * glm::inverse(transform);
 
-    // Upload the view-projection matrix of the camera into the vertex shader.
-    s_data.textureShader->Bind();
-    s_data.textureShader->SetMat4("u_ViewProjection", viewProj);
-
-    // Reset the quad buffer.
-    s_data.quadIndexCount      = 0;
-    s_data.quadVertexBufferPtr = s_data.quadVertexBufferBase;
+    // Upload the view-projection matrix of the camera into the vertex shaders.
+    SetViewProjection(viewProj);
 
-    // Reset the texture buffer.
-    // We set it to 2 instead of 0 because slot 0 is reserved to the 1x1 white texture
-    // and slot 1 is reserved to the font map texture.
-    s_data.textureSlotIndex = 2;
+    ResetBatches();
 
     // Increment the frame rendered count.
     s_data.frameCount++;
@@ -217,8 +276,8 @@ void Renderer2D::BeginScene(const Camera& camera, const glm::mat4& transform)
 
 /**
  * @brief   End a scene.
- *          Calling this method makes the renderer draw the entire quad queue
- *          that was filled since the last call to Renderer2D::BeginScene.
+ *          Calling this method makes the renderer draw the entire queues of quads, lines and
+ *          circles that were filled since the last call to Renderer2D::BeginScene.
  */
 void Renderer2D::EndScene()
 {
@@ -230,41 +289,73 @@ void Renderer2D::EndScene()
     // Upload the queued quads data into the vertex buffer.
     s_data.vertexBuffer->SetData(s_data.quadVertexBufferBase, dataSize);
 
-    // Draw all queued quads in a single call.
+    if (s_data.lineIndexCount != 0)
+    {
+        dataSize = (uint32_t)((uint8_t*)s_data.lineVertexBufferPtr -
+                              (uint8_t*)s_data.lineVertexBufferBase);
+        s_data.lineVertexBuffer->SetData(s_data.lineVertexBufferBase, dataSize);
+    }
+
+    if (s_data.circleIndexCount != 0)
+    {
+        dataSize = (uint32_t)((uint8_t*)s_data.circleVertexBufferPtr -
+                              (uint8_t*)s_data.circleVertexBufferBase);
+        s_data.circleVertexBuffer->SetData(s_data.circleVertexBufferBase, dataSize);
+    }
+
+    // Draw all queued quads, lines and circles, one call each.
     Flush();
 }
 
 
 /**
- * @brief Bind all queued textures and render the queue.
+ * @brief Bind all queued textures and render the queues.
+ *        The lines and circles are drawn over the quads.
  */
 void Renderer2D::Flush()
 {
     BR_PROFILE_FUNCTION();
 
-    s_data.stats.drawCalls++;
+    if (s_data.quadIndexCount != 0)
+    {
+        s_data.stats.drawCalls++;
+
+        // Bind all active textures.
+        for (uint32_t i = 0; i < s_data.textureSlotIndex; i++)
+        {
+            s_data.textureSlots[i]->Bind(i);
+        }
+        // Draw the entire vertex array.
+        // A static batch might have bound its own vertex array since the last flush.
+        s_data.textureShader->Bind();
+        s_data.vertexArray->Bind();
+        RenderCommand::DrawIndexed(s_data.vertexArray, s_data.quadIndexCount);
+    }
 
-    // Bind all active textures.
-    for (uint32_t i = 0; i < s_data.textureSlotIndex; i++)
+    if (s_data.lineIndexCount != 0)
     {
-        s_data.textureSlots[i]->Bind(i);
+        s_data.stats.drawCalls++;
+        s_data.lineShader->Bind();
+        s_data.lineVertexArray->Bind();
+        RenderCommand::DrawIndexed(s_data.lineVertexArray, s_data.lineIndexCount);
     }
-    // Draw the entire vertex array.
-    RenderCommand::DrawIndexed(s_data.vertexArray, s_data.quadIndexCount);
+
+    if (s_data.circleIndexCount != 0)
+    {
+        s_data.stats.drawCalls++;
+        s_data.circleShader->Bind();
+        s_data.circleVertexArray->Bind();
+        RenderCommand::DrawIndexed(s_data.circleVertexArray, s_data.circleIndexCount);
+    }
+
+    // Static batches are drawn with the quad shader.
+    s_data.textureShader->Bind();
 }
 
 void Renderer2D::FlushAndReset()
 {
     EndScene();
-
-    // Reset the quad buffer.
-    s_data.quadIndexCount      = 0;
-    s_data.quadVertexBufferPtr = s_data.quadVertexBufferBase;
-
-    // Reset the texture buffer.
-    // We set it to 2 instead of 0 because slot 0 is reserved to the 1x1 white texture
-    // and slot 1 is reserved to the font map texture.
-    s_data.textureSlotIndex = 2;
+    ResetBatches();
 }
 
 
@@ -280,6 +371,54 @@ long long Renderer2D::GetFrameCount()
     return s_data.frameCount;
 }
 
+float Renderer2D::GetAnimationTime()
+{
+    return s_data.animationTime;
+}
+
+float Renderer2D::GetAnimationTimeSince(float startTime)
+{
+    // Both are in [0, s_animationPeriod), the clock may have wrapped in between.
+    return std::fmod(s_data.animationTime - startTime + s_animationPeriod, s_animationPeriod);
+}
+
+void Renderer2D::SetViewportSize(uint32_t width, uint32_t height)
+{
+    s_data.viewportSize = {(float)width, (float)height};
+}
+
+/**
+ * @brief   Get the layout of a QuadVertex, as seen by the vertex shader.
+ */
+BufferLayout QuadVertex::GetLayout()
+{
+    return {{ShaderDataType::Float3, "a_position"},
+            {ShaderDataType::Float4, "a_color"},
+            {ShaderDataType::Float2, "a_TexCoord"},
+            {ShaderDataType::Float2, "a_TilingFactor"},
+            {ShaderDataType::Float, "a_TexIndex"},
+            {ShaderDataType::Float, "a_IsText"},
+            {ShaderDataType::Float4, "a_Animation"}};
+}
+
+BufferLayout LineVertex::GetLayout()
+{
+    return {{ShaderDataType::Float3, "a_Start"},
+            {ShaderDataType::Float3, "a_End"},
+            {ShaderDataType::Float4, "a_Color"},
+            {ShaderDataType::Float2, "a_Corner"},
+            {ShaderDataType::Float, "a_Width"}};
+}
+
+BufferLayout CircleVertex::GetLayout()
+{
+    return {{ShaderDataType::Float3, "a_Position"},
+            {ShaderDataType::Float2, "a_Local"},
+            {ShaderDataType::Float4, "a_Color"},
+            {ShaderDataType::Float, "a_Thickness"},
+            {ShaderDataType::Float, "a_Fade"}};
+}
+
 /* ------------------------------------------------------------------------- */
 /* Primitives -------------------------------------------------------------- */
 /* ------------------------------------------------------------------------- */
@@ -427,6 +566,7 @@ void Renderer2D::DrawQuad(const glm::mat4& transform, const glm::vec4& color)
         s_data.quadVertexBufferPtr->tilingFactor = {1.0f, 1.0f};
         s_data.quadVertexBufferPtr->texIndex     = texIndex;
         s_data.quadVertexBufferPtr->isText       = 0;
+        s_data.quadVertexBufferPtr->animation    = glm::vec4(0.0f);
         s_data.quadVertexBufferPtr++;
     }
 
@@ -483,6 +623,7 @@ void Renderer2D::DrawQuad(const glm::mat4&      transform,
         s_data.quadVertexBufferPtr->tilingFactor = textScale;
         s_data.quadVertexBufferPtr->texIndex     = textureIndex;
         s_data.quadVertexBufferPtr->isText       = 0;
+        s_data.quadVertexBufferPtr->animation    = glm::vec4(0.0f);
         s_data.quadVertexBufferPtr++;
     }
 
@@ -497,6 +638,34 @@ void Renderer2D::DrawQuad(const glm::mat4&         transform,
                           const glm::vec2&         textScale,
                           const glm::vec4&         tint)
 {
+    DrawSubTexturedQuad(transform, texture, textScale, tint, glm::vec4(0.0f));
+}
+
+/**
+ * @brief Queue a quad animated by the vertex shader.
+ *        The shader offsets the texture coordinates of the first frame by
+ *        frame * animation.w, frame being GetAnimationTimeSince(animation.x) / animation.y,
+ *        looped over animation.z frames.
+ *
+ * @param transform The transform of the quad.
+ * @param firstFrame The first frame of the animation.
+ * @param animation The start time, frame duration, frame count and distance between the frames.
+ * @param tint A tint to apply to the texture, (R, G, B, A)
+ */
+void Renderer2D::DrawAnimatedQuad(const glm::mat4&         transform,
+                                  const Ref<SubTexture2D>& firstFrame,
+                                  const glm::vec4&         animation,
+                                  const glm::vec4&         tint)
+{
+    DrawSubTexturedQuad(transform, firstFrame, glm::vec2(1.0f), tint, animation);
+}
+
+void Renderer2D::DrawSubTexturedQuad(const glm::mat4&         transform,
+                                     const Ref<SubTexture2D>& texture,
+                                     const glm::vec2&         textScale,
+                                     const glm::vec4&         tint,
+                                     const glm::vec4&         animation)
+{
 
     constexpr size_t quadVertexCount = 4;
     const glm::vec2* textureCoords   = texture->GetTexCoords();
@@ -538,6 +707,7 @@ void Renderer2D::DrawQuad(const glm::mat4&         transform,
         s_data.quadVertexBufferPtr->tilingFactor = textScale;
         s_data.quadVertexBufferPtr->texIndex     = textureIndex;
         s_data.quadVertexBufferPtr->isText       = 0;
+        s_data.quadVertexBufferPtr->animation    = animation;
         s_data.quadVertexBufferPtr++;
     }
 
@@ -605,6 +775,7 @@ void Renderer2D::DrawRotatedQuad(const glm::vec3& pos,
         s_data.quadVertexBufferPtr->tilingFactor = {1.0f, 1.0f};
         s_data.quadVertexBufferPtr->texIndex     = texIndex;
         s_data.quadVertexBufferPtr->isText       = 0;
+        s_data.quadVertexBufferPtr->animation    = glm::vec4(0.0f);
         s_data.quadVertexBufferPtr++;
     }
 
@@ -697,6 +868,7 @@ void Renderer2D::DrawRotatedQuad(const glm::vec3&      pos,
         s_data.quadVertexBufferPtr->tilingFactor = textScale;
         s_data.quadVertexBufferPtr->texIndex     = textureIndex;
         s_data.quadVertexBufferPtr->isText       = 0;
+        s_data.quadVertexBufferPtr->animation    = glm::vec4(0.0f);
         s_data.quadVertexBufferPtr++;
     }
 
@@ -770,6 +942,7 @@ void Renderer2D::DrawRotatedQuad(const glm::vec3&         pos,
         s_data.quadVertexBufferPtr->tilingFactor = textScale;
         s_data.quadVertexBufferPtr->texIndex     = textureIndex;
         s_data.quadVertexBufferPtr->isText       = 0;
+        s_data.quadVertexBufferPtr->animation    = glm::vec4(0.0f);
         s_data.quadVertexBufferPtr++;
     }
 
@@ -779,6 +952,220 @@ void Renderer2D::DrawRotatedQuad(const glm::vec3&         pos,
     s_data.stats.quadCount++;
 }
 
+// ----- LINES AND SHAPES -----
+
+/**
+ * @brief Queue a segment, without the profiling of the public methods so that long polylines
+ *        stay cheap.
+ */
+static void PushLine(const glm::vec3& p0, const glm::vec3& p1, const glm::vec4& color, float width)
+{
+    constexpr glm::vec2 corners[] = {{0.0f, -1.0f}, {1.0f, -1.0f}, {1.0f, 1.0f}, {0.0f, 1.0f}};
+
+    for (const auto& corner : corners)
+    {
+        s_data.lineVertexBufferPtr->start  = p0;
+        s_data.lineVertexBufferPtr->end    = p1;
+        s_data.lineVertexBufferPtr->color  = color;
+        s_data.lineVertexBufferPtr->corner = corner;
+        s_data.lineVertexBufferPtr->width  = width;
+        s_data.lineVertexBufferPtr++;
+    }
+
+    s_data.lineIndexCount += 6;
+    s_data.stats.lineCount++;
+}
+
+void Renderer2D::DrawLine(const glm::vec2& p0,
+                          const glm::vec2& p1,
+                          const glm::vec4& color,
+                          float            width)
+{
+    DrawLine({p0.x, p0.y, 0.0f}, {p1.x, p1.y, 0.0f}, color, width);
+}
+
+/**
+ * @brief Queue a line segment.
+ *
+ * @param p0 The world coordinates of the start of the line, (X, Y, Z)
+ * @param p1 The world coordinates of the end of the line, (X, Y, Z)
+ * @param color The color of the line, (R, G, B, A)
+ * @param width The width of the line, in pixels.
+ */
+void Renderer2D::DrawLine(const glm::vec3& p0,
+                          const glm::vec3& p1,
+                          const glm::vec4& color,
+                          float            width)
+{
+    BR_PROFILE_FUNCTION();
+
+    // If the line queue is full:
+    if (s_data.lineIndexCount >= Renderer2DData::maxLines * 6)
+    {
+        // Render the queues and start new ones.
+        FlushAndReset();
+    }
+
+    PushLine(p0, p1, color, width);
+}
+
+/**
+ * @brief Queue the segments joining a series of points.
+ *
+ * @param points The world coordinates of the points, (X, Y, Z)
+ * @param count The number of points.
+ * @param color The color of the line, (R, G, B, A)
+ * @param width The width of the line, in pixels.
+ * @param closed Also join the last point to the first one.
+ */
+void Renderer2D::DrawPolyline(const glm::vec3* points,
+                              size_t           count,
+                              const glm::vec4& color,
+                              float            width,
+                              bool             closed)
+{
+    BR_PROFILE_FUNCTION();
+
+    if (count < 2)
+    {
+        return;
+    }
+
+    size_t segments = closed ? count : count - 1;
+    for (size_t i = 0; i < segments; i++)
+    {
+        if (s_data.lineIndexCount >= Renderer2DData::maxLines * 6)
+        {
+            FlushAndReset();
+        }
+
+        PushLine(points[i], points[(i + 1) % count], color, width);
+    }
+}
+
+void Renderer2D::DrawPolyline(const std::vector<glm::vec3>& points,
+                              const glm::vec4&              color,
+                              float                         width,
+                              bool                          closed)
+{
+    DrawPolyline(points.data(), points.size(), color, width, closed);
+}
+
+/**
+ * @brief Queue the outline of a rectangle.
+ *
+ * @param pos The world coordinates of the center of the rectangle, (X, Y, Z)
+ * @param size The size of the rectangle, (X, Y)
+ * @param color The color of the outline, (R, G, B, A)
+ * @param width The width of the outline, in pixels.
+ */
+void Renderer2D::DrawRect(const glm::vec3& pos,
+                          const glm::vec2& size,
+                          const glm::vec4& color,
+                          float            width)
+{
+    glm::vec3 corners[] = {{pos.x - size.x * 0.5f, pos.y - size.y * 0.5f, pos.z},
+                           {pos.x + size.x * 0.5f, pos.y - size.y * 0.5f, pos.z},
+                           {pos.x + size.x * 0.5f, pos.y + size.y * 0.5f, pos.z},
+                           {pos.x - size.x * 0.5f, pos.y + size.y * 0.5f, pos.z}};
+    DrawPolyline(corners, 4, color, width, true);
+}
+
+/**
+ * @brief Queue the outline of the quad that DrawQuad would draw with the same transform.
+ */
+void Renderer2D::DrawRect(const glm::mat4& transform, const glm::vec4& color, float width)
+{
+    glm::vec3 corners[4];
+    for (int i = 0; i < 4; i++)
+    {
+        corners[i] = transform * s_data.quadVertexPosition[i];
+    }
+    DrawPolyline(corners, 4, color, width, true);
+}
+
+/**
+ * @brief Queue a circle.
+ *
+ * @param pos The world coordinates of the center of the circle, (X, Y, Z)
+ * @param radius The radius of the circle.
+ * @param color The color of the circle, (R, G, B, A)
+ * @param thickness 1 to fill the circle, less to only draw a ring of that fraction of the radius.
+ * @param fade The width of the anti-aliased edge, as a fraction of the radius.
+ */
+void Renderer2D::DrawCircle(const glm::vec3& pos,
+                            float            radius,
+                            const glm::vec4& color,
+                            float            thickness,
+                            float            fade)
+{
+    glm::mat4 transform = glm::translate(glm::mat4(1.0f), pos) *
+                          glm::scale(glm::mat4(1.0f), {radius * 2.0f, radius * 2.0f, 1.0f});
+
+    DrawCircle(transform, color, thickness, fade);
+}
+
+void Renderer2D::DrawCircle(const glm::mat4& transform,
+                            const glm::vec4& color,
+                            float            thickness,
+                            float            fade)
+{
+    BR_PROFILE_FUNCTION();
+
+    // If the circle queue is full:
+    if (s_data.circleIndexCount >= Renderer2DData::maxCircles * 6)
+    {
+        // Render the queues and start new ones.
+        FlushAndReset();
+    }
+
+    for (int i = 0; i < 4; i++)
+    {
+        s_data.circleVertexBufferPtr->position  = transform * s_data.quadVertexPosition[i];
+        s_data.circleVertexBufferPtr->local     = glm::vec2(s_data.quadVertexPosition[i]) * 2.0f;
+        s_data.circleVertexBufferPtr->color     = color;
+        s_data.circleVertexBufferPtr->thickness = thickness;
+        s_data.circleVertexBufferPtr->fade      = fade;
+        s_data.circleVertexBufferPtr++;
+    }
+
+    s_data.circleIndexCount += 6;
+    s_data.stats.circleCount++;
+}
+
+// ----- STATIC GEOMETRY -----
+
+/**
+ * @brief Draw the quads baked in a static batch, one draw call per group of textures.
+ *        Must be called between BeginScene and EndScene.
+ *
+ * @param batch The baked batch.
+ */
+void Renderer2D::DrawStaticBatch(const StaticBatch& batch)
+{
+    BR_PROFILE_FUNCTION();
+
+    for (const auto& group : batch.m_groups)
+    {
+        if (group.indexCount == 0)
+        {
+            continue;
+        }
+
+        // Slot 0 is the white texture, like for the dynamic quads.
+        s_data.whiteTexture->Bind(0);
+        for (uint32_t i = 0; i < group.textures.size(); i++)
+        {
+            group.textures[i]->Bind(i + 1);
+        }
+
+        group.vertexArray->Bind();
+        RenderCommand::DrawIndexed(group.vertexArray, group.indexCount);
+
+        s_data.stats.drawCalls++;
+        s_data.stats.quadCount += group.indexCount / 6;
+    }
+}
 
 Renderer2D::Statistics Renderer2D::GetStats()
 {
@@ -1,13 +1,65 @@
 #pragma once
 
+#include "Brigerad/Renderer/Buffer.h"
 #include "Brigerad/Renderer/OrthographicCamera.h"
 #include "Brigerad/Renderer/Camera.h"
 #include "Brigerad/Renderer/Texture.h"
 #include "Brigerad/Renderer/SubTexture2D.h"
 
+#include <vector>
+
 
 namespace Brigerad
 {
+class StaticBatch;
+
+/**
+ * @brief   Data structure that contains all the information needed by a quad.
+ */
+struct QuadVertex
+{
+    glm::vec3 position;        // Screen coordinates of the quad.
+    glm::vec4 color;           // Color of the quad.
+    glm::vec2 texCoord;        // Coordinates to sample the texture from.
+    glm::vec2 tilingFactor;    // Scaling applied to the sampled texture.
+    float     texIndex;        // Index of the texture to use.
+    float     isText;          // Is the quad text data.
+    // Animated by the vertex shader when the frame count is above 1:
+    // (start time, frame duration, frame count, horizontal distance between the frames).
+    glm::vec4 animation;
+
+    static BufferLayout GetLayout();
+};
+
+/**
+ * @brief   A corner of the quad covering a line segment, pushed out to the requested width by the
+ *          vertex shader once the segment is on screen.
+ */
+struct LineVertex
+{
+    glm::vec3 start;     // World coordinates of the segment.
+    glm::vec3 end;       // World coordinates of the segment.
+    glm::vec4 color;     // Color of the line.
+    glm::vec2 corner;    // (0 at the start or 1 at the end, -1 or 1 across the segment).
+    float     width;     // Width of the line, in pixels.
+
+    static BufferLayout GetLayout();
+};
+
+/**
+ * @brief   A corner of the quad holding a circle, cut out by its distance field when shaded.
+ */
+struct CircleVertex
+{
+    glm::vec3 position;     // World coordinates of the corner.
+    glm::vec2 local;        // Same corner, from -1 to 1 around the center of the circle.
+    glm::vec4 color;        // Color of the circle.
+    float     thickness;    // 1 fills the circle, smaller values draw a ring.
+    float     fade;         // Width of the anti-aliased edge, as a fraction of the radius.
+
+    static BufferLayout GetLayout();
+};
+
 class Renderer2D
 {
 public:
@@ -20,6 +72,17 @@ public:
     static void Flush();
 
     static long long GetFrameCount();
+    /**
+     * The clock of the animations done by the vertex shader: seconds since Init as of the last
+     * BeginScene, wrapped every s_animationPeriod seconds to keep the precision of a frame however
+     * long the application runs. Animations in step with the period don't see the wrap.
+     */
+    static float GetAnimationTime();
+    /** Seconds from startTime, a previous GetAnimationTime, to GetAnimationTime. */
+    static float GetAnimationTimeSince(float startTime);
+    static constexpr float s_animationPeriod = 3600.0f;
+    /** Size of the render target in pixels, for the widths of the lines. */
+    static void SetViewportSize(uint32_t width, uint32_t height);
 
     /* ------------------------------------------------------------------------- */
     /* Primitives -------------------------------------------------------------- */
@@ -62,6 +125,15 @@ public:
                          const glm::vec2&         textScale = glm::vec2(1.0f),
                          const glm::vec4&         tint      = glm::vec4(1.0f));
 
+    /**
+     * Quad animated by the vertex shader, starting from firstFrame.
+     * See QuadVertex::animation for the content of animation.
+     */
+    static void DrawAnimatedQuad(const glm::mat4&         transform,
+                                 const Ref<SubTexture2D>& firstFrame,
+                                 const glm::vec4&         animation,
+                                 const glm::vec4&         tint = glm::vec4(1.0f));
+
     // ----- DRAW ROTATED QUAD -----
     static void DrawRotatedQuad(const glm::vec2& pos,
                                 const glm::vec2& size,
@@ -96,20 +168,67 @@ public:
                                 const glm::vec4&         tint      = glm::vec4(1.0f),
                                 float                    rotation  = 0);
 
+    // ----- LINES AND SHAPES -----
+    // The widths are in pixels, they don't change with the zoom.
+    static void DrawLine(const glm::vec2& p0,
+                         const glm::vec2& p1,
+                         const glm::vec4& color,
+                         float            width = 1.0f);
+    static void DrawLine(const glm::vec3& p0,
+                         const glm::vec3& p1,
+                         const glm::vec4& color,
+                         float            width = 1.0f);
+    static void DrawPolyline(const glm::vec3* points,
+                             size_t           count,
+                             const glm::vec4& color,
+                             float            width  = 1.0f,
+                             bool             closed = false);
+    static void DrawPolyline(const std::vector<glm::vec3>& points,
+                             const glm::vec4&              color,
+                             float                         width  = 1.0f,
+                             bool                          closed = false);
+
+    static void DrawRect(const glm::vec3& pos,
+                         const glm::vec2& size,
+                         const glm::vec4& color,
+                         float            width = 1.0f);
+    static void DrawRect(const glm::mat4& transform, const glm::vec4& color, float width = 1.0f);
+
+    static void DrawCircle(const glm::vec3& pos,
+                           float            radius,
+                           const glm::vec4& color,
+                           float            thickness = 1.0f,
+                           float            fade      = 0.005f);
+    static void DrawCircle(const glm::mat4& transform,
+                           const glm::vec4& color,
+                           float            thickness = 1.0f,
+                           float            fade      = 0.005f);
+
+    // ----- STATIC GEOMETRY -----
+    // Drawn right away, before the quads queued in this scene.
+    static void DrawStaticBatch(const StaticBatch& batch);
 
     // Statistics
     struct Statistics
     {
-        uint32_t drawCalls = 0;
-        uint32_t quadCount = 0;
+        uint32_t drawCalls   = 0;
+        uint32_t quadCount   = 0;
+        uint32_t lineCount   = 0;    // Segments.
+        uint32_t circleCount = 0;
 
-        uint32_t GetTotalVertexCount() { return quadCount * 4; }
-        uint32_t GetTotalIndexCount() { return quadCount * 6; }
+        // Lines and circles are quads too.
+        uint32_t GetTotalVertexCount() { return (quadCount + lineCount + circleCount) * 4; }
+        uint32_t GetTotalIndexCount() { return (quadCount + lineCount + circleCount) * 6; }
     };
     static Statistics GetStats();
     static void       ResetStats();
 
 private:
     static void FlushAndReset();
+    static void DrawSubTexturedQuad(const glm::mat4&         transform,
+                                    const Ref<SubTexture2D>& texture,
+                                    const glm::vec2&         textScale,
+                                    const glm::vec4&         tint,
+                                    const glm::vec4&         animation);
 };
 }    // namespace Brigerad
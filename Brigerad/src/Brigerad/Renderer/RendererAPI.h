@@ -22,6 +22,17 @@ public:
     virtual void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) = 0;
 
     virtual void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0) = 0;
+    virtual void DrawIndexedInstanced(const Ref<VertexArray>& vertexArray,
+                                      uint32_t                indexCount,
+                                      uint32_t                instanceCount)                = 0;
+
+    /** Whether compute shaders are available. */
+    virtual bool SupportsCompute() const = 0;
+    /**
+     * Run the bound compute shader, then make what it wrote visible to the vertex attributes and
+     * to the next compute shaders.
+     */
+    virtual void DispatchCompute(uint32_t groupCountX) = 0;
 
     inline static API GetAPI() { return s_API; }
 
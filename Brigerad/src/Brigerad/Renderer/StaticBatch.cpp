@@ -0,0 +1,166 @@
+/**
+ * @file   StaticBatch.cpp
+ * @author Samuel Martel
+ * @date   2026/10/19
+ *
+ * @brief  Source for the StaticBatch module.
+ */
+#include "brpch.h"
+#include "StaticBatch.h"
+
+namespace Brigerad
+{
+static constexpr glm::vec4 s_quadVertexPositions[] = {{-0.5f, -0.5f, 0.0f, 1.0f},
+                                                      {0.5f, -0.5f, 0.0f, 1.0f},
+                                                      {0.5f, 0.5f, 0.0f, 1.0f},
+                                                      {-0.5f, 0.5f, 0.0f, 1.0f}};
+static constexpr glm::vec2 s_textureCoords[]       = {
+  {0.0f, 0.0f}, {1.0f, 0.0f}, {1.0f, 1.0f}, {0.0f, 1.0f}};
+
+void StaticBatch::Clear()
+{
+    m_vertices.clear();
+    m_groups.clear();
+    m_isBaked = false;
+}
+
+void StaticBatch::AddQuad(const glm::mat4& transform, const glm::vec4& color)
+{
+    if (m_groups.empty())
+    {
+        m_groups.emplace_back();
+    }
+
+    PushQuad(transform, color, 0.0f, s_textureCoords, glm::vec2(1.0f), glm::vec4(0.0f));
+}
+
+void StaticBatch::AddQuad(const glm::mat4&      transform,
+                          const Ref<Texture2D>& texture,
+                          const glm::vec2&      tilingFactor,
+                          const glm::vec4&      tint)
+{
+    PushQuad(transform,
+             tint,
+             GetTextureIndex(texture),
+             s_textureCoords,
+             tilingFactor,
+             glm::vec4(0.0f));
+}
+
+void StaticBatch::AddQuad(const glm::mat4&         transform,
+                          const Ref<SubTexture2D>& subTexture,
+                          const glm::vec2&         tilingFactor,
+                          const glm::vec4&         tint)
+{
+    PushQuad(transform,
+             tint,
+             GetTextureIndex(subTexture->GetTexture()),
+             subTexture->GetTexCoords(),
+             tilingFactor,
+             glm::vec4(0.0f));
+}
+
+void StaticBatch::AddAnimatedQuad(const glm::mat4&         transform,
+                                  const Ref<SubTexture2D>& firstFrame,
+                                  const glm::vec4&         animation,
+                                  const glm::vec4&         tint)
+{
+    PushQuad(transform,
+             tint,
+             GetTextureIndex(firstFrame->GetTexture()),
+             firstFrame->GetTexCoords(),
+             glm::vec2(1.0f),
+             animation);
+}
+
+void StaticBatch::Bake()
+{
+    BR_PROFILE_FUNCTION();
+
+    for (size_t g = 0; g < m_groups.size(); g++)
+    {
+        Group&   group = m_groups[g];
+        uint32_t end   = g + 1 < m_groups.size() ? m_groups[g + 1].firstQuad : GetQuadCount();
+        uint32_t quads = end - group.firstQuad;
+        if (quads == 0)
+        {
+            continue;
+        }
+
+        // Uploaded once with GL_STATIC_DRAW, never touched again.
+        Ref<VertexBuffer> vertexBuffer =
+          VertexBuffer::Create(reinterpret_cast<float*>(&m_vertices[group.firstQuad * 4]),
+                               quads * 4 * sizeof(QuadVertex));
+        vertexBuffer->SetLayout(QuadVertex::GetLayout());
+
+        std::vector<uint32_t> indices(quads * 6);
+        for (uint32_t i = 0, offset = 0; i < indices.size(); i += 6, offset += 4)
+        {
+            indices[i + 0] = offset + 0;
+            indices[i + 1] = offset + 1;
+            indices[i + 2] = offset + 2;
+
+            indices[i + 3] = offset + 2;
+            indices[i + 4] = offset + 3;
+            indices[i + 5] = offset + 0;
+        }
+
+        group.vertexArray = VertexArray::Create();
+        group.vertexArray->AddVertexBuffer(vertexBuffer);
+        group.indexCount = uint32_t(indices.size());
+        group.vertexArray->SetIndexBuffer(IndexBuffer::Create(indices.data(), group.indexCount));
+    }
+
+    m_isBaked = true;
+}
+
+// Slot of the texture in the current group, starting a new group if it has no slot left.
+float StaticBatch::GetTextureIndex(const Ref<Texture2D>& texture)
+{
+    if (m_groups.empty())
+    {
+        m_groups.emplace_back();
+    }
+
+    Group* group = &m_groups.back();
+    for (uint32_t i = 0; i < group->textures.size(); i++)
+    {
+        if (*group->textures[i] == *texture)
+        {
+            return float(i + 1);
+        }
+    }
+
+    if (group->textures.size() == s_maxTextures)
+    {
+        Group next;
+        next.firstQuad = GetQuadCount();
+        m_groups.push_back(std::move(next));
+        group = &m_groups.back();
+    }
+    group->textures.push_back(texture);
+    return float(group->textures.size());
+}
+
+void StaticBatch::PushQuad(const glm::mat4& transform,
+                           const glm::vec4& color,
+                           float            texIndex,
+                           const glm::vec2* texCoords,
+                           const glm::vec2& tilingFactor,
+                           const glm::vec4& animation)
+{
+    BR_CORE_ASSERT(!m_isBaked, "Clear the batch before adding quads to it!");
+
+    for (int i = 0; i < 4; i++)
+    {
+        QuadVertex& vertex  = m_vertices.emplace_back();
+        vertex.position     = transform * s_quadVertexPositions[i];
+        vertex.color        = color;
+        vertex.texCoord     = texCoords[i];
+        vertex.tilingFactor = tilingFactor;
+        vertex.texIndex     = texIndex;
+        vertex.isText       = 0;
+        vertex.animation    = animation;
+    }
+}
+}    // namespace Brigerad
@@ -0,0 +1,84 @@
+/**
+ * @file   StaticBatch.h
+ * @author Samuel Martel
+ * @date   2026/10/19
+ *
+ * @brief  Header for the StaticBatch module.
+ */
+#pragma once
+
+#include "Brigerad/Renderer/Renderer2D.h"
+#include "Brigerad/Renderer/SubTexture2D.h"
+#include "Brigerad/Renderer/Texture.h"
+#include "Brigerad/Renderer/VertexArray.h"
+
+#include "glm/glm.hpp"
+
+#include <vector>
+
+namespace Brigerad
+{
+/**
+ * Quads that don't change from one frame to the next, baked once into immutable vertex buffers.
+ *
+ * Add the quads, Bake, then draw the batch every frame with Renderer2D::DrawStaticBatch. The quads
+ * are split in groups of up to 31 textures, each drawn with a single draw call, in the order they
+ * were added. Changing a quad means clearing the batch and baking it again.
+ */
+class StaticBatch
+{
+public:
+    void Clear();
+
+    void AddQuad(const glm::mat4& transform, const glm::vec4& color);
+    void AddQuad(const glm::mat4&      transform,
+                 const Ref<Texture2D>& texture,
+                 const glm::vec2&      tilingFactor = glm::vec2(1.0f),
+                 const glm::vec4&      tint         = glm::vec4(1.0f));
+    void AddQuad(const glm::mat4&         transform,
+                 const Ref<SubTexture2D>& subTexture,
+                 const glm::vec2&         tilingFactor = glm::vec2(1.0f),
+                 const glm::vec4&         tint         = glm::vec4(1.0f));
+    /**
+     * Quad animated by the vertex shader, which keeps it moving without baking it again.
+     * See Renderer2D::DrawAnimatedQuad.
+     */
+    void AddAnimatedQuad(const glm::mat4&         transform,
+                         const Ref<SubTexture2D>& firstFrame,
+                         const glm::vec4&         animation,
+                         const glm::vec4&         tint = glm::vec4(1.0f));
+
+    /** Upload the quads added since the last Clear to the GPU. */
+    void Bake();
+
+    bool     IsBaked() const { return m_isBaked; }
+    uint32_t GetQuadCount() const { return uint32_t(m_vertices.size() / 4); }
+    uint32_t GetDrawCallCount() const { return uint32_t(m_groups.size()); }
+
+private:
+    // Slot 0 is the white texture of the flat colored quads.
+    static constexpr uint32_t s_maxTextures = 31;
+
+    struct Group
+    {
+        Ref<VertexArray>            vertexArray;
+        std::vector<Ref<Texture2D>> textures;
+        uint32_t                    indexCount = 0;
+        uint32_t                    firstQuad  = 0;
+    };
+
+    float GetTextureIndex(const Ref<Texture2D>& texture);
+    void  PushQuad(const glm::mat4& transform,
+                   const glm::vec4& color,
+                   float            texIndex,
+                   const glm::vec2* texCoords,
+                   const glm::vec2& tilingFactor,
+                   const glm::vec4& animation);
+
+    std::vector<QuadVertex> m_vertices;
+    std::vector<Group>      m_groups;
+    bool                    m_isBaked = false;
+
+    friend class Renderer2D;
+};
+}    // namespace Brigerad
@@ -28,9 +28,13 @@
 /*********************************************************************************************************************/
 
 #include "Brigerad/Core/Log.h"
+#include "Brigerad/Renderer/ParticleRenderer.h"
+#include "Brigerad/Renderer/Renderer2D.h"
 #include "Brigerad/Renderer/Texture.h"
 #include "Brigerad/Scene/SceneCamera.h"
 #include "Brigerad/Scene/ScriptableEntity.h"
+#include "Brigerad/Scene/SpriteAnimation.h"
+#include "Brigerad/Scene/Tilemap.h"
 #include "Brigerad/Scene/ImGuiWindowComponents.h"
 #include "Brigerad/Scene/ImGuiTextComponents.h"
 #include "Brigerad/Scene/ImGuiButtonComponents.h"
@@ -40,6 +44,7 @@
 
 #include "imgui.h"
 
+#include <cmath>
 #include <string>
 #include <ostream>
 
@@ -140,6 +145,152 @@ struct TextureRendererComponent
     TextureRendererComponent(const std::string& p) : texture(Texture2D::Create(p)), path(p) {}
 };
 
+/**
+ * Marks an entity that doesn't move, like a background. The scene bakes the color and texture
+ * renderers of its static entities into a StaticBatch drawn straight from the GPU, and bakes it
+ * again only when the transform or the renderer of one of them changes.
+ */
+struct StaticComponent
+{
+    // What was baked for the entity, compared with its components every frame.
+    TransformComponent bakedTransform;
+    glm::vec4          bakedColor     = glm::vec4 {0.0f};
+    Texture2D*         bakedTexture   = nullptr;
+    SubTexture2D*      bakedFrame     = nullptr;
+    glm::vec4          bakedAnimation = glm::vec4 {0.0f};
+
+    StaticComponent()                       = default;
+    StaticComponent(const StaticComponent&) = default;
+};
+
+struct TilemapComponent
+{
+    Tilemap tilemap;
+
+    TilemapComponent() = default;
+    TilemapComponent(const Ref<Texture2D>& tileset,
+                     const glm::vec2&      cellSize,
+                     const glm::vec2&      tileSize = glm::vec2(1.0f))
+    : tilemap(tileset, cellSize, tileSize)
+    {
+    }
+};
+
+/**
+ * Sprite playing a clip of a sprite sheet.
+ *
+ * The frames are advanced on the CPU by the "Animation" system of the scene, unless onGpu is set
+ * and the clip allows it, in which case the vertex shader picks the frame from the time elapsed
+ * since startTime and nothing has to be done for the sprite from one frame to the next. Static
+ * entities should animate on the GPU, otherwise every new frame bakes the batch again.
+ */
+struct AnimatedSpriteComponent
+{
+    Ref<SpriteSheet>           sheet;
+    const SpriteAnimationClip* clip = nullptr;
+    glm::vec4                  tint = glm::vec4(1.0f);
+
+    float    time      = 0.0f;    // Seconds into the clip.
+    float    speed     = 1.0f;
+    uint32_t frame     = 0;
+    bool     isPlaying = false;
+    bool     onGpu     = false;
+    float    startTime = 0.0f;    // In Renderer2D::GetAnimationTime, for onGpu.
+
+    AnimatedSpriteComponent()                               = default;
+    AnimatedSpriteComponent(const AnimatedSpriteComponent&) = default;
+    AnimatedSpriteComponent(const Ref<SpriteSheet>& s, const std::string& clipName, bool gpu = false)
+    : sheet(s)
+    {
+        Play(clipName, gpu);
+    }
+
+    /** Play a clip of the sheet from the start. Returns false if the sheet has no such clip. */
+    bool Play(const std::string& clipName, bool gpu = false)
+    {
+        clip = sheet ? sheet->GetClip(clipName) : nullptr;
+        if (clip == nullptr)
+        {
+            BR_CORE_WARN("No animation clip named '{}'!", clipName);
+            isPlaying = false;
+            return false;
+        }
+
+        time      = 0.0f;
+        frame     = 0;
+        isPlaying = clip->GetDuration() > 0.0f;
+        onGpu     = gpu;
+        startTime = Renderer2D::GetAnimationTime();
+        return true;
+    }
+
+    /** Freeze the sprite on its current frame. */
+    void Stop()
+    {
+        if (IsOnGpu())
+        {
+            time  = std::fmod(Renderer2D::GetAnimationTimeSince(startTime) * speed,
+                             clip->GetDuration());
+            frame = clip->GetFrameAt(time);
+        }
+        isPlaying = false;
+    }
+
+    bool IsOnGpu() const { return onGpu && isPlaying && clip->isGpuCompatible && speed > 0.0f; }
+
+    /** The animation of the quad, as expected by Renderer2D::DrawAnimatedQuad. */
+    glm::vec4 GetGpuAnimation() const
+    {
+        return {startTime,
+                clip->GetDuration() / (float(clip->GetFrameCount()) * speed),
+                float(clip->GetFrameCount()),
+                clip->frameStep};
+    }
+};
+
+/**
+ * Emits particles at the position of the entity, emissionRate per second plus the bursts.
+ *
+ * The particles are simulated on the CPU by the "Particles" system of the scene, or by a compute
+ * shader if onGpu is asked and supported, in which case the system only counts what the GPU has to
+ * do and the scene hands it over when rendering.
+ */
+struct ParticleEmitterComponent
+{
+    ParticleProps        props;
+    ParticlePool         pool;
+    Ref<GpuParticlePool> gpuPool;
+    bool                 isEmitting = true;
+
+    // Carried from one update to the next.
+    float    emissionDebt   = 0.0f;    // Fraction of a particle not emitted yet.
+    uint32_t pendingBurst   = 0;
+    uint32_t gpuPendingEmit = 0;
+    float    gpuPendingTime = 0.0f;
+
+    ParticleEmitterComponent()                                = default;
+    ParticleEmitterComponent(const ParticleEmitterComponent&) = default;
+    ParticleEmitterComponent(const ParticleProps& p,
+                             uint32_t             maxParticles = 10000,
+                             bool                 onGpu        = false)
+    : props(p), pool(onGpu && ParticleRenderer::SupportsGpuSimulation() ? 0 : maxParticles)
+    {
+        if (onGpu && ParticleRenderer::SupportsGpuSimulation())
+        {
+            gpuPool = CreateRef<GpuParticlePool>(maxParticles);
+        }
+        else if (onGpu)
+        {
+            BR_CORE_WARN("Compute shaders are not supported, simulating the particles on the CPU.");
+        }
+    }
+
+    /** Emit count particles at once, on the next update. */
+    void Burst(uint32_t count) { pendingBurst += count; }
+
+    uint32_t GetCapacity() const { return gpuPool ? gpuPool->GetCapacity() : pool.GetCapacity(); }
+};
+
 struct CameraComponent
 {
     SceneCamera camera;
@@ -56,6 +56,7 @@ public:
 
         T& component = m_scene->m_registry.emplace<T>(m_entityHandle, std::forward<Args>(args)...);
         m_scene->OnComponentAdded<T>(*this, component);
+        m_scene->m_isDirty = true;
         return component;
     }
 
@@ -81,6 +82,7 @@ public:
         BR_CORE_ASSERT(HasComponent<T>(), "Entity does not have this component!");
 
         m_scene->m_registry.remove<T>(m_entityHandle);
+        m_scene->m_isDirty = true;
     }
 
     template<typename T>
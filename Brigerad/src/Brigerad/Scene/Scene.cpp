@@ -30,9 +30,13 @@
 
 #include "Components.h"
 #include "Entity.h"
+#include "TransformSystem.h"
+#include "Brigerad/Renderer/ParticleRenderer.h"
 #include "Brigerad/Renderer/Renderer2D.h"
 #include "Brigerad/Events/ImGuiEvents.h"
 #include "Brigerad/Core/Application.h"
+#include "Brigerad/Script/ScriptEngine.h"
+#include "Brigerad/Script/ScriptScheduler.h"
 
 #include "imgui.h"
 #include "imgui_internal.h"
@@ -57,6 +61,61 @@ namespace Brigerad
 /*********************************************************************************************************************/
 // [SECTION] Private Function Declarations
 /*********************************************************************************************************************/
+/**
+ * @brief   Get the rectangle, in world space, seen by a camera.
+ *          With a perspective camera, this covers everything between the near and far planes.
+ */
+static std::pair<glm::vec2, glm::vec2> GetViewBounds(const glm::mat4& projection,
+                                                     const glm::mat4& cameraTransform)
+{
+    glm::mat4 inverseViewProj = cameraTransform * glm::inverse(projection);
+
+    glm::vec2 min = glm::vec2(std::numeric_limits<float>::max());
+    glm::vec2 max = glm::vec2(std::numeric_limits<float>::lowest());
+    for (float x : {-1.0f, 1.0f})
+    {
+        for (float y : {-1.0f, 1.0f})
+        {
+            for (float z : {-1.0f, 1.0f})
+            {
+                glm::vec4 corner = inverseViewProj * glm::vec4(x, y, z, 1.0f);
+                glm::vec2 world  = glm::vec2(corner) / corner.w;
+                min              = glm::min(min, world);
+                max              = glm::max(max, world);
+            }
+        }
+    }
+
+    return {min, max};
+}
+
+/**
+ * @brief   Get the frame an animated sprite currently shows, nullptr if it shows nothing.
+ *          A sprite animated by the vertex shader always gives its first frame.
+ */
+static const Ref<SubTexture2D>& GetSpriteFrame(const AnimatedSpriteComponent* sprite)
+{
+    static const Ref<SubTexture2D> none;
+    if (sprite == nullptr || sprite->clip == nullptr || sprite->clip->frames.empty())
+    {
+        return none;
+    }
+
+    const auto& frames = sprite->clip->frames;
+    return frames[sprite->IsOnGpu() ? 0 : std::min<size_t>(sprite->frame, frames.size() - 1)];
+}
+
+/**
+ * @brief   Get the animation given to the vertex shader for a sprite, zero when the frame is
+ *          picked on the CPU.
+ */
+static glm::vec4 GetSpriteAnimation(const AnimatedSpriteComponent* sprite)
+{
+    return sprite != nullptr && sprite->clip != nullptr && sprite->IsOnGpu()
+             ? sprite->GetGpuAnimation()
+             : glm::vec4 {0.0f};
+}
+
 template<typename T>
 void DrawImGuiButton(Entity& entity, const std::function<bool(T&)>& func)
 {
@@ -108,6 +167,22 @@ void DrawImGuiButton(Entity& entity, const std::function<bool(T&)>& func)
 /*********************************************************************************************************************/
 Scene::Scene()
 {
+    // Scripts can do anything to the scene and rendering needs the GL context, so the built-in
+    // systems run alone on the main thread.
+    m_systems.Add("NativeScripts", SystemAccess().Exclusive(), [](Scene& scene, Timestep ts) {
+        scene.UpdateNativeScripts(ts);
+    });
+    m_systems.Add("LuaScripts", SystemAccess().Exclusive(), [](Scene& scene, Timestep ts) {
+        scene.UpdateLuaScripts(ts);
+    });
+    m_systems.Add("Animation",
+                  SystemAccess().Writes<AnimatedSpriteComponent>(),
+                  [](Scene& scene, Timestep ts) { scene.UpdateAnimations(ts); });
+    m_systems.Add("Particles",
+                  SystemAccess().Reads<TransformComponent>().Writes<ParticleEmitterComponent>(),
+                  [](Scene& scene, Timestep ts) { scene.UpdateParticles(ts); });
+    m_systems.Add(
+      "Render2D", SystemAccess().Exclusive(), [](Scene& scene, Timestep) { scene.Render2D(); });
 }
 
 Scene::~Scene()
@@ -151,93 +226,42 @@ Entity Scene::CreateChildEntity(const std::string& name, Entity parent)
 void Scene::DestroyEntity(Entity entity)
 {
     m_registry.destroy(entity);
+    m_isDirty = true;
 }
 
-void Scene::OnUpdate(Timestep ts)
+bool Scene::IsDirty() const
 {
-    // Update Scripts.
-    {
-        m_registry.view<NativeScriptComponent>().each([=](auto entity, NativeScriptComponent& nsc) {
-            // TODO: Move to Scene::OnScenePlay
-            if (!nsc.instance)
-            {
-                nsc.instance           = nsc.instantiateScript();
-                nsc.instance->m_entity = Entity {entity, this};
-                nsc.instance->OnCreate();
-            }
-
-            nsc.instance->OnUpdate(ts);
-        });
-    }
+    // Scripts can change anything at any time, animated sprites and particles change on their own.
+    if (m_isDirty || !m_fixedSystems.GetSystems().empty() ||
+        m_registry.size<NativeScriptComponent>() != 0 ||
+        m_registry.size<LuaScriptComponent>() != 0 ||
+        m_registry.size<AnimatedSpriteComponent>() != 0 ||
+        m_registry.size<ParticleEmitterComponent>() != 0)
     {
-        m_registry.view<LuaScriptComponent>().each([=](auto entity, LuaScriptComponent& sc) {
-            // TODO: Move to Scene::OnScenePlay
-            if (!sc.instance)
-            {
-                sc.instance           = sc.InstantiateScript();
-                sc.instance->m_entity = Entity {entity, this};
-                sc.instance->OnCreate();
-            }
-
-            sc.instance->OnUpdate(ts);
-        });
+        return true;
     }
 
-
-    // Render 2D.
-    Camera*   mainCamera = nullptr;
-    glm::mat4 cameraTransform;
+    // Tiles are set in place, the tilemaps keep track of it themselves.
+    auto tilemaps = m_registry.view<const TilemapComponent>();
+    for (auto entity : tilemaps)
     {
-        auto view = m_registry.view<TransformComponent, CameraComponent>();
-        for (auto entity : view)
+        if (tilemaps.get(entity).tilemap.IsEdited())
         {
-            auto [transform, camera] = view.get<TransformComponent, CameraComponent>(entity);
-
-            if (camera.primary)
-            {
-                mainCamera      = &camera.camera;
-                cameraTransform = transform.GetTransform();
-            }
+            return true;
         }
     }
+    return false;
+}
 
-    if (mainCamera)
-    {
-        Renderer2D::BeginScene(mainCamera->GetProjection(), cameraTransform);
-
-        auto group = m_registry.group<TransformComponent>(entt::get<ColorRendererComponent>);
-
-        for (auto entity : group)
-        {
-            auto [transform, sprite] =
-              group.get<TransformComponent, ColorRendererComponent>(entity);
-
-            Renderer2D::DrawQuad(transform, sprite.color);
-        }
-        auto view = m_registry.view<TransformComponent, TextureRendererComponent>();
-
-        for (auto entity : view)
-        {
-            auto [transform, sprite] =
-              view.get<TransformComponent, TextureRendererComponent>(entity);
-
-            Renderer2D::DrawQuad(transform, sprite.texture);
-        }
-
-        m_registry.view<LuaScriptComponent>().each(
-          [=](auto entity, LuaScriptComponent& sc) { sc.instance->OnRender(); });
-
-        auto textEntities = m_registry.view<TransformComponent, TextComponent>();
-
-        for (auto entity : textEntities)
-        {
-            auto [transform, text] = textEntities.get<TransformComponent, TextComponent>(entity);
-
-            Renderer2D::DrawString(transform.position, text.text, text.scale);
-        }
+void Scene::OnFixedUpdate(Timestep ts)
+{
+    m_fixedSystems.Run(*this, ts);
+}
 
-        Renderer2D::EndScene();
-    }
+void Scene::OnUpdate(Timestep ts)
+{
+    m_systems.Run(*this, ts);
+    m_isDirty = false;
 }
 
 void Scene::OnImguiRender()
@@ -255,6 +279,7 @@ void Scene::OnViewportResize(uint32_t w, uint32_t h)
 {
     m_viewportWidth  = w;
     m_viewportHeight = h;
+    m_isDirty        = true;
 
     // Resize our non-FixedAspectRatio cameras.
     auto view = m_registry.view<CameraComponent>();
@@ -271,6 +296,8 @@ void Scene::OnViewportResize(uint32_t w, uint32_t h)
 
 void Scene::OnEvent(Event& e)
 {
+    ScriptScheduler::OnEvent(e);
+
     m_registry.each([&](auto entityID) {
         Entity entity {entityID, this};
         if (entity.HasComponent<NativeScriptComponent>())
@@ -362,6 +389,26 @@ void Scene::OnComponentAdded<TextureRendererComponent>(Entity, TextureRendererCo
 {
 }
 
+template<>
+void Scene::OnComponentAdded<StaticComponent>(Entity, StaticComponent& component)
+{
+}
+
+template<>
+void Scene::OnComponentAdded<TilemapComponent>(Entity, TilemapComponent& component)
+{
+}
+
+template<>
+void Scene::OnComponentAdded<AnimatedSpriteComponent>(Entity, AnimatedSpriteComponent& component)
+{
+}
+
+template<>
+void Scene::OnComponentAdded<ParticleEmitterComponent>(Entity, ParticleEmitterComponent& component)
+{
+}
+
 template<>
 void Scene::OnComponentAdded<TextComponent>(Entity, TextComponent& component)
 {
@@ -438,6 +485,325 @@ void Scene::OnComponentAdded<ImGuiButtonListenerComponent<ImGuiArrowButtonCompon
 /*********************************************************************************************************************/
 // [SECTION] Private Method Definitions
 /*********************************************************************************************************************/
+void Scene::UpdateNativeScripts(Timestep ts)
+{
+    m_registry.view<NativeScriptComponent>().each([=](auto entity, NativeScriptComponent& nsc) {
+        // TODO: Move to Scene::OnScenePlay
+        if (!nsc.instance)
+        {
+            nsc.instance           = nsc.instantiateScript();
+            nsc.instance->m_entity = Entity {entity, this};
+            nsc.instance->OnCreate();
+        }
+
+        nsc.instance->OnUpdate(ts);
+    });
+}
+
+void Scene::UpdateLuaScripts(Timestep ts)
+{
+    // Created here, on the main thread, the updates run in parallel.
+    m_luaScripts.clear();
+    m_registry.view<LuaScriptComponent>().each([=](auto entity, LuaScriptComponent& sc) {
+        // TODO: Move to Scene::OnScenePlay
+        if (!sc.instance)
+        {
+            sc.instance           = sc.InstantiateScript();
+            sc.instance->m_entity = Entity {entity, this};
+            sc.instance->OnCreate();
+        }
+
+        m_luaScripts.push_back(sc.instance);
+    });
+
+    ScriptEngine::Update(m_luaScripts, ts);
+}
+
+/**
+ * @brief   Advance the animated sprites that aren't animated by the vertex shader.
+ *          The pool of the components is walked in place, the entities don't matter here.
+ */
+void Scene::UpdateAnimations(Timestep ts)
+{
+    BR_PROFILE_FUNCTION();
+
+    AnimatedSpriteComponent* sprites = m_registry.raw<AnimatedSpriteComponent>();
+    size_t                   count   = m_registry.size<AnimatedSpriteComponent>();
+    float                    dt      = ts;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        AnimatedSpriteComponent& sprite = sprites[i];
+        if (!sprite.isPlaying || sprite.IsOnGpu())
+        {
+            continue;
+        }
+
+        const SpriteAnimationClip& clip     = *sprite.clip;
+        float                      duration = clip.GetDuration();
+        sprite.time                         = std::max(sprite.time + dt * sprite.speed, 0.0f);
+        if (sprite.time >= duration)
+        {
+            if (clip.loop)
+            {
+                sprite.time = std::fmod(sprite.time, duration);
+            }
+            else
+            {
+                sprite.time      = duration;
+                sprite.isPlaying = false;
+            }
+        }
+        sprite.frame = clip.GetFrameAt(sprite.time);
+    }
+}
+
+/**
+ * @brief   Emit and move the particles simulated on the CPU.
+ *          The GPU emitters can't be touched from a worker thread, their work is only counted
+ *          here and handed to the GPU by RenderParticles.
+ */
+void Scene::UpdateParticles(Timestep ts)
+{
+    BR_PROFILE_FUNCTION();
+
+    float dt   = ts;
+    auto  view = m_registry.view<TransformComponent, ParticleEmitterComponent>();
+    for (auto entity : view)
+    {
+        auto& emitter = view.get<ParticleEmitterComponent>(entity);
+
+        uint32_t count       = emitter.pendingBurst;
+        emitter.pendingBurst = 0;
+        if (emitter.isEmitting)
+        {
+            emitter.emissionDebt += emitter.props.emissionRate * dt;
+            uint32_t emitted = uint32_t(emitter.emissionDebt);
+            emitter.emissionDebt -= float(emitted);
+            count += emitted;
+        }
+
+        if (emitter.gpuPool)
+        {
+            emitter.gpuPendingEmit += count;
+            emitter.gpuPendingTime += dt;
+        }
+        else
+        {
+            emitter.pool.Emit(count, view.get<TransformComponent>(entity).position, emitter.props);
+            emitter.pool.Update(dt, emitter.props.gravity);
+        }
+    }
+}
+
+/**
+ * @brief   Bake the static entities again if any of them changed since the last time.
+ *          Going through them is much cheaper than building and uploading their quads.
+ */
+void Scene::UpdateStaticBatch()
+{
+    BR_PROFILE_FUNCTION();
+
+    auto view = m_registry.view<StaticComponent, TransformComponent>();
+
+    bool   isStale = !m_staticBatch.IsBaked();
+    size_t count   = 0;
+    for (auto entity : view)
+    {
+        count++;
+        if (isStale)
+        {
+            continue;
+        }
+
+        auto [baked, transform] = view.get<StaticComponent, TransformComponent>(entity);
+        const auto* color       = m_registry.try_get<ColorRendererComponent>(entity);
+        const auto* texture     = m_registry.try_get<TextureRendererComponent>(entity);
+        const auto* sprite      = m_registry.try_get<AnimatedSpriteComponent>(entity);
+
+        isStale = transform.position != baked.bakedTransform.position ||
+                  transform.rotation != baked.bakedTransform.rotation ||
+                  transform.scale != baked.bakedTransform.scale ||
+                  (color != nullptr ? color->color : glm::vec4 {0.0f}) != baked.bakedColor ||
+                  (texture != nullptr ? texture->texture.get() : nullptr) != baked.bakedTexture ||
+                  GetSpriteFrame(sprite).get() != baked.bakedFrame ||
+                  GetSpriteAnimation(sprite) != baked.bakedAnimation;
+    }
+
+    // A static entity was destroyed, or lost its StaticComponent.
+    isStale |= count != m_bakedStaticCount;
+    if (!isStale)
+    {
+        return;
+    }
+
+    m_staticBatch.Clear();
+    for (auto entity : view)
+    {
+        auto [baked, transform] = view.get<StaticComponent, TransformComponent>(entity);
+        const auto* color       = m_registry.try_get<ColorRendererComponent>(entity);
+        const auto* texture     = m_registry.try_get<TextureRendererComponent>(entity);
+        const auto* sprite      = m_registry.try_get<AnimatedSpriteComponent>(entity);
+
+        glm::mat4 matrix = transform.GetTransform();
+        if (color != nullptr)
+        {
+            m_staticBatch.AddQuad(matrix, color->color);
+        }
+        if (texture != nullptr && texture->texture)
+        {
+            m_staticBatch.AddQuad(matrix, texture->texture);
+        }
+
+        baked.bakedTransform = transform;
+        baked.bakedColor     = color != nullptr ? color->color : glm::vec4 {0.0f};
+        baked.bakedTexture   = texture != nullptr ? texture->texture.get() : nullptr;
+        baked.bakedFrame     = GetSpriteFrame(sprite).get();
+        baked.bakedAnimation = GetSpriteAnimation(sprite);
+        if (baked.bakedFrame != nullptr)
+        {
+            m_staticBatch.AddAnimatedQuad(
+              matrix, GetSpriteFrame(sprite), baked.bakedAnimation, sprite->tint);
+        }
+    }
+    m_staticBatch.Bake();
+    m_bakedStaticCount = count;
+}
+
+void Scene::Render2D()
+{
+    Camera*   mainCamera = nullptr;
+    glm::mat4 cameraTransform;
+    {
+        auto view = m_registry.view<TransformComponent, CameraComponent>();
+        for (auto entity : view)
+        {
+            auto [transform, camera] = view.get<TransformComponent, CameraComponent>(entity);
+
+            if (camera.primary)
+            {
+                mainCamera      = &camera.camera;
+                cameraTransform = transform.GetTransform();
+            }
+        }
+    }
+
+    if (mainCamera)
+    {
+        // The scene might not be rendered to the window, its lines are sized for its viewport.
+        if (m_viewportWidth != 0 && m_viewportHeight != 0)
+        {
+            Renderer2D::SetViewportSize(m_viewportWidth, m_viewportHeight);
+        }
+        Renderer2D::BeginScene(mainCamera->GetProjection(), cameraTransform);
+
+        UpdateStaticBatch();
+        Renderer2D::DrawStaticBatch(m_staticBatch);
+
+        auto viewBounds = GetViewBounds(mainCamera->GetProjection(), cameraTransform);
+        auto tilemaps   = m_registry.view<TransformComponent, TilemapComponent>();
+        for (auto entity : tilemaps)
+        {
+            auto [transform, tilemap] = tilemaps.get<TransformComponent, TilemapComponent>(entity);
+            tilemap.tilemap.Render(transform.GetTransform(), viewBounds.first, viewBounds.second);
+        }
+
+        // The group owns the transforms, they are packed at the front of the pool in the order of
+        // group.data(). Iterate from the back like the group's iterators do.
+        auto group = m_registry.group<TransformComponent>(entt::get<ColorRendererComponent>,
+                                                          entt::exclude<StaticComponent>);
+        m_transforms.resize(group.size());
+        TransformSystem::Compute(group.raw<TransformComponent>(), group.size(), m_transforms.data());
+
+        for (size_t i = group.size(); i-- > 0;)
+        {
+            const auto& sprite = group.get<ColorRendererComponent>(group.data()[i]);
+            Renderer2D::DrawQuad(m_transforms[i], sprite.color);
+        }
+
+        auto view = m_registry.view<TransformComponent, TextureRendererComponent>(
+          entt::exclude<StaticComponent>);
+        m_gatheredTransforms.clear();
+        for (auto entity : view)
+        {
+            m_gatheredTransforms.push_back(&view.get<TransformComponent>(entity));
+        }
+        m_transforms.resize(m_gatheredTransforms.size());
+        TransformSystem::Compute(
+          m_gatheredTransforms.data(), m_gatheredTransforms.size(), m_transforms.data());
+
+        size_t i = 0;
+        for (auto entity : view)
+        {
+            const auto& sprite = view.get<TextureRendererComponent>(entity);
+            Renderer2D::DrawQuad(m_transforms[i++], sprite.texture);
+        }
+
+        auto sprites = m_registry.view<TransformComponent, AnimatedSpriteComponent>(
+          entt::exclude<StaticComponent>);
+        for (auto entity : sprites)
+        {
+            const auto& sprite = sprites.get<AnimatedSpriteComponent>(entity);
+            const auto& frame  = GetSpriteFrame(&sprite);
+            if (frame)
+            {
+                Renderer2D::DrawAnimatedQuad(sprites.get<TransformComponent>(entity).GetTransform(),
+                                             frame,
+                                             GetSpriteAnimation(&sprite),
+                                             sprite.tint);
+            }
+        }
+
+        m_registry.view<LuaScriptComponent>().each(
+          [=](auto entity, LuaScriptComponent& sc) { sc.instance->OnRender(); });
+
+        auto textEntities = m_registry.view<TransformComponent, TextComponent>();
+
+        for (auto entity : textEntities)
+        {
+            auto [transform, text] = textEntities.get<TransformComponent, TextComponent>(entity);
+
+            Renderer2D::DrawString(transform.position, text.text, text.scale);
+        }
+
+        Renderer2D::EndScene();
+
+        RenderParticles(mainCamera->GetProjection() * glm::inverse(cameraTransform));
+    }
+}
+
+/**
+ * @brief   Draw every emitter, one instanced draw call each, over the rest of the scene.
+ */
+void Scene::RenderParticles(const glm::mat4& viewProjection)
+{
+    BR_PROFILE_FUNCTION();
+
+    if (m_registry.size<ParticleEmitterComponent>() == 0)
+    {
+        return;
+    }
+
+    ParticleRenderer::BeginScene(viewProjection);
+
+    auto view = m_registry.view<TransformComponent, ParticleEmitterComponent>();
+    for (auto entity : view)
+    {
+        auto [transform, emitter] = view.get<TransformComponent, ParticleEmitterComponent>(entity);
+        if (!emitter.gpuPool)
+        {
+            ParticleRenderer::Draw(emitter.pool, emitter.props, transform.position.z);
+            continue;
+        }
+
+        emitter.gpuPool->Emit(emitter.gpuPendingEmit, transform.position, emitter.props);
+        ParticleRenderer::Simulate(*emitter.gpuPool, emitter.gpuPendingTime, emitter.props.gravity);
+        emitter.gpuPendingEmit = 0;
+        emitter.gpuPendingTime = 0.0f;
+
+        ParticleRenderer::Draw(*emitter.gpuPool, emitter.props, transform.position.z);
+    }
+}
 
 
 /*********************************************************************************************************************/
@@ -30,6 +30,12 @@
 
 #include "Brigerad/Core/Timestep.h"
 #include "Brigerad/Events/Event.h"
+#include "Brigerad/Renderer/StaticBatch.h"
+#include "Brigerad/Scene/SystemScheduler.h"
+
+#include "glm/glm.hpp"
+
+#include <vector>
 
 
 /*********************************************************************************************************************/
@@ -44,6 +50,8 @@ namespace Brigerad
 {
 
 class Entity;
+class LuaScriptEntity;
+struct TransformComponent;
 
 class Scene
 {
@@ -57,6 +65,26 @@ public:
 
     entt::registry& Reg() { return m_registry; }
 
+    /**
+     * The systems run by OnUpdate. The scene starts with "NativeScripts", "LuaScripts",
+     * "Animation", "Particles" and "Render2D", in that order; add a system before "Render2D" to
+     * have it rendered in the same frame.
+     */
+    SystemScheduler& GetSystems() { return m_systems; }
+    /** The systems run by OnFixedUpdate, at the fixed rate of the simulation. Empty by default. */
+    SystemScheduler& GetFixedSystems() { return m_fixedSystems; }
+
+    /**
+     * Whether rendering the scene again would give a different image: entities or components
+     * were added or removed, the viewport changed, a tilemap was edited, or scripts, animations,
+     * particles or fixed systems might have moved things, the latter even after OnUpdate.
+     * Components modified in place, through GetComponentRef or by a system, must be reported
+     * with MarkDirty. OnUpdate clears it.
+     */
+    bool IsDirty() const;
+    void MarkDirty() { m_isDirty = true; }
+
+    void OnFixedUpdate(Timestep ts);
     void OnUpdate(Timestep ts);
     void OnImguiRender();
     void OnViewportResize(uint32_t w, uint32_t h);
@@ -68,10 +96,32 @@ private:
 
     void HandleImGuiEntity(Entity entity);
 
+    void UpdateNativeScripts(Timestep ts);
+    void UpdateLuaScripts(Timestep ts);
+    void UpdateAnimations(Timestep ts);
+    void UpdateParticles(Timestep ts);
+    void UpdateStaticBatch();
+    void Render2D();
+    void RenderParticles(const glm::mat4& viewProjection);
+
 private:
-    entt::registry m_registry;
+    entt::registry  m_registry;
+    SystemScheduler m_systems;
+    SystemScheduler m_fixedSystems;
     uint32_t       m_viewportWidth  = 0;
     uint32_t       m_viewportHeight = 0;
+    bool           m_isDirty        = true;
+
+    // Scratch space to compute the transforms of the rendered entities in batches.
+    std::vector<glm::mat4>                 m_transforms;
+    std::vector<const TransformComponent*> m_gatheredTransforms;
+
+    // The entities with a StaticComponent, baked.
+    StaticBatch m_staticBatch;
+    size_t      m_bakedStaticCount = 0;
+
+    // Scratch space to hand the Lua scripts over to ScriptEngine::Update.
+    std::vector<LuaScriptEntity*> m_luaScripts;
 
     friend class Entity;
     friend class SceneSerializer;
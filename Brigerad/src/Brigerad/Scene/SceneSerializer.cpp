@@ -42,6 +42,13 @@ namespace Brigerad
 // [SECTION] Private Macro Definitions
 /*********************************************************************************************************************/
 
+YAML::Emitter& operator<<(YAML::Emitter& out, const glm::vec2& v)
+{
+    out << YAML::Flow;
+    out << YAML::BeginSeq << v.x << v.y << YAML::EndSeq;
+    return out;
+}
+
 YAML::Emitter& operator<<(YAML::Emitter& out, const glm::vec3& v)
 {
     out << YAML::Flow;
@@ -80,6 +87,15 @@ static void DeserializeColorRendererComponent(const YAML::Node& node, Entity ent
 static void SerializeTextureRendererComponent(YAML::Emitter& out, Entity entity);
 static void DeserializeTextureRendererComponent(const YAML::Node& node, Entity entity);
 
+static void SerializeStaticComponent(YAML::Emitter& out, Entity entity);
+static void DeserializeStaticComponent(const YAML::Node& node, Entity entity);
+
+static void SerializeAnimatedSpriteComponent(YAML::Emitter& out, Entity entity);
+static void DeserializeAnimatedSpriteComponent(const YAML::Node& node, Entity entity);
+
+static void SerializeParticleEmitterComponent(YAML::Emitter& out, Entity entity);
+static void DeserializeParticleEmitterComponent(const YAML::Node& node, Entity entity);
+
 static void SerializeCameraComponent(YAML::Emitter& out, Entity entity);
 static void DeserializeCameraComponent(const YAML::Node& node, Entity entity);
 
@@ -259,6 +275,21 @@ static void SerializeEntity(YAML::Emitter& out, Entity entity)
         SerializeTextureRendererComponent(out, entity);
     }
 
+    if (entity.HasComponent<StaticComponent>())
+    {
+        SerializeStaticComponent(out, entity);
+    }
+
+    if (entity.HasComponent<AnimatedSpriteComponent>())
+    {
+        SerializeAnimatedSpriteComponent(out, entity);
+    }
+
+    if (entity.HasComponent<ParticleEmitterComponent>())
+    {
+        SerializeParticleEmitterComponent(out, entity);
+    }
+
     if (entity.HasComponent<CameraComponent>())
     {
         SerializeCameraComponent(out, entity);
@@ -309,6 +340,21 @@ static void DeserializeEntity(const YAML::Node& node, Entity entity)
         DeserializeTextureRendererComponent(node["TextureRendererComponent"], entity);
     }
 
+    if (node["StaticComponent"])
+    {
+        DeserializeStaticComponent(node["StaticComponent"], entity);
+    }
+
+    if (node["AnimatedSpriteComponent"])
+    {
+        DeserializeAnimatedSpriteComponent(node["AnimatedSpriteComponent"], entity);
+    }
+
+    if (node["ParticleEmitterComponent"])
+    {
+        DeserializeParticleEmitterComponent(node["ParticleEmitterComponent"], entity);
+    }
+
     if (node["CameraComponent"])
     {
         DeserializeCameraComponent(node["CameraComponent"], entity);
@@ -443,6 +489,102 @@ static void DeserializeTextureRendererComponent(const YAML::Node& node, Entity e
     entity.AddComponent<TextureRendererComponent>(path);
 }
 
+static void SerializeStaticComponent(YAML::Emitter& out, Entity entity)
+{
+    // Only a marker, what was baked is rebuilt on load.
+    out << YAML::Key << "StaticComponent";
+    out << YAML::BeginMap;    // StaticComponent.
+    out << YAML::EndMap;      // StaticComponent.
+}
+
+static void DeserializeStaticComponent(const YAML::Node& node, Entity entity)
+{
+    entity.AddComponent<StaticComponent>();
+}
+
+static void SerializeAnimatedSpriteComponent(YAML::Emitter& out, Entity entity)
+{
+    auto& asc = entity.GetComponent<AnimatedSpriteComponent>();
+    if (!asc.sheet || asc.sheet->GetPath().empty())
+    {
+        BR_CORE_WARN("Sprite sheets built by hand can't be saved, skipping the animated sprite.");
+        return;
+    }
+
+    out << YAML::Key << "AnimatedSpriteComponent";
+    out << YAML::BeginMap;    // AnimatedSpriteComponent.
+
+    out << YAML::Key << "Sheet" << YAML::Value << asc.sheet->GetPath();
+    out << YAML::Key << "Clip" << YAML::Value << (asc.clip != nullptr ? asc.clip->name : "");
+    out << YAML::Key << "Tint" << YAML::Value << asc.tint;
+    out << YAML::Key << "Speed" << YAML::Value << asc.speed;
+    out << YAML::Key << "OnGpu" << YAML::Value << asc.onGpu;
+
+    out << YAML::EndMap;    // AnimatedSpriteComponent.
+}
+
+static void DeserializeAnimatedSpriteComponent(const YAML::Node& node, Entity entity)
+{
+    auto& asc = entity.AddComponent<AnimatedSpriteComponent>();
+    asc.sheet = SpriteSheet::Load(node["Sheet"].as<std::string>());
+    asc.tint  = node["Tint"].as<glm::vec4>(glm::vec4(1.0f));
+    asc.speed = node["Speed"].as<float>(1.0f);
+
+    std::string clip = node["Clip"].as<std::string>("");
+    if (asc.sheet && !clip.empty())
+    {
+        asc.Play(clip, node["OnGpu"].as<bool>(false));
+    }
+}
+
+static void SerializeParticleEmitterComponent(YAML::Emitter& out, Entity entity)
+{
+    out << YAML::Key << "ParticleEmitterComponent";
+    out << YAML::BeginMap;    // ParticleEmitterComponent.
+
+    auto&                pec   = entity.GetComponent<ParticleEmitterComponent>();
+    const ParticleProps& props = pec.props;
+    out << YAML::Key << "PositionVariation" << YAML::Value << props.positionVariation;
+    out << YAML::Key << "Velocity" << YAML::Value << props.velocity;
+    out << YAML::Key << "VelocityVariation" << YAML::Value << props.velocityVariation;
+    out << YAML::Key << "Gravity" << YAML::Value << props.gravity;
+    out << YAML::Key << "AngularVelocity" << YAML::Value << props.angularVelocity;
+    out << YAML::Key << "ColorBegin" << YAML::Value << props.colorBegin;
+    out << YAML::Key << "ColorEnd" << YAML::Value << props.colorEnd;
+    out << YAML::Key << "SizeBegin" << YAML::Value << props.sizeBegin;
+    out << YAML::Key << "SizeEnd" << YAML::Value << props.sizeEnd;
+    out << YAML::Key << "Lifetime" << YAML::Value << props.lifetime;
+    out << YAML::Key << "LifetimeVariation" << YAML::Value << props.lifetimeVariation;
+    out << YAML::Key << "EmissionRate" << YAML::Value << props.emissionRate;
+
+    out << YAML::Key << "MaxParticles" << YAML::Value << pec.GetCapacity();
+    out << YAML::Key << "OnGpu" << YAML::Value << (pec.gpuPool != nullptr);
+    out << YAML::Key << "Emitting" << YAML::Value << pec.isEmitting;
+
+    out << YAML::EndMap;    // ParticleEmitterComponent.
+}
+
+static void DeserializeParticleEmitterComponent(const YAML::Node& node, Entity entity)
+{
+    ParticleProps props;
+    props.positionVariation = node["PositionVariation"].as<glm::vec2>(props.positionVariation);
+    props.velocity          = node["Velocity"].as<glm::vec2>(props.velocity);
+    props.velocityVariation = node["VelocityVariation"].as<glm::vec2>(props.velocityVariation);
+    props.gravity           = node["Gravity"].as<glm::vec2>(props.gravity);
+    props.angularVelocity   = node["AngularVelocity"].as<float>(props.angularVelocity);
+    props.colorBegin        = node["ColorBegin"].as<glm::vec4>(props.colorBegin);
+    props.colorEnd          = node["ColorEnd"].as<glm::vec4>(props.colorEnd);
+    props.sizeBegin         = node["SizeBegin"].as<float>(props.sizeBegin);
+    props.sizeEnd           = node["SizeEnd"].as<float>(props.sizeEnd);
+    props.lifetime          = node["Lifetime"].as<float>(props.lifetime);
+    props.lifetimeVariation = node["LifetimeVariation"].as<float>(props.lifetimeVariation);
+    props.emissionRate      = node["EmissionRate"].as<float>(props.emissionRate);
+
+    auto& pec = entity.AddComponent<ParticleEmitterComponent>(
+      props, node["MaxParticles"].as<uint32_t>(10000), node["OnGpu"].as<bool>(false));
+    pec.isEmitting = node["Emitting"].as<bool>(true);
+}
+
 static void SerializeCameraComponent(YAML::Emitter& out, Entity entity)
 {
     out << YAML::Key << "CameraComponent";
@@ -0,0 +1,199 @@
+/**
+ * @file    SpriteAnimation.cpp
+ * @author  Samuel Martel
+ * @p       https://github.com/smartel99/
+ * @date    10/19/2026 6:05:00 PM
+ *
+ * @brief
+ ******************************************************************************
+ * Copyright (C) 2020  Samuel Martel
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *****************************************************************************/
+
+/*********************************************************************************************************************/
+// [SECTION] Includes
+/*********************************************************************************************************************/
+#include "brpch.h"
+#include "SpriteAnimation.h"
+
+#include "YamlConverters.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+
+namespace Brigerad
+{
+/*********************************************************************************************************************/
+// [SECTION] Public Method Definitions
+/*********************************************************************************************************************/
+uint32_t SpriteAnimationClip::GetFrameAt(float time) const
+{
+    auto it = std::upper_bound(frameEnds.begin(), frameEnds.end(), time);
+    if (it == frameEnds.end())
+    {
+        return frames.empty() ? 0 : GetFrameCount() - 1;
+    }
+    return uint32_t(it - frameEnds.begin());
+}
+
+SpriteSheet::SpriteSheet(const Ref<Texture2D>& texture, const glm::vec2& cellSize)
+: m_texture(texture), m_cellSize(cellSize)
+{
+}
+
+Ref<SpriteSheet> SpriteSheet::Load(const std::string& path)
+{
+    BR_PROFILE_FUNCTION();
+
+    std::ifstream stream(path);
+    if (!stream.is_open())
+    {
+        BR_CORE_ERROR("Unable to open sprite sheet '{}'!", path);
+        return nullptr;
+    }
+    std::stringstream ss;
+    ss << stream.rdbuf();
+
+    YAML::Node data;
+    try
+    {
+        data = YAML::Load(ss.str());
+    }
+    catch (const YAML::Exception& e)
+    {
+        BR_CORE_ERROR("Invalid sprite sheet '{}': {}", path, e.what());
+        return nullptr;
+    }
+
+    if (!data["Texture"] || !data["CellSize"])
+    {
+        BR_CORE_ERROR("Sprite sheet '{}' needs a Texture and a CellSize!", path);
+        return nullptr;
+    }
+
+    Ref<Texture2D> texture = Texture2D::Create(data["Texture"].as<std::string>());
+    auto           sheet   = CreateRef<SpriteSheet>(texture, data["CellSize"].as<glm::vec2>());
+    sheet->m_path          = path;
+
+    for (const auto& clip : data["Clips"])
+    {
+        std::string name            = clip["Name"].as<std::string>();
+        bool        loop            = clip["Loop"].as<bool>(true);
+        float       defaultDuration = clip["FrameDuration"].as<float>(0.1f);
+
+        std::vector<Ref<SubTexture2D>> frames;
+        std::vector<float>             durations;
+        for (const auto& frame : clip["Frames"])
+        {
+            if (frame["UV"])
+            {
+                glm::vec4 uv = frame["UV"].as<glm::vec4>();
+                frames.push_back(CreateRef<SubTexture2D>(
+                  texture, glm::vec2 {uv.x, uv.y}, glm::vec2 {uv.z, uv.w}));
+            }
+            else if (frame["Cell"])
+            {
+                frames.push_back(SubTexture2D::CreateFromCoords(texture,
+                                                                frame["Cell"].as<glm::vec2>(),
+                                                                sheet->m_cellSize,
+                                                                frame["Size"].as<glm::vec2>(
+                                                                  glm::vec2 {1.0f, 1.0f})));
+            }
+            else
+            {
+                BR_CORE_WARN("Frame of clip '{}' in '{}' has no Cell nor UV, skipping it.",
+                             name,
+                             path);
+                continue;
+            }
+            durations.push_back(frame["Duration"].as<float>(defaultDuration));
+        }
+
+        sheet->AddClip(name, frames, durations, loop);
+    }
+
+    return sheet;
+}
+
+const SpriteAnimationClip& SpriteSheet::AddClip(const std::string&                    name,
+                                                const std::vector<Ref<SubTexture2D>>& frames,
+                                                const std::vector<float>&             durations,
+                                                bool                                  loop)
+{
+    BR_CORE_ASSERT(frames.size() == durations.size(), "Every frame needs a duration!");
+
+    SpriteAnimationClip& clip = m_clips[name];
+    clip.name                 = name;
+    clip.frames               = frames;
+    clip.loop                 = loop;
+
+    clip.frameEnds.resize(durations.size());
+    float end = 0.0f;
+    for (size_t i = 0; i < durations.size(); i++)
+    {
+        end += durations[i];
+        clip.frameEnds[i] = end;
+    }
+
+    // Check if the vertex shader can walk through the frames by itself: same duration and same
+    // size for every frame, each one the same distance to the right of the previous one.
+    clip.isGpuCompatible = loop && frames.size() > 1;
+    clip.frameStep       = 0.0f;
+    if (clip.isGpuCompatible)
+    {
+        constexpr float epsilon = 1e-5f;
+
+        const glm::vec2* first = frames[0]->GetTexCoords();
+        clip.frameStep         = frames[1]->GetTexCoords()[0].x - first[0].x;
+        for (size_t i = 1; i < frames.size() && clip.isGpuCompatible; i++)
+        {
+            const glm::vec2* coords = frames[i]->GetTexCoords();
+            for (int v = 0; v < 4; v++)
+            {
+                glm::vec2 expected = first[v] + glm::vec2 {clip.frameStep * float(i), 0.0f};
+                clip.isGpuCompatible &= glm::all(glm::lessThan(glm::abs(coords[v] - expected),
+                                                               glm::vec2(epsilon)));
+            }
+            clip.isGpuCompatible &= std::abs(durations[i] - durations[0]) < epsilon;
+            clip.isGpuCompatible &= *frames[i]->GetTexture() == *frames[0]->GetTexture();
+        }
+    }
+
+    return clip;
+}
+
+const SpriteAnimationClip& SpriteSheet::AddClip(const std::string&            name,
+                                                const std::vector<glm::vec2>& cells,
+                                                float                         frameDuration,
+                                                bool                          loop)
+{
+    std::vector<Ref<SubTexture2D>> frames;
+    frames.reserve(cells.size());
+    for (const auto& cell : cells)
+    {
+        frames.push_back(SubTexture2D::CreateFromCoords(m_texture, cell, m_cellSize));
+    }
+
+    return AddClip(name, frames, std::vector<float>(cells.size(), frameDuration), loop);
+}
+
+const SpriteAnimationClip* SpriteSheet::GetClip(const std::string& name) const
+{
+    auto it = m_clips.find(name);
+    return it != m_clips.end() ? &it->second : nullptr;
+}
+}    // namespace Brigerad
@@ -0,0 +1,122 @@
+/**
+ * @file    SpriteAnimation.h
+ * @author  Samuel Martel
+ * @p       https://github.com/smartel99/
+ * @date    10/19/2026 6:05:00 PM
+ *
+ * @brief
+ ******************************************************************************
+ * Copyright (C) 2020  Samuel Martel
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *****************************************************************************/
+#pragma once
+
+/*********************************************************************************************************************/
+// [SECTION] Includes
+/*********************************************************************************************************************/
+#include "Brigerad/Renderer/SubTexture2D.h"
+#include "Brigerad/Renderer/Texture.h"
+
+#include "glm/glm.hpp"
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Brigerad
+{
+/*********************************************************************************************************************/
+// [SECTION] Class Declarations
+/*********************************************************************************************************************/
+/**
+ * Sequence of frames of a sprite sheet, each shown for its own duration.
+ */
+struct SpriteAnimationClip
+{
+    std::string                    name;
+    std::vector<Ref<SubTexture2D>> frames;
+    // Time at which each frame ends, in seconds from the start of the clip.
+    std::vector<float> frameEnds;
+    bool               loop = true;
+
+    // The vertex shader can only animate looping clips whose frames all last the same time and sit
+    // side by side in a row of the sheet, frameStep apart.
+    bool  isGpuCompatible = false;
+    float frameStep       = 0.0f;
+
+    float    GetDuration() const { return frameEnds.empty() ? 0.0f : frameEnds.back(); }
+    uint32_t GetFrameCount() const { return uint32_t(frames.size()); }
+    /** Frame shown at a time in the clip, time being already wrapped for looping clips. */
+    uint32_t GetFrameAt(float time) const;
+};
+
+/**
+ * Texture cut in a grid of cells, along with the animation clips made from these cells.
+ *
+ * Sheets are usually loaded from a YAML file:
+ * @code
+ * Texture: assets/textures/gauge.png
+ * CellSize: [64, 64]
+ * Clips:
+ *   - Name: Idle
+ *     Loop: true
+ *     FrameDuration: 0.1           # For the frames that don't have their own Duration.
+ *     Frames:
+ *       - Cell: [0, 0]             # Column, row of the cell, from the bottom-left of the sheet.
+ *       - Cell: [1, 0]
+ *         Size: [1, 2]             # In cells, [1, 1] by default.
+ *         Duration: 0.25
+ *       - UV: [0.5, 0.0, 0.75, 0.5]   # Min U, min V, max U, max V.
+ * @endcode
+ */
+class SpriteSheet
+{
+public:
+    SpriteSheet(const Ref<Texture2D>& texture, const glm::vec2& cellSize);
+
+    /** Load a sheet and its clips from a YAML file. Returns nullptr if the file is invalid. */
+    static Ref<SpriteSheet> Load(const std::string& path);
+
+    /**
+     * Add a clip made of the given frames, replacing the clip with the same name if there is one.
+     * Pointers to the other clips stay valid.
+     */
+    const SpriteAnimationClip& AddClip(const std::string&                    name,
+                                       const std::vector<Ref<SubTexture2D>>& frames,
+                                       const std::vector<float>&             durations,
+                                       bool                                  loop = true);
+    /** Add a clip made of cells of the sheet, every frame lasting frameDuration. */
+    const SpriteAnimationClip& AddClip(const std::string&            name,
+                                       const std::vector<glm::vec2>& cells,
+                                       float                         frameDuration,
+                                       bool                          loop = true);
+
+    /** Returns nullptr if the sheet has no clip with that name. */
+    const SpriteAnimationClip* GetClip(const std::string& name) const;
+
+    const Ref<Texture2D>& GetTexture() const { return m_texture; }
+    const glm::vec2&      GetCellSize() const { return m_cellSize; }
+    /** The file the sheet was loaded from, empty if it was built by hand. */
+    const std::string& GetPath() const { return m_path; }
+
+private:
+    Ref<Texture2D> m_texture;
+    glm::vec2      m_cellSize;
+    std::string    m_path;
+    // Node based, so the clips never move once added.
+    std::unordered_map<std::string, SpriteAnimationClip> m_clips;
+};
+}    // namespace Brigerad
@@ -0,0 +1,244 @@
+/**
+ * @file    SystemScheduler.cpp
+ * @author  Samuel Martel
+ * @p       https://github.com/smartel99
+ * @date    10/19/2026 3:40:00 PM
+ *
+ * @brief
+ ******************************************************************************
+ * Copyright (C) 2020  Samuel Martel
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *****************************************************************************/
+
+/*********************************************************************************************************************/
+// [SECTION] Includes
+/*********************************************************************************************************************/
+#include "brpch.h"
+#include "SystemScheduler.h"
+
+#include "Scene.h"
+
+#include <chrono>
+
+namespace Brigerad
+{
+/*********************************************************************************************************************/
+// [SECTION] Public Method Definitions
+/*********************************************************************************************************************/
+bool SystemAccess::ConflictsWith(const SystemAccess& other) const
+{
+    return m_exclusive || other.m_exclusive || Intersects(m_writes, other.m_writes) ||
+           Intersects(m_writes, other.m_reads) || Intersects(m_reads, other.m_writes);
+}
+
+void SystemAccess::PreparePools(entt::registry& registry) const
+{
+    for (const auto& component : m_reads)
+    {
+        component.prepare(registry);
+    }
+    for (const auto& component : m_writes)
+    {
+        component.prepare(registry);
+    }
+}
+
+void SystemScheduler::Add(const std::string&  name,
+                          const SystemAccess& access,
+                          SystemFn            fn,
+                          const std::string&  before)
+{
+    auto byName = [](const std::string& n) { return [&n](const System& s) { return s.name == n; }; };
+    BR_CORE_ASSERT(std::find_if(m_systems.begin(), m_systems.end(), byName(name)) ==
+                     m_systems.end(),
+                   "A system with that name already exists!");
+
+    auto it = m_systems.end();
+    if (!before.empty())
+    {
+        it = std::find_if(m_systems.begin(), m_systems.end(), byName(before));
+        if (it == m_systems.end())
+        {
+            BR_CORE_WARN("No system named '{}', adding '{}' last.", before, name);
+        }
+    }
+
+    m_systems.insert(it, System {name, access, std::move(fn)});
+    m_isDirty = true;
+}
+
+bool SystemScheduler::Remove(const std::string& name)
+{
+    auto it = std::find_if(
+      m_systems.begin(), m_systems.end(), [&name](const System& s) { return s.name == name; });
+    if (it == m_systems.end())
+    {
+        return false;
+    }
+
+    m_systems.erase(it);
+    m_isDirty = true;
+    return true;
+}
+
+void SystemScheduler::Run(Scene& scene, Timestep ts)
+{
+    BR_PROFILE_FUNCTION();
+
+    if (m_isDirty)
+    {
+        Build();
+    }
+    if (m_systems.empty())
+    {
+        return;
+    }
+
+    for (const auto& system : m_systems)
+    {
+        system.access.PreparePools(scene.Reg());
+    }
+
+    std::unique_lock lock(m_mutex);
+    m_scene     = &scene;
+    m_ts        = ts;
+    m_doneCount = 0;
+    m_pending   = m_predecessorCount;
+    m_mainThreadReady.clear();
+    for (size_t i = 0; i < m_systems.size(); i++)
+    {
+        if (m_pending[i] == 0)
+        {
+            Dispatch(i);
+        }
+    }
+
+    // Run the main thread systems as they become ready, until every system is done.
+    while (m_doneCount != m_systems.size())
+    {
+        m_cv.wait(lock,
+                  [this] { return !m_mainThreadReady.empty() || m_doneCount == m_systems.size(); });
+
+        while (!m_mainThreadReady.empty())
+        {
+            size_t index = m_mainThreadReady.back();
+            m_mainThreadReady.pop_back();
+
+            lock.unlock();
+            RunSystem(index);
+            lock.lock();
+            Complete(index);
+        }
+    }
+    m_scene = nullptr;
+}
+
+/*********************************************************************************************************************/
+// [SECTION] Private Method Definitions
+/*********************************************************************************************************************/
+bool SystemAccess::Intersects(const std::vector<Component>& a, const std::vector<Component>& b)
+{
+    for (const auto& ca : a)
+    {
+        for (const auto& cb : b)
+        {
+            if (ca.id == cb.id)
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void SystemScheduler::Build()
+{
+    size_t count = m_systems.size();
+    m_successors.assign(count, {});
+    m_predecessorCount.assign(count, 0);
+
+    bool hasWorkerSystem = false;
+    for (size_t i = 0; i < count; i++)
+    {
+        hasWorkerSystem |= !m_systems[i].access.IsOnMainThread();
+
+        // Every conflicting system added before this one must be done before it starts.
+        for (size_t j = 0; j < i; j++)
+        {
+            if (m_systems[j].access.ConflictsWith(m_systems[i].access))
+            {
+                m_successors[j].push_back(i);
+                m_predecessorCount[i]++;
+            }
+        }
+    }
+
+    // Only spin up the workers once there is something to give them.
+    if (hasWorkerSystem && m_pool == nullptr)
+    {
+        m_pool = &ThreadPool::GetShared();
+    }
+
+    m_isDirty = false;
+}
+
+// Must be called with m_mutex held.
+void SystemScheduler::Dispatch(size_t index)
+{
+    if (m_systems[index].access.IsOnMainThread() || m_pool == nullptr)
+    {
+        m_mainThreadReady.push_back(index);
+        m_cv.notify_one();
+    }
+    else
+    {
+        m_pool->Submit([this, index] {
+            RunSystem(index);
+            std::lock_guard lock(m_mutex);
+            Complete(index);
+        });
+    }
+}
+
+void SystemScheduler::RunSystem(size_t index)
+{
+    System& system = m_systems[index];
+    auto    start  = std::chrono::high_resolution_clock::now();
+    {
+        BR_PROFILE_SCOPE(system.name.c_str());
+        system.fn(*m_scene, m_ts);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    system.lastTimeMs = std::chrono::duration<float, std::milli>(end - start).count();
+}
+
+// Must be called with m_mutex held.
+void SystemScheduler::Complete(size_t index)
+{
+    for (size_t successor : m_successors[index])
+    {
+        if (--m_pending[successor] == 0)
+        {
+            Dispatch(successor);
+        }
+    }
+
+    if (++m_doneCount == m_systems.size())
+    {
+        m_cv.notify_one();
+    }
+}
+}    // namespace Brigerad
@@ -0,0 +1,186 @@
+/**
+ * @file    SystemScheduler.h
+ * @author  Samuel Martel
+ * @p       https://github.com/smartel99
+ * @date    10/19/2026 3:40:00 PM
+ *
+ * @brief
+ ******************************************************************************
+ * Copyright (C) 2020  Samuel Martel
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *****************************************************************************/
+#pragma once
+
+/*********************************************************************************************************************/
+// [SECTION] Includes
+/*********************************************************************************************************************/
+#include "Brigerad/Core/Core.h"
+#include "Brigerad/Core/Timestep.h"
+#include "Brigerad/Utils/ThreadPool.h"
+
+#include "entt.hpp"
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Brigerad
+{
+/*********************************************************************************************************************/
+// [SECTION] Class Declarations
+/*********************************************************************************************************************/
+class Scene;
+
+/**
+ * The components a system reads and writes, which tells the scheduler which systems can run at the
+ * same time.
+ *
+ * A system running on a worker must only access the components it declared and must not create
+ * or destroy entities, nor add or remove components. Systems that do must be Exclusive.
+ */
+class SystemAccess
+{
+public:
+    template<typename... Components>
+    SystemAccess& Reads()
+    {
+        (Add<Components>(m_reads), ...);
+        return *this;
+    }
+
+    template<typename... Components>
+    SystemAccess& Writes()
+    {
+        (Add<Components>(m_writes), ...);
+        return *this;
+    }
+
+    /** The system must run on the thread that updates the scene, e.g. to use OpenGL or Lua. */
+    SystemAccess& OnMainThread()
+    {
+        m_mainThread = true;
+        return *this;
+    }
+
+    /** The system can touch anything: it runs alone, on the main thread. */
+    SystemAccess& Exclusive()
+    {
+        m_exclusive  = true;
+        m_mainThread = true;
+        return *this;
+    }
+
+    bool IsOnMainThread() const { return m_mainThread; }
+    bool IsExclusive() const { return m_exclusive; }
+
+    /** Two systems conflict if either is exclusive or if one writes what the other accesses. */
+    bool ConflictsWith(const SystemAccess& other) const;
+
+    /**
+     * Create the pools of the declared components that don't exist yet, since the registry
+     * creates them lazily and that must not happen from two threads at once.
+     */
+    void PreparePools(entt::registry& registry) const;
+
+private:
+    struct Component
+    {
+        entt::id_type id;
+        void (*prepare)(entt::registry&);
+    };
+
+    template<typename T>
+    static void Add(std::vector<Component>& list)
+    {
+        list.push_back({entt::type_info<T>::id(), [](entt::registry& r) { r.prepare<T>(); }});
+    }
+
+    static bool Intersects(const std::vector<Component>& a, const std::vector<Component>& b);
+
+private:
+    std::vector<Component> m_reads;
+    std::vector<Component> m_writes;
+    bool                   m_mainThread = false;
+    bool                   m_exclusive  = false;
+};
+
+/**
+ * Runs the systems of a scene every frame, in parallel when their accesses allow it.
+ *
+ * When two systems conflict, the one added first always runs first, so the order in which
+ * systems are added is the order in which they see each other's changes. Systems that don't
+ * conflict run at the same time on the shared pool of workers, except for the main thread systems
+ * which run on the thread calling Run.
+ *
+ * Each system is timed in the profiler under its name.
+ */
+class SystemScheduler
+{
+public:
+    using SystemFn = std::function<void(Scene&, Timestep)>;
+
+    struct System
+    {
+        std::string  name;
+        SystemAccess access;
+        SystemFn     fn;
+        float        lastTimeMs = 0.0f;    // Duration of the last run.
+    };
+
+    SystemScheduler()  = default;
+    ~SystemScheduler() = default;
+
+    /**
+     * Add a system after the existing ones, or right before the system named before.
+     * Names must be unique.
+     */
+    void Add(const std::string&  name,
+             const SystemAccess& access,
+             SystemFn            fn,
+             const std::string&  before = "");
+    bool Remove(const std::string& name);
+
+    /** Run every system once, returns when they are all done. */
+    void Run(Scene& scene, Timestep ts);
+
+    const std::vector<System>& GetSystems() const { return m_systems; }
+
+private:
+    void Build();
+    void Dispatch(size_t index);
+    void RunSystem(size_t index);
+    void Complete(size_t index);
+
+private:
+    std::vector<System> m_systems;
+
+    // Dependency graph, rebuilt when systems are added or removed.
+    bool                             m_isDirty = true;
+    std::vector<std::vector<size_t>> m_successors;
+    std::vector<size_t>              m_predecessorCount;
+    ThreadPool*                      m_pool = nullptr;    // The shared one, see ThreadPool.
+
+    // State of the current run, guarded by m_mutex.
+    std::mutex              m_mutex;
+    std::condition_variable m_cv;
+    std::vector<size_t>     m_pending;
+    std::vector<size_t>     m_mainThreadReady;
+    size_t                  m_doneCount = 0;
+    Scene*                  m_scene     = nullptr;
+    Timestep                m_ts;
+};
+}    // namespace Brigerad
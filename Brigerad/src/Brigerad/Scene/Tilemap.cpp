@@ -0,0 +1,233 @@
+/**
+ * @file    Tilemap.cpp
+ * @author  Samuel Martel
+ * @p       https://github.com/smartel99
+ * @date    10/19/2026 5:10:00 PM
+ *
+ * @brief
+ ******************************************************************************
+ * Copyright (C) 2020  Samuel Martel
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *****************************************************************************/
+
+/*********************************************************************************************************************/
+// [SECTION] Includes
+/*********************************************************************************************************************/
+#include "brpch.h"
+#include "Tilemap.h"
+
+#include "Brigerad/Renderer/Renderer2D.h"
+
+#include "glm/gtc/matrix_transform.hpp"
+
+#include <limits>
+
+namespace Brigerad
+{
+/*********************************************************************************************************************/
+// [SECTION] Public Method Definitions
+/*********************************************************************************************************************/
+Tilemap::Tilemap(const Ref<Texture2D>& tileset,
+                 const glm::vec2&      cellSize,
+                 const glm::vec2&      tileSize)
+: m_tileSize(tileSize)
+{
+    SetTileset(tileset, cellSize);
+}
+
+void Tilemap::SetTileset(const Ref<Texture2D>& tileset, const glm::vec2& cellSize)
+{
+    m_tileset  = tileset;
+    m_cellSize = cellSize;
+
+    m_cells.clear();
+    if (m_tileset)
+    {
+        uint32_t columns = uint32_t(m_tileset->GetWidth() / cellSize.x);
+        uint32_t rows    = uint32_t(m_tileset->GetHeight() / cellSize.y);
+        m_cells.reserve(size_t(columns) * rows);
+        for (uint32_t y = 0; y < rows; y++)
+        {
+            for (uint32_t x = 0; x < columns; x++)
+            {
+                m_cells.push_back(SubTexture2D::CreateFromCoords(
+                  m_tileset, {float(x), float(y)}, cellSize));
+            }
+        }
+    }
+
+    MarkAllDirty();
+}
+
+void Tilemap::SetTileSize(const glm::vec2& tileSize)
+{
+    m_tileSize = tileSize;
+    MarkAllDirty();
+}
+
+void Tilemap::SetTile(int32_t x, int32_t y, Tile tile)
+{
+    int32_t chunkX = ChunkCoord(x);
+    int32_t chunkY = ChunkCoord(y);
+    auto    it     = m_chunks.find(ChunkKey(chunkX, chunkY));
+    if (it == m_chunks.end())
+    {
+        if (tile == 0)
+        {
+            return;
+        }
+        it = m_chunks.emplace(ChunkKey(chunkX, chunkY), Chunk()).first;
+    }
+
+    Chunk& chunk = it->second;
+    Tile&  slot =
+      chunk.tiles[(y - chunkY * s_chunkSize) * s_chunkSize + (x - chunkX * s_chunkSize)];
+    if (slot == tile)
+    {
+        return;
+    }
+
+    chunk.tileCount += (tile != 0) - (slot != 0);
+    slot          = tile;
+    chunk.isDirty = true;
+    m_isEdited    = true;
+
+    // Don't keep buffers around for chunks that were erased.
+    if (chunk.tileCount == 0)
+    {
+        m_chunks.erase(it);
+    }
+}
+
+Tilemap::Tile Tilemap::GetTile(int32_t x, int32_t y) const
+{
+    int32_t chunkX = ChunkCoord(x);
+    int32_t chunkY = ChunkCoord(y);
+    auto    it     = m_chunks.find(ChunkKey(chunkX, chunkY));
+    if (it == m_chunks.end())
+    {
+        return 0;
+    }
+
+    return it->second.tiles[(y - chunkY * s_chunkSize) * s_chunkSize + (x - chunkX * s_chunkSize)];
+}
+
+void Tilemap::Clear()
+{
+    m_chunks.clear();
+    m_isEdited = true;
+}
+
+void Tilemap::Render(const glm::mat4& transform, const glm::vec2& viewMin, const glm::vec2& viewMax)
+{
+    BR_PROFILE_FUNCTION();
+
+    if (transform != m_bakedTransform)
+    {
+        m_bakedTransform = transform;
+        MarkAllDirty();
+    }
+
+    m_isEdited          = false;
+    m_visibleChunkCount = 0;
+    for (auto& [key, chunk] : m_chunks)
+    {
+        if (chunk.isDirty)
+        {
+            int32_t chunkX = int32_t(uint32_t(key >> 32));
+            int32_t chunkY = int32_t(uint32_t(key));
+            BakeChunk(chunk, chunkX, chunkY, transform);
+        }
+
+        if (chunk.max.x < viewMin.x || chunk.min.x > viewMax.x || chunk.max.y < viewMin.y ||
+            chunk.min.y > viewMax.y)
+        {
+            continue;
+        }
+
+        Renderer2D::DrawStaticBatch(chunk.batch);
+        m_visibleChunkCount++;
+    }
+}
+
+/*********************************************************************************************************************/
+// [SECTION] Private Method Definitions
+/*********************************************************************************************************************/
+uint64_t Tilemap::ChunkKey(int32_t chunkX, int32_t chunkY)
+{
+    return (uint64_t(uint32_t(chunkX)) << 32) | uint32_t(chunkY);
+}
+
+// Rounds toward negative infinity, tile -1 is in chunk -1.
+int32_t Tilemap::ChunkCoord(int32_t tileCoord)
+{
+    return tileCoord >= 0 ? tileCoord / s_chunkSize : (tileCoord - s_chunkSize + 1) / s_chunkSize;
+}
+
+void Tilemap::BakeChunk(Chunk& chunk, int32_t chunkX, int32_t chunkY, const glm::mat4& transform)
+{
+    BR_PROFILE_FUNCTION();
+
+    chunk.batch.Clear();
+
+    const glm::vec2& tileScale = m_tileSize;
+    glm::mat4        scale     = glm::scale(glm::mat4(1.0f), {tileScale.x, tileScale.y, 1.0f});
+    for (int32_t y = 0; y < s_chunkSize; y++)
+    {
+        for (int32_t x = 0; x < s_chunkSize; x++)
+        {
+            Tile tile = chunk.tiles[y * s_chunkSize + x];
+            if (tile == 0 || tile > m_cells.size())
+            {
+                continue;
+            }
+
+            // The quads are centered on their position.
+            glm::vec3 center = {(chunkX * s_chunkSize + x + 0.5f) * tileScale.x,
+                                (chunkY * s_chunkSize + y + 0.5f) * tileScale.y,
+                                0.0f};
+            chunk.batch.AddQuad(
+              transform * glm::translate(glm::mat4(1.0f), center) * scale, m_cells[tile - 1]);
+        }
+    }
+    chunk.batch.Bake();
+
+    // Bounds of the transformed corners of the chunk.
+    glm::vec2 origin = {chunkX * s_chunkSize * tileScale.x, chunkY * s_chunkSize * tileScale.y};
+    glm::vec2 extent = glm::vec2(float(s_chunkSize)) * tileScale;
+    chunk.min        = glm::vec2(std::numeric_limits<float>::max());
+    chunk.max        = glm::vec2(std::numeric_limits<float>::lowest());
+    for (const glm::vec2& corner : {origin,
+                                    origin + glm::vec2 {extent.x, 0.0f},
+                                    origin + glm::vec2 {0.0f, extent.y},
+                                    origin + extent})
+    {
+        glm::vec2 world = transform * glm::vec4(corner, 0.0f, 1.0f);
+        chunk.min       = glm::min(chunk.min, world);
+        chunk.max       = glm::max(chunk.max, world);
+    }
+
+    chunk.isDirty = false;
+}
+
+void Tilemap::MarkAllDirty()
+{
+    for (auto& [key, chunk] : m_chunks)
+    {
+        chunk.isDirty = true;
+    }
+    m_isEdited = true;
+}
+}    // namespace Brigerad
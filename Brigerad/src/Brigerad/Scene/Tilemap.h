@@ -0,0 +1,126 @@
+/**
+ * @file    Tilemap.h
+ * @author  Samuel Martel
+ * @p       https://github.com/smartel99
+ * @date    10/19/2026 5:10:00 PM
+ *
+ * @brief
+ ******************************************************************************
+ * Copyright (C) 2020  Samuel Martel
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *****************************************************************************/
+#pragma once
+
+/*********************************************************************************************************************/
+// [SECTION] Includes
+/*********************************************************************************************************************/
+#include "Brigerad/Renderer/StaticBatch.h"
+#include "Brigerad/Renderer/SubTexture2D.h"
+#include "Brigerad/Renderer/Texture.h"
+
+#include "glm/glm.hpp"
+
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace Brigerad
+{
+/*********************************************************************************************************************/
+// [SECTION] Class Declarations
+/*********************************************************************************************************************/
+/**
+ * Grid of tiles taken from a single tileset texture.
+ *
+ * The tiles are stored in chunks of 32x32, each baked into its own StaticBatch. Setting a tile only
+ * marks its chunk to be baked again the next time the map is rendered, and only the chunks that
+ * overlap the view are drawn, so the cost of a frame depends on the chunks on screen rather than
+ * on the number of tiles.
+ *
+ * Tile 0 is empty. Tile n is the n-th cell of the tileset, counting from 1, left to right from
+ * the bottom row up. Tile (x, y) covers [x, x + 1] * tileSize, [y, y + 1] * tileSize in the space
+ * of the entity.
+ */
+class Tilemap
+{
+public:
+    static constexpr int32_t s_chunkSize = 32;
+
+    using Tile = uint16_t;
+
+public:
+    Tilemap() = default;
+    Tilemap(const Ref<Texture2D>& tileset,
+            const glm::vec2&      cellSize,
+            const glm::vec2&      tileSize = glm::vec2(1.0f));
+
+    /** cellSize is the size of a tile in the tileset, in pixels. */
+    void SetTileset(const Ref<Texture2D>& tileset, const glm::vec2& cellSize);
+    /** Size of a tile in the world. */
+    void SetTileSize(const glm::vec2& tileSize);
+
+    void SetTile(int32_t x, int32_t y, Tile tile);
+    Tile GetTile(int32_t x, int32_t y) const;
+    void Clear();
+
+    /**
+     * Bake the edited chunks and draw the ones that overlap the view, a rectangle in world space.
+     * Must be called between Renderer2D::BeginScene and Renderer2D::EndScene.
+     */
+    void Render(const glm::mat4& transform, const glm::vec2& viewMin, const glm::vec2& viewMax);
+
+    const Ref<Texture2D>& GetTileset() const { return m_tileset; }
+    const glm::vec2&      GetCellSize() const { return m_cellSize; }
+    const glm::vec2&      GetTileSize() const { return m_tileSize; }
+
+    /** Whether the map changed since it was last rendered. */
+    bool     IsEdited() const { return m_isEdited; }
+    size_t   GetChunkCount() const { return m_chunks.size(); }
+    uint32_t GetVisibleChunkCount() const { return m_visibleChunkCount; }
+
+private:
+    struct Chunk
+    {
+        std::array<Tile, s_chunkSize * s_chunkSize> tiles     = {};
+        uint32_t                                    tileCount = 0;
+
+        StaticBatch batch;
+        bool        isDirty = true;
+        // Bounds of the chunk in world space, when it was baked.
+        glm::vec2 min = glm::vec2(0.0f);
+        glm::vec2 max = glm::vec2(0.0f);
+    };
+
+    static uint64_t ChunkKey(int32_t chunkX, int32_t chunkY);
+    static int32_t  ChunkCoord(int32_t tileCoord);
+
+    void BakeChunk(Chunk& chunk, int32_t chunkX, int32_t chunkY, const glm::mat4& transform);
+    void MarkAllDirty();
+
+private:
+    Ref<Texture2D> m_tileset  = nullptr;
+    glm::vec2      m_cellSize = glm::vec2(1.0f);
+    glm::vec2      m_tileSize = glm::vec2(1.0f);
+
+    // Cell n - 1 of the tileset for tile n.
+    std::vector<Ref<SubTexture2D>> m_cells;
+
+    std::unordered_map<uint64_t, Chunk> m_chunks;
+    glm::mat4                           m_bakedTransform    = glm::mat4(1.0f);
+    uint32_t                            m_visibleChunkCount = 0;
+    bool                                m_isEdited          = true;
+};
+}    // namespace Brigerad
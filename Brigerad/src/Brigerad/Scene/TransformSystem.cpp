@@ -0,0 +1,383 @@
+/**
+ * @file    TransformSystem.cpp
+ * @author  Samuel Martel
+ * @p       https://github.com/smartel99
+ * @date    10/19/2026 4:00:00 PM
+ *
+ * @brief
+ ******************************************************************************
+ * Copyright (C) 2020  Samuel Martel
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *****************************************************************************/
+
+/*********************************************************************************************************************/
+// [SECTION] Includes
+/*********************************************************************************************************************/
+#include "brpch.h"
+#include "TransformSystem.h"
+
+#include <cmath>
+#include <cstring>
+
+#if defined(__AVX2__)
+#define BR_TRANSFORM_AVX2
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BR_TRANSFORM_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace Brigerad
+{
+/*********************************************************************************************************************/
+// [SECTION] Private Macro Definitions
+/*********************************************************************************************************************/
+// Transforms staged and computed together. A multiple of every SIMD width in use.
+#define BLOCK_SIZE 8
+
+/*********************************************************************************************************************/
+// [SECTION] Private Function Definitions
+/*********************************************************************************************************************/
+namespace
+{
+constexpr float s_degToRad = 0.017453292519943295f;
+constexpr float s_twoOverPi = 0.6366197723675814f;
+// pi/2 split in three parts, Cephes' DP1 to DP3 doubled: q * s_piOver2Hi and q * s_piOver2Mid are
+// exact as long as |x| <= s_maxReducedAngle.
+constexpr float s_piOver2Hi  = 1.5703125f;
+constexpr float s_piOver2Mid = 4.837512969970703125e-4f;
+constexpr float s_piOver2Lo  = 7.54978995489188216e-8f;
+// In radians, about 469000 degrees. Past that, or for inf and NaN, the reduction loses precision
+// then overflows q, the lanes are computed with std::sin and std::cos like glm::rotate does.
+constexpr float s_maxReducedAngle = 8192.0f;
+
+#if defined(BR_TRANSFORM_AVX2)
+struct Pack
+{
+    static constexpr size_t s_width = 8;
+    __m256                  v;
+
+    static Pack Load(const float* p) { return {_mm256_load_ps(p)}; }
+    static Pack Set(float f) { return {_mm256_set1_ps(f)}; }
+    void        Store(float* p) const { _mm256_store_ps(p, v); }
+};
+inline Pack operator+(Pack a, Pack b) { return {_mm256_add_ps(a.v, b.v)}; }
+inline Pack operator-(Pack a, Pack b) { return {_mm256_sub_ps(a.v, b.v)}; }
+inline Pack operator*(Pack a, Pack b) { return {_mm256_mul_ps(a.v, b.v)}; }
+inline Pack Xor(Pack a, Pack b) { return {_mm256_xor_ps(a.v, b.v)}; }
+inline Pack Select(Pack mask, Pack a, Pack b) { return {_mm256_blendv_ps(b.v, a.v, mask.v)}; }
+inline Pack IsOutOfRange(Pack x)
+{
+    __m256 abs = _mm256_andnot_ps(_mm256_set1_ps(-0.0f), x.v);
+    return {_mm256_cmp_ps(abs, _mm256_set1_ps(s_maxReducedAngle), _CMP_NLE_UQ)};
+}
+inline bool Any(Pack mask) { return _mm256_movemask_ps(mask.v) != 0; }
+
+/**
+ * Round x * 2/pi to the nearest integer q and describe in which quadrant x is:
+ * swap is set where sin and cos trade places, sinSign and cosSign hold the sign bits to apply.
+ */
+inline void Quadrant(Pack x, Pack& q, Pack& swap, Pack& sinSign, Pack& cosSign)
+{
+    __m256i qi = _mm256_cvtps_epi32(_mm256_mul_ps(x.v, _mm256_set1_ps(s_twoOverPi)));
+    __m256i one = _mm256_set1_epi32(1);
+    __m256i two = _mm256_set1_epi32(2);
+
+    q.v       = _mm256_cvtepi32_ps(qi);
+    swap.v    = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(qi, one), one));
+    sinSign.v = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(qi, two), 30));
+    cosSign.v = _mm256_castsi256_ps(
+      _mm256_slli_epi32(_mm256_and_si256(_mm256_add_epi32(qi, one), two), 30));
+}
+#elif defined(BR_TRANSFORM_SSE2)
+struct Pack
+{
+    static constexpr size_t s_width = 4;
+    __m128                  v;
+
+    static Pack Load(const float* p) { return {_mm_load_ps(p)}; }
+    static Pack Set(float f) { return {_mm_set1_ps(f)}; }
+    void        Store(float* p) const { _mm_store_ps(p, v); }
+};
+inline Pack operator+(Pack a, Pack b) { return {_mm_add_ps(a.v, b.v)}; }
+inline Pack operator-(Pack a, Pack b) { return {_mm_sub_ps(a.v, b.v)}; }
+inline Pack operator*(Pack a, Pack b) { return {_mm_mul_ps(a.v, b.v)}; }
+inline Pack Xor(Pack a, Pack b) { return {_mm_xor_ps(a.v, b.v)}; }
+inline Pack Select(Pack mask, Pack a, Pack b)
+{
+    return {_mm_or_ps(_mm_and_ps(mask.v, a.v), _mm_andnot_ps(mask.v, b.v))};
+}
+inline Pack IsOutOfRange(Pack x)
+{
+    __m128 abs = _mm_andnot_ps(_mm_set1_ps(-0.0f), x.v);
+    return {_mm_cmpnle_ps(abs, _mm_set1_ps(s_maxReducedAngle))};
+}
+inline bool Any(Pack mask) { return _mm_movemask_ps(mask.v) != 0; }
+
+inline void Quadrant(Pack x, Pack& q, Pack& swap, Pack& sinSign, Pack& cosSign)
+{
+    __m128i qi  = _mm_cvtps_epi32(_mm_mul_ps(x.v, _mm_set1_ps(s_twoOverPi)));
+    __m128i one = _mm_set1_epi32(1);
+    __m128i two = _mm_set1_epi32(2);
+
+    q.v       = _mm_cvtepi32_ps(qi);
+    swap.v    = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(qi, one), one));
+    sinSign.v = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(qi, two), 30));
+    cosSign.v =
+      _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(qi, one), two), 30));
+}
+#else
+struct Pack
+{
+    static constexpr size_t s_width = 1;
+    float                   v;
+
+    static Pack Load(const float* p) { return {*p}; }
+    static Pack Set(float f) { return {f}; }
+    void        Store(float* p) const { *p = v; }
+};
+inline Pack operator+(Pack a, Pack b) { return {a.v + b.v}; }
+inline Pack operator-(Pack a, Pack b) { return {a.v - b.v}; }
+inline Pack operator*(Pack a, Pack b) { return {a.v * b.v}; }
+inline uint32_t Bits(Pack a)
+{
+    uint32_t bits;
+    memcpy(&bits, &a.v, sizeof(bits));
+    return bits;
+}
+inline Pack FromBits(uint32_t bits)
+{
+    Pack a;
+    memcpy(&a.v, &bits, sizeof(bits));
+    return a;
+}
+inline Pack Xor(Pack a, Pack b) { return FromBits(Bits(a) ^ Bits(b)); }
+inline Pack Select(Pack mask, Pack a, Pack b) { return Bits(mask) != 0 ? a : b; }
+inline Pack IsOutOfRange(Pack x)
+{
+    return FromBits(!(std::fabs(x.v) <= s_maxReducedAngle) ? 0xFFFFFFFFu : 0u);
+}
+inline bool Any(Pack mask) { return Bits(mask) != 0; }
+
+inline void Quadrant(Pack x, Pack& q, Pack& swap, Pack& sinSign, Pack& cosSign)
+{
+    int32_t qi = (int32_t)std::lrint(x.v * s_twoOverPi);
+
+    q.v     = (float)qi;
+    swap    = FromBits((qi & 1) != 0 ? 0xFFFFFFFFu : 0u);
+    sinSign = FromBits((uint32_t)(qi & 2) << 30);
+    cosSign = FromBits((uint32_t)((qi + 1) & 2) << 30);
+}
+#endif
+
+/**
+ * sin and cos of x, in radians, with Cephes' single precision polynomials on [-pi/4, pi/4].
+ */
+inline void SinCos(Pack angle, Pack& s, Pack& c)
+{
+    // Out of range lanes are computed on 0, then replaced.
+    Pack outOfRange    = IsOutOfRange(angle);
+    bool hasOutOfRange = Any(outOfRange);
+    Pack x             = hasOutOfRange ? Select(outOfRange, Pack::Set(0.0f), angle) : angle;
+
+    Pack q, swap, sinSign, cosSign;
+    Quadrant(x, q, swap, sinSign, cosSign);
+
+    // Bring x in [-pi/4, pi/4].
+    Pack r = x - (q * Pack::Set(s_piOver2Hi)) - (q * Pack::Set(s_piOver2Mid)) -
+             (q * Pack::Set(s_piOver2Lo));
+    Pack z = r * r;
+
+    Pack ps = Pack::Set(-1.9515295891e-4f);
+    ps      = (ps * z) + Pack::Set(8.3321608736e-3f);
+    ps      = (ps * z) + Pack::Set(-1.6666654611e-1f);
+    ps      = (ps * z * r) + r;
+
+    Pack pc = Pack::Set(2.443315711809948e-5f);
+    pc      = (pc * z) + Pack::Set(-1.388731625493765e-3f);
+    pc      = (pc * z) + Pack::Set(4.166664568298827e-2f);
+    pc      = (pc * z * z) - (z * Pack::Set(0.5f)) + Pack::Set(1.0f);
+
+    s = Xor(Select(swap, pc, ps), sinSign);
+    c = Xor(Select(swap, ps, pc), cosSign);
+
+    if (hasOutOfRange)
+    {
+        alignas(32) float angles[Pack::s_width];
+        alignas(32) float sines[Pack::s_width];
+        alignas(32) float cosines[Pack::s_width];
+        angle.Store(angles);
+        s.Store(sines);
+        c.Store(cosines);
+        for (size_t i = 0; i < Pack::s_width; i++)
+        {
+            if (!(std::fabs(angles[i]) <= s_maxReducedAngle))
+            {
+                sines[i]   = std::sin(angles[i]);
+                cosines[i] = std::cos(angles[i]);
+            }
+        }
+        s = Pack::Load(sines);
+        c = Pack::Load(cosines);
+    }
+}
+
+/**
+ * Staging area of a block, one array per member of TransformComponent.
+ */
+struct Staging
+{
+    alignas(32) float px[BLOCK_SIZE];
+    alignas(32) float py[BLOCK_SIZE];
+    alignas(32) float pz[BLOCK_SIZE];
+    alignas(32) float rx[BLOCK_SIZE];
+    alignas(32) float ry[BLOCK_SIZE];
+    alignas(32) float rz[BLOCK_SIZE];
+    alignas(32) float sx[BLOCK_SIZE];
+    alignas(32) float sy[BLOCK_SIZE];
+    alignas(32) float sz[BLOCK_SIZE];
+
+    // The upper 3x3 of the matrices, column by column, then the translation.
+    alignas(32) float m[9][BLOCK_SIZE];
+};
+
+/**
+ * Compute the 3x3 part of the matrices of the block.
+ * M = Rx * Ry * Rz * S, written out so that nothing is computed for the zeroes.
+ */
+void ComputeBlock(Staging& st, bool is2D)
+{
+    for (size_t l = 0; l < BLOCK_SIZE; l += Pack::s_width)
+    {
+        Pack sc, cc;
+        SinCos(Pack::Load(&st.rz[l]) * Pack::Set(s_degToRad), sc, cc);
+
+        Pack sx = Pack::Load(&st.sx[l]);
+        Pack sy = Pack::Load(&st.sy[l]);
+        Pack sz = Pack::Load(&st.sz[l]);
+        Pack zero = Pack::Set(0.0f);
+
+        if (is2D)
+        {
+            (cc * sx).Store(&st.m[0][l]);
+            (sc * sx).Store(&st.m[1][l]);
+            zero.Store(&st.m[2][l]);
+            (zero - (sc * sy)).Store(&st.m[3][l]);
+            (cc * sy).Store(&st.m[4][l]);
+            zero.Store(&st.m[5][l]);
+            zero.Store(&st.m[6][l]);
+            zero.Store(&st.m[7][l]);
+            sz.Store(&st.m[8][l]);
+        }
+        else
+        {
+            Pack sa, ca, sb, cb;
+            SinCos(Pack::Load(&st.rx[l]) * Pack::Set(s_degToRad), sa, ca);
+            SinCos(Pack::Load(&st.ry[l]) * Pack::Set(s_degToRad), sb, cb);
+
+            Pack sasb = sa * sb;
+            Pack casb = ca * sb;
+
+            (cb * cc * sx).Store(&st.m[0][l]);
+            (((ca * sc) + (sasb * cc)) * sx).Store(&st.m[1][l]);
+            (((sa * sc) - (casb * cc)) * sx).Store(&st.m[2][l]);
+            (zero - (cb * sc * sy)).Store(&st.m[3][l]);
+            (((ca * cc) - (sasb * sc)) * sy).Store(&st.m[4][l]);
+            (((sa * cc) + (casb * sc)) * sy).Store(&st.m[5][l]);
+            (sb * sz).Store(&st.m[6][l]);
+            (zero - (sa * cb * sz)).Store(&st.m[7][l]);
+            (ca * cb * sz).Store(&st.m[8][l]);
+        }
+    }
+}
+
+template<typename Getter>
+void ComputeAll(Getter get, size_t count, glm::mat4* out)
+{
+    Staging st;
+
+    for (size_t first = 0; first < count; first += BLOCK_SIZE)
+    {
+        size_t n    = std::min((size_t)BLOCK_SIZE, count - first);
+        bool   is2D = true;
+
+        for (size_t l = 0; l < BLOCK_SIZE; l++)
+        {
+            // Pad the last block with identities.
+            static const TransformComponent s_identity;
+            const TransformComponent&       t = l < n ? get(first + l) : s_identity;
+
+            st.px[l] = t.position.x;
+            st.py[l] = t.position.y;
+            st.pz[l] = t.position.z;
+            st.rx[l] = t.rotation.x;
+            st.ry[l] = t.rotation.y;
+            st.rz[l] = t.rotation.z;
+            st.sx[l] = t.scale.x;
+            st.sy[l] = t.scale.y;
+            st.sz[l] = t.scale.z;
+
+            is2D &= t.rotation.x == 0.0f && t.rotation.y == 0.0f;
+        }
+
+        ComputeBlock(st, is2D);
+
+        for (size_t l = 0; l < n; l++)
+        {
+            glm::mat4& m = out[first + l];
+            m[0]         = {st.m[0][l], st.m[1][l], st.m[2][l], 0.0f};
+            m[1]         = {st.m[3][l], st.m[4][l], st.m[5][l], 0.0f};
+            m[2]         = {st.m[6][l], st.m[7][l], st.m[8][l], 0.0f};
+            m[3]         = {st.px[l], st.py[l], st.pz[l], 1.0f};
+        }
+    }
+}
+}    // namespace
+
+/*********************************************************************************************************************/
+// [SECTION] Public Method Definitions
+/*********************************************************************************************************************/
+void TransformSystem::Compute(const TransformComponent* in, size_t count, glm::mat4* out)
+{
+    BR_PROFILE_FUNCTION();
+    ComputeAll([in](size_t i) -> const TransformComponent& { return in[i]; }, count, out);
+}
+
+void TransformSystem::Compute(const TransformComponent* const* in, size_t count, glm::mat4* out)
+{
+    BR_PROFILE_FUNCTION();
+    ComputeAll([in](size_t i) -> const TransformComponent& { return *in[i]; }, count, out);
+}
+
+void TransformSystem::ComputeScalar(const TransformComponent* in, size_t count, glm::mat4* out)
+{
+    BR_PROFILE_FUNCTION();
+    for (size_t i = 0; i < count; i++)
+    {
+        out[i] = in[i].GetTransform();
+    }
+}
+
+const char* TransformSystem::GetInstructionSet()
+{
+#if defined(BR_TRANSFORM_AVX2)
+    return "AVX2";
+#elif defined(BR_TRANSFORM_SSE2)
+    return "SSE2";
+#else
+    return "Scalar";
+#endif
+}
+}    // namespace Brigerad
@@ -0,0 +1,65 @@
+/**
+ * @file    TransformSystem.h
+ * @author  Samuel Martel
+ * @p       https://github.com/smartel99
+ * @date    10/19/2026 4:00:00 PM
+ *
+ * @brief
+ ******************************************************************************
+ * Copyright (C) 2020  Samuel Martel
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *****************************************************************************/
+#pragma once
+
+/*********************************************************************************************************************/
+// [SECTION] Includes
+/*********************************************************************************************************************/
+#include "Brigerad/Scene/Components.h"
+
+#include "glm/glm.hpp"
+
+#include <cstddef>
+
+namespace Brigerad
+{
+/*********************************************************************************************************************/
+// [SECTION] Class Declarations
+/*********************************************************************************************************************/
+/**
+ * Computes the matrices of many TransformComponents at once.
+ *
+ * The transforms are copied in blocks to a structure-of-arrays staging area and computed 8 at a
+ * time with AVX2, or 4 at a time with SSE2, depending on what the build targets. A block whose
+ * transforms are all only rotated around z takes a 2D path that skips the x and y rotations.
+ *
+ * sin and cos are approximated with polynomials, the results match
+ * TransformComponent::GetTransform to a few 1e-6 relative.
+ */
+class TransformSystem
+{
+public:
+    /** out[i] = in[i].GetTransform(), for contiguous transforms such as an entt pool. */
+    static void Compute(const TransformComponent* in, size_t count, glm::mat4* out);
+
+    /** out[i] = in[i]->GetTransform(), for transforms gathered from a view. */
+    static void Compute(const TransformComponent* const* in, size_t count, glm::mat4* out);
+
+    /** Reference implementation, one GetTransform per transform. */
+    static void ComputeScalar(const TransformComponent* in, size_t count, glm::mat4* out);
+
+    /** Name of the instruction set the kernel was built for. */
+    static const char* GetInstructionSet();
+};
+}    // namespace Brigerad
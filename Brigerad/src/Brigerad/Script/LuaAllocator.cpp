@@ -0,0 +1,207 @@
+/**
+ * @file    LuaAllocator.cpp
+ * @author  Samuel Martel
+ * @p       https://github.com/smartel99
+ * @date    10/19/2026 8:10:00 PM
+ *
+ * @brief
+ ******************************************************************************
+ * Copyright (C) 2020  Samuel Martel
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *****************************************************************************/
+
+/*********************************************************************************************************************/
+// [SECTION] Includes
+/*********************************************************************************************************************/
+#include "brpch.h"
+#include "LuaAllocator.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+namespace Brigerad
+{
+/*********************************************************************************************************************/
+// [SECTION] Public Method Definitions
+/*********************************************************************************************************************/
+LuaAllocator::~LuaAllocator()
+{
+    for (void* page : m_pages)
+    {
+        std::free(page);
+    }
+}
+
+void* LuaAllocator::Allocate(void* userData, void* ptr, size_t oldSize, size_t newSize)
+{
+    auto* allocator = static_cast<LuaAllocator*>(userData);
+
+    // Without a block, oldSize is the type of the object to allocate, not a size.
+    if (ptr == nullptr)
+    {
+        return newSize == 0 ? nullptr : allocator->Alloc(newSize);
+    }
+
+    if (newSize == 0)
+    {
+        allocator->Free(ptr, oldSize);
+        return nullptr;
+    }
+
+    return allocator->Realloc(ptr, oldSize, newSize);
+}
+
+/*********************************************************************************************************************/
+// [SECTION] Private Method Definitions
+/*********************************************************************************************************************/
+void* LuaAllocator::Alloc(size_t size)
+{
+    void* block = nullptr;
+    if (size <= s_maxPooledSize)
+    {
+        size_t sizeClass = GetSizeClass(size);
+        if (m_freeLists[sizeClass] == nullptr && !AddPage(sizeClass))
+        {
+            return nullptr;
+        }
+
+        FreeBlock* head        = m_freeLists[sizeClass];
+        m_freeLists[sizeClass] = head->next;
+        block                  = head;
+        m_stats.pooledBlocks++;
+    }
+    else
+    {
+        block = std::malloc(size);
+        if (block == nullptr)
+        {
+            return nullptr;
+        }
+        m_stats.bytesReserved += size;
+        m_stats.largeBlocks++;
+    }
+
+    m_stats.bytesInUse += size;
+    m_stats.bytesAllocated += size;
+    m_stats.peakBytesInUse = std::max(m_stats.peakBytesInUse, m_stats.bytesInUse);
+    return block;
+}
+
+void LuaAllocator::Free(void* ptr, size_t size)
+{
+    if (size <= s_maxPooledSize)
+    {
+        size_t sizeClass       = GetSizeClass(size);
+        auto*  block           = static_cast<FreeBlock*>(ptr);
+        block->next            = m_freeLists[sizeClass];
+        m_freeLists[sizeClass] = block;
+        m_stats.pooledBlocks--;
+    }
+    else
+    {
+        std::free(ptr);
+        m_stats.bytesReserved -= size;
+        m_stats.largeBlocks--;
+    }
+
+    m_stats.bytesInUse -= size;
+}
+
+void* LuaAllocator::Realloc(void* ptr, size_t oldSize, size_t newSize)
+{
+    bool wasPooled = oldSize <= s_maxPooledSize;
+    bool isPooled  = newSize <= s_maxPooledSize;
+
+    // Same block size, nothing to move.
+    if (wasPooled && isPooled && GetSizeClass(oldSize) == GetSizeClass(newSize))
+    {
+        m_stats.bytesInUse += newSize - oldSize;
+        m_stats.bytesAllocated += newSize > oldSize ? newSize - oldSize : 0;
+        m_stats.peakBytesInUse = std::max(m_stats.peakBytesInUse, m_stats.bytesInUse);
+        return ptr;
+    }
+
+    if (!wasPooled && !isPooled)
+    {
+        void* block = std::realloc(ptr, newSize);
+        if (block == nullptr && newSize < oldSize)
+        {
+            // Lua expects a shrink to always succeed. The block is big enough, counted at its new
+            // size since that is what it will be freed with.
+            m_stats.bytesReserved -= oldSize - newSize;
+            m_stats.bytesInUse -= oldSize - newSize;
+            return ptr;
+        }
+        if (block == nullptr)
+        {
+            // Lua keeps the old block.
+            return nullptr;
+        }
+        m_stats.bytesReserved += newSize - oldSize;
+        m_stats.bytesInUse += newSize - oldSize;
+        m_stats.bytesAllocated += newSize > oldSize ? newSize - oldSize : 0;
+        m_stats.peakBytesInUse = std::max(m_stats.peakBytesInUse, m_stats.bytesInUse);
+        return block;
+    }
+
+    // Between a pool and malloc, or between two pools.
+    void* block = Alloc(newSize);
+    if (block == nullptr && newSize < oldSize)
+    {
+        // Lua expects a shrink to always succeed, keep the block, it is big enough. Freed with its
+        // new size, it joins the pool of that size, for good if it came from malloc.
+        if (!wasPooled)
+        {
+            m_stats.largeBlocks--;
+            m_stats.pooledBlocks++;
+        }
+        m_stats.bytesInUse -= oldSize - newSize;
+        return ptr;
+    }
+    if (block == nullptr)
+    {
+        return nullptr;
+    }
+    std::memcpy(block, ptr, std::min(oldSize, newSize));
+    Free(ptr, oldSize);
+    // Only the growth counts as allocated, like in the other cases.
+    m_stats.bytesAllocated -= std::min(oldSize, newSize);
+    return block;
+}
+
+bool LuaAllocator::AddPage(size_t sizeClass)
+{
+    void* page = std::malloc(s_pageSize);
+    if (page == nullptr)
+    {
+        return false;
+    }
+    m_pages.push_back(page);
+    m_stats.bytesReserved += s_pageSize;
+
+    // Thread the blocks of the page into the free list of the class.
+    size_t blockSize  = (sizeClass + 1) * s_granularity;
+    size_t blockCount = s_pageSize / blockSize;
+    auto*  bytes      = static_cast<uint8_t*>(page);
+    for (size_t i = 0; i < blockCount; i++)
+    {
+        auto* block            = reinterpret_cast<FreeBlock*>(bytes + i * blockSize);
+        block->next            = m_freeLists[sizeClass];
+        m_freeLists[sizeClass] = block;
+    }
+    return true;
+}
+}    // namespace Brigerad
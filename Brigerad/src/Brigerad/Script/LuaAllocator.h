@@ -0,0 +1,100 @@
+/**
+ * @file    LuaAllocator.h
+ * @author  Samuel Martel
+ * @p       https://github.com/smartel99
+ * @date    10/19/2026 8:10:00 PM
+ *
+ * @brief
+ ******************************************************************************
+ * Copyright (C) 2020  Samuel Martel
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *****************************************************************************/
+#pragma once
+
+/*********************************************************************************************************************/
+// [SECTION] Includes
+/*********************************************************************************************************************/
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Brigerad
+{
+/*********************************************************************************************************************/
+// [SECTION] Class Declarations
+/*********************************************************************************************************************/
+/**
+ * Allocator of a Lua state, passed to lua_newstate with Allocate as the lua_Alloc function.
+ *
+ * Lua mostly allocates small objects: strings, tables, closures, userdata. Those are served from
+ * free lists of fixed-size blocks, one list per multiple of 16 bytes, carved out of large pages
+ * that are only freed with the allocator. Lua always tells the size of the block it frees or
+ * resizes, so the blocks carry no header. Bigger allocations go to malloc.
+ *
+ * Not thread-safe: a Lua state is only used by one thread at a time, and so is its allocator.
+ */
+class LuaAllocator
+{
+public:
+    struct Stats
+    {
+        size_t bytesInUse     = 0;    // Requested by Lua and not freed yet.
+        size_t peakBytesInUse = 0;
+        size_t bytesReserved  = 0;    // Pages and large blocks held from the system.
+        size_t bytesAllocated = 0;    // Ever requested by Lua, what the garbage collector pays for.
+        size_t pooledBlocks   = 0;    // Live blocks served by the pools.
+        size_t largeBlocks    = 0;    // Live blocks served by malloc.
+    };
+
+    static constexpr size_t s_granularity   = 16;
+    static constexpr size_t s_maxPooledSize = 256;
+    static constexpr size_t s_pageSize      = 64 * 1024;
+
+    LuaAllocator() = default;
+    ~LuaAllocator();
+
+    LuaAllocator(const LuaAllocator&) = delete;
+    LuaAllocator& operator=(const LuaAllocator&) = delete;
+
+    /** The lua_Alloc function, userData being the LuaAllocator. */
+    static void* Allocate(void* userData, void* ptr, size_t oldSize, size_t newSize);
+
+    const Stats& GetStats() const { return m_stats; }
+
+private:
+    static constexpr size_t s_classCount = s_maxPooledSize / s_granularity;
+
+    struct FreeBlock
+    {
+        FreeBlock* next;
+    };
+
+    static size_t GetSizeClass(size_t size)
+    {
+        return (size + s_granularity - 1) / s_granularity - 1;
+    }
+
+    void* Alloc(size_t size);
+    void  Free(void* ptr, size_t size);
+    void* Realloc(void* ptr, size_t oldSize, size_t newSize);
+    bool  AddPage(size_t sizeClass);
+
+private:
+    std::array<FreeBlock*, s_classCount> m_freeLists = {};
+    std::vector<void*>                   m_pages;
+    Stats                                m_stats;
+};
+}    // namespace Brigerad
@@ -36,10 +36,19 @@
 #include "lstate.h"
 #include "setjmp.h"
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <unordered_map>
+
 #include "ScriptEngineRegistry.h"
+#include "ScriptProfiler.h"
+#include "ScriptScheduler.h"
 
 #include "Brigerad/Scene/ScriptableEntity.h"
 #include "Brigerad/Scene/Components.h"
+#include "Brigerad/Utils/ThreadPool.h"
 
 namespace Brigerad
 {
@@ -51,22 +60,141 @@ namespace Brigerad
 /*********************************************************************************************************************/
 // [SECTION] Private Variable Definitions
 /*********************************************************************************************************************/
+/**
+ * Value carried by a message from a state to another: nil, a boolean, a number, a string or a table
+ * of those. Lua values can't be shared between states, they are copied.
+ */
+struct ScriptValue
+{
+    int                                              type      = LUA_TNIL;
+    bool                                             boolean   = false;
+    bool                                             isInteger = false;
+    lua_Integer                                      integer   = 0;
+    lua_Number                                       number    = 0.0;
+    std::string                                      string;
+    std::vector<std::pair<ScriptValue, ScriptValue>> table;
+};
+
+struct ScriptMessage
+{
+    std::string target;        // Name of the script receiving the message.
+    size_t      sender = 0;    // Index of the state sending it, to deliver in a stable order.
+    ScriptValue value;
+};
+
+// A Lua state and all that goes with it. The scripts of an entity always run in the same one.
+struct ScriptState
+{
+    // Declared first, the state must be destroyed before its allocator.
+    LuaAllocator allocator;
+    sol::state*  LuaState = nullptr;
+    size_t       index    = 0;
+
+    size_t gcDebt             = 0;        // Bytes allocated that the collector didn't go through.
+    size_t lastBytesAllocated = 0;        // LuaAllocator::Stats::bytesAllocated at the last step.
+    size_t gcPauseThreshold   = 0;        // Bytes in use above which the next cycle starts.
+    bool   gcPaused           = false;    // Between the end of a cycle and the next one.
+    float  gcMs               = 0.0f;
+
+    size_t entityCount = 0;
+
+    // Sent to the scripts of this state, anytime, from any state.
+    std::mutex                 mailboxMutex;
+    std::vector<ScriptMessage> mailbox;
+    // Taken out of the mailbox before an update, delivered during it.
+    std::vector<ScriptMessage> inbox;
+
+    std::vector<LuaScriptEntity*> entities;    // Updated in the current update.
+
+    // Time budget of OnUpdate, see ScriptEngine::SetTimeBudget.
+    size_t                   roundRobin = 0;    // First entity to update on the next frame.
+    float                    updateMs   = 0.0f;
+    size_t                   suspended  = 0;
+    size_t                   deferred   = 0;
+    std::vector<std::string> overBudget;
+};
+
 struct ScriptEngineData
 {
-    sol::state* LuaState = nullptr;
+    std::vector<Scope<ScriptState>> states;
+    // Runs the updates of every state but the first, which runs on the calling thread.
+    Scope<ThreadPool> pool;
+
+    // Script name -> its state. Only changed on the main thread, outside of the updates.
+    std::unordered_map<std::string, size_t> scriptStates;
+
+    double frameBudgetMs  = 0.0;
+    double entityBudgetMs = 0.0;
 };
 
+// Work done per call to lua_gc, the granularity of the time budget.
+static constexpr size_t s_gcStepSize = 16 * 1024;
+// Past that debt, the budget is ignored rather than letting the memory grow without end.
+static constexpr size_t s_maxGcDebt = 64 * 1024 * 1024;
+// Like the default pause of Lua: a new cycle starts once the memory in use doubled since the end
+// of the last one.
+static constexpr size_t s_gcPause = 2;
+// Nesting of the tables a message can carry.
+static constexpr int s_maxMessageDepth = 16;
+// Instructions run between two checks of the time budget.
+static constexpr int s_budgetCheckInstructions = 1000;
+
 static ScriptEngineData s_data;
+// The state whose scripts the thread is running, if any.
+static thread_local ScriptState* s_currentState = nullptr;
+// The threads of the pool, updating every state but the first.
+static thread_local bool s_isWorkerThread = false;
+
+/**
+ * @brief   Calls the function in upvalue 1, unless on a worker thread. Upvalue 2 is its name.
+ */
+static int Lua_MainThreadOnly(lua_State* L)
+{
+    if (s_isWorkerThread)
+    {
+        return luaL_error(L,
+                          "%s can only be called from the main thread, not during the update of "
+                          "a state other than the first",
+                          lua_tostring(L, lua_upvalueindex(2)));
+    }
+
+    lua_pushvalue(L, lua_upvalueindex(1));
+    lua_insert(L, 1);
+    lua_call(L, lua_gettop(L) - 1, LUA_MULTRET);
+    return lua_gettop(L);
+}
 
 namespace Scripting
 {
 sol::state* GetState()
 {
-    return s_data.LuaState;
+    if (s_currentState != nullptr)
+    {
+        return s_currentState->LuaState;
+    }
+    return s_data.states.empty() ? nullptr : s_data.states.front()->LuaState;
+}
+
+sol::object MainThreadOnly(const char* name, const sol::object& function)
+{
+    lua_State* L = function.lua_state();
+    function.push();
+    lua_pushstring(L, name);
+    lua_pushcclosure(L, &Lua_MainThreadOnly, 2);
+    return sol::stack::pop<sol::object>(L);
 }
 }    // namespace Scripting
 
-static jmp_buf s_luaPanicJump;
+// Each thread running scripts needs its own.
+static thread_local jmp_buf s_luaPanicJump;
+
+// When the OnUpdate running on the thread must be suspended.
+static thread_local bool                                  s_hasDeadline = false;
+static thread_local std::chrono::steady_clock::time_point s_deadline;
+// The coroutine of that OnUpdate. Those it creates inherit the hook, they are never suspended.
+static thread_local lua_State* s_updateThread = nullptr;
+// Set when the hook suspended it, rather than the script yielding.
+static thread_local bool s_isOverBudget = false;
 
 /*********************************************************************************************************************/
 // [SECTION] Private Function Declarations
@@ -82,24 +210,177 @@ static void OnInternalLuaError()
     BR_CORE_ERROR("[ScriptEngine] Internal Lua error!");
 }
 
-/*********************************************************************************************************************/
-// [SECTION] Public Method Definitions
-/*********************************************************************************************************************/
+/**
+ * @brief   Count hook of OnUpdate. Also takes the samples of the profiler, a state has one hook.
+ */
+static void BudgetHook(lua_State* L, lua_Debug*)
+{
+    if (ScriptProfiler::IsRunning())
+    {
+        ScriptProfiler::Sample(L);
+    }
 
+    // Not from inside a call made by C, e.g. a comparator of table.sort, a later check will.
+    // Nor from a coroutine of the script, that would be a yield its own code doesn't expect.
+    if (s_hasDeadline && L == s_updateThread && lua_isyieldable(L) &&
+        std::chrono::steady_clock::now() >= s_deadline)
+    {
+        s_isOverBudget = true;
+        lua_yield(L, 0);
+    }
+}
 
-/*********************************************************************************************************************/
-// [SECTION] Private Method Definitions
-/*********************************************************************************************************************/
+static ScriptValue ReadValue(lua_State* L, int index, int depth)
+{
+    ScriptValue value;
+    value.type = lua_type(L, index);
+    switch (value.type)
+    {
+        case LUA_TNIL: break;
+        case LUA_TBOOLEAN: value.boolean = lua_toboolean(L, index) != 0; break;
+        case LUA_TNUMBER:
+            value.isInteger = lua_isinteger(L, index) != 0;
+            if (value.isInteger)
+            {
+                value.integer = lua_tointeger(L, index);
+            }
+            else
+            {
+                value.number = lua_tonumber(L, index);
+            }
+            break;
+        case LUA_TSTRING:
+        {
+            size_t      length = 0;
+            const char* string = lua_tolstring(L, index, &length);
+            value.string.assign(string, length);
+            break;
+        }
+        case LUA_TTABLE:
+            if (depth >= s_maxMessageDepth)
+            {
+                luaL_error(L, "send: message nested too deep");
+            }
+            index = lua_absindex(L, index);
+            lua_pushnil(L);
+            while (lua_next(L, index) != 0)
+            {
+                value.table.emplace_back(ReadValue(L, -2, depth + 1), ReadValue(L, -1, depth + 1));
+                lua_pop(L, 1);
+            }
+            break;
+        default:
+            luaL_error(L, "send: can't send a %s to another script", luaL_typename(L, index));
+    }
+    return value;
+}
+
+static void PushValue(lua_State* L, const ScriptValue& value)
+{
+    switch (value.type)
+    {
+        case LUA_TBOOLEAN: lua_pushboolean(L, value.boolean); break;
+        case LUA_TNUMBER:
+            if (value.isInteger)
+            {
+                lua_pushinteger(L, value.integer);
+            }
+            else
+            {
+                lua_pushnumber(L, value.number);
+            }
+            break;
+        case LUA_TSTRING: lua_pushlstring(L, value.string.data(), value.string.size()); break;
+        case LUA_TTABLE:
+            lua_createtable(L, 0, int(value.table.size()));
+            for (const auto& [key, field] : value.table)
+            {
+                PushValue(L, key);
+                PushValue(L, field);
+                lua_rawset(L, -3);
+            }
+            break;
+        default: lua_pushnil(L); break;
+    }
+}
+
+/**
+ * @brief   send(target, message), delivered to target.OnMessage(message) on the next update.
+ */
+static int Lua_Send(lua_State* L)
+{
+    const char* target = luaL_checkstring(L, 1);
+    auto        it     = s_data.scriptStates.find(target);
+    if (it == s_data.scriptStates.end())
+    {
+        return luaL_error(L, "send: no script named %s", target);
+    }
+
+    ScriptMessage message;
+    message.target = target;
+    message.sender = s_currentState != nullptr ? s_currentState->index : 0;
+    message.value  = ReadValue(L, 2, 0);
+
+    ScriptState&                state = *s_data.states[it->second];
+    std::lock_guard<std::mutex> lock(state.mailboxMutex);
+    state.mailbox.push_back(std::move(message));
+    return 0;
+}
+
+static void DeliverMessages(ScriptState& state)
+{
+    if (state.inbox.empty())
+    {
+        return;
+    }
+
+    BR_PROFILE_FUNCTION();
+
+    // The senders ran in parallel, only the order of the messages of each one is known.
+    std::stable_sort(state.inbox.begin(), state.inbox.end(), [](const auto& a, const auto& b) {
+        return a.sender < b.sender;
+    });
+
+    lua_State* L = state.LuaState->lua_state();
+    for (const ScriptMessage& message : state.inbox)
+    {
+        lua_getglobal(L, message.target.c_str());
+        if (lua_getfield(L, -1, "OnMessage") != LUA_TFUNCTION)
+        {
+            lua_pop(L, 2);
+            continue;
+        }
 
+        PushValue(L, message.value);
+        if (lua_pcall(L, 1, 0, 0) != LUA_OK)
+        {
+            BR_CORE_ERROR("[ScriptEngine] Lua error in {}.OnMessage! {}",
+                          message.target,
+                          lua_tostring(L, -1));
+            lua_pop(L, 1);
+        }
+        lua_pop(L, 1);
+    }
+    state.inbox.clear();
+}
 
-void ScriptEngine::Init()
+static void CreateState(size_t index)
 {
-    BR_CORE_INFO("[ScriptEngine] Initializing.");
+    s_data.states.push_back(CreateScope<ScriptState>());
+    ScriptState& state = *s_data.states.back();
+    state.index        = index;
+
+    state.LuaState =
+      new sol::state(sol::default_at_panic, &LuaAllocator::Allocate, &state.allocator);
+    state.LuaState->open_libraries(sol::lib::base, sol::lib::math);
+
+    lua_State* L = state.LuaState->lua_state();
 
-    s_data.LuaState = new sol::state();
-    s_data.LuaState->open_libraries(sol::lib::base, sol::lib::math);
+    // Incremental collection, driven by StepGarbageCollector only.
+    lua_gc(L, LUA_GCINC, 0, 0, 0);
+    lua_gc(L, LUA_GCSTOP);
+    state.lastBytesAllocated = state.allocator.GetStats().bytesAllocated;
 
-    lua_State* L  = s_data.LuaState->lua_state();
     L->l_G->panic = [](lua_State* L) {
         BR_CORE_CRITICAL("[ScriptEngine] ERROR!!! We should never reach this line!!!");
         return 0;
@@ -107,18 +388,136 @@ void ScriptEngine::Init()
 
     lua_atpanic(L, &Lua_AtPanicHandler);
 
+    // The registries bind to the current state.
+    s_currentState = &state;
     ScriptEngineRegistry::RegisterAllTypes();
+    s_currentState = nullptr;
+
+    ScriptScheduler::Init(L);
+    lua_register(L, "send", &Lua_Send);
+}
+
+static void StepGarbageCollector(ScriptState& state, double budgetMs)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    const LuaAllocator::Stats& stats = state.allocator.GetStats();
+    size_t allocated                 = stats.bytesAllocated - state.lastBytesAllocated;
+    state.lastBytesAllocated         = stats.bytesAllocated;
+
+    if (state.gcPaused && stats.bytesInUse < state.gcPauseThreshold)
+    {
+        state.gcMs = 0.0f;
+        return;
+    }
+    state.gcPaused = false;
+    state.gcDebt += allocated;
+
+    lua_State* L        = state.LuaState->lua_state();
+    auto       deadline = start + std::chrono::duration<double, std::milli>(budgetMs);
+    while (state.gcDebt > 0)
+    {
+        size_t step = std::min(state.gcDebt, s_gcStepSize);
+        state.gcDebt -= step;
+        if (lua_gc(L, LUA_GCSTEP, int((step + 1023) / 1024)) != 0)
+        {
+            // End of a cycle, wait for the memory to grow before starting the next one.
+            state.gcDebt           = 0;
+            state.gcPaused         = true;
+            state.gcPauseThreshold = stats.bytesInUse * s_gcPause;
+            break;
+        }
+
+        if (std::chrono::steady_clock::now() >= deadline && state.gcDebt < s_maxGcDebt)
+        {
+            break;
+        }
+    }
+
+    state.gcMs =
+      std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+/*********************************************************************************************************************/
+// [SECTION] Public Method Definitions
+/*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************/
+// [SECTION] Private Method Definitions
+/*********************************************************************************************************************/
+
+
+void ScriptEngine::Init(size_t stateCount)
+{
+    stateCount = std::max<size_t>(stateCount, 1);
+    BR_CORE_INFO("[ScriptEngine] Initializing {} Lua state(s).", stateCount);
+
+    for (size_t i = 0; i < stateCount; i++)
+    {
+        CreateState(i);
+    }
+
+    if (stateCount > 1)
+    {
+        s_data.pool = CreateScope<ThreadPool>(stateCount - 1);
+    }
 }
 
 void ScriptEngine::Shutdown()
 {
     BR_CORE_INFO("[ScriptEngine] Shutting down.");
 
-    delete s_data.LuaState;
-    s_data.LuaState = nullptr;
+    s_data.pool.reset();
+    for (auto& state : s_data.states)
+    {
+        ScriptScheduler::Shutdown(state->LuaState->lua_state());
+        delete state->LuaState;
+    }
+    s_data.states.clear();
+    s_data.scriptStates.clear();
+}
+
+void ScriptEngine::SetStateCount(size_t count)
+{
+    BR_CORE_ASSERT(s_data.scriptStates.empty(),
+                   "The number of Lua states must be set before loading any script!");
+
+    if (std::max<size_t>(count, 1) != s_data.states.size())
+    {
+        Shutdown();
+        Init(count);
+    }
+}
+
+size_t ScriptEngine::GetStateCount()
+{
+    return s_data.states.size();
+}
+
+void ScriptEngine::SetTimeBudget(double frameMs, double entityMs)
+{
+    s_data.frameBudgetMs  = frameMs;
+    s_data.entityBudgetMs = entityMs;
+}
+
+ScriptEngine::BudgetStats ScriptEngine::GetBudgetStats()
+{
+    BudgetStats stats;
+    for (const auto& state : s_data.states)
+    {
+        // The states run in parallel, the slowest one is what the frame waits for.
+        stats.updateMs = std::max(stats.updateMs, state->updateMs);
+        stats.suspended += state->suspended;
+        stats.deferred += state->deferred;
+        stats.overBudget.insert(
+          stats.overBudget.end(), state->overBudget.begin(), state->overBudget.end());
+    }
+    return stats;
 }
 
 #define LUA_CALL(name, func, ...)                                                                  \
+    ScriptProfiler::BeginCall(lua.lua_state(), name, func);                                        \
     if (setjmp(s_luaPanicJump) == 0)                                                               \
     {                                                                                              \
         lua[name][func](##__VA_ARGS__);                                                            \
@@ -126,23 +525,76 @@ void ScriptEngine::Shutdown()
     else                                                                                           \
     {                                                                                              \
         OnInternalLuaError();                                                                      \
+    }                                                                                              \
+    ScriptProfiler::EndCall(lua.lua_state());
+
+void ScriptEngine::StepGarbageCollector(double budgetMs)
+{
+    BR_PROFILE_FUNCTION();
+
+    // Shared evenly, the states allocate about as much as each other.
+    for (auto& state : s_data.states)
+    {
+        Brigerad::StepGarbageCollector(*state, budgetMs / s_data.states.size());
     }
+}
+
+ScriptEngine::MemoryStats ScriptEngine::GetMemoryStats()
+{
+    MemoryStats stats;
+    stats.stateCount = s_data.states.size();
+    for (const auto& state : s_data.states)
+    {
+        const LuaAllocator::Stats& allocator = state->allocator.GetStats();
+        stats.allocator.bytesInUse += allocator.bytesInUse;
+        stats.allocator.peakBytesInUse += allocator.peakBytesInUse;
+        stats.allocator.bytesReserved += allocator.bytesReserved;
+        stats.allocator.bytesAllocated += allocator.bytesAllocated;
+        stats.allocator.pooledBlocks += allocator.pooledBlocks;
+        stats.allocator.largeBlocks += allocator.largeBlocks;
+        stats.gcDebt += state->gcDebt;
+        stats.gcMs += state->gcMs;
+    }
+    return stats;
+}
 
 void ScriptEngine::ExecuteScript(const std::string& file)
 {
     BR_CORE_INFO("[ScriptEngine] Running {}...", file);
 
-    s_data.LuaState->script_file(file, [](lua_State*, sol::protected_function_result result) {
-        BR_CORE_ERROR("[ScriptEngine] Lua error!");
-        return result;
-    });
+    // Everything it defines must be there for every script.
+    for (auto& state : s_data.states)
+    {
+        state->LuaState->script_file(file,
+                                     [](lua_State*, sol::protected_function_result result) {
+                                         BR_CORE_ERROR("[ScriptEngine] Lua error!");
+                                         return result;
+                                     });
+    }
 }
 
-void ScriptEngine::LoadEntityScript(const std::string& file)
+size_t ScriptEngine::AssignState(const std::string& script)
+{
+    // The entities sharing a script share its global table, so its state.
+    auto it = s_data.scriptStates.find(script);
+    if (it == s_data.scriptStates.end())
+    {
+        auto least = std::min_element(
+          s_data.states.begin(), s_data.states.end(), [](const auto& a, const auto& b) {
+              return a->entityCount < b->entityCount;
+          });
+        it = s_data.scriptStates.emplace(script, (*least)->index).first;
+    }
+
+    s_data.states[it->second]->entityCount++;
+    return it->second;
+}
+
+void ScriptEngine::LoadEntityScript(const std::string& file, size_t state)
 {
     BR_CORE_INFO("[ScriptEngine] Running {}...", file.c_str());
 
-    sol::load_result loadResult = s_data.LuaState->load_file(file);
+    sol::load_result loadResult = s_data.states[state]->LuaState->load_file(file);
     if (!loadResult.valid())
     {
         sol::error error = loadResult;
@@ -159,27 +611,202 @@ void ScriptEngine::LoadEntityScript(const std::string& file)
     }
 }
 
+bool ScriptEngine::HasFunction(size_t state, const std::string& script, const char* function)
+{
+    sol::optional<sol::function> f = (*s_data.states[state]->LuaState)[script][function];
+    return f.has_value();
+}
+
+void ScriptEngine::Update(const std::vector<LuaScriptEntity*>& entities, float ts)
+{
+    BR_PROFILE_FUNCTION();
+
+    if (s_data.states.empty())
+    {
+        return;
+    }
+
+    for (auto& state : s_data.states)
+    {
+        state->entities.clear();
+
+        // What is sent during this update is for the next one, whichever state runs first.
+        std::lock_guard<std::mutex> lock(state->mailboxMutex);
+        state->inbox.swap(state->mailbox);
+    }
+    for (LuaScriptEntity* entity : entities)
+    {
+        s_data.states[entity->m_state]->entities.push_back(entity);
+    }
+
+    auto update = [ts](ScriptState& state) {
+        BR_PROFILE_SCOPE("ScriptEngine::UpdateState");
+
+        s_currentState = &state;
+        DeliverMessages(state);
+        UpdateEntities(state, ts);
+        ScriptScheduler::Update(state.LuaState->lua_state(), ts);
+        s_currentState = nullptr;
+    };
+
+    std::mutex              mutex;
+    std::condition_variable done;
+    size_t                  remaining = s_data.states.size() - 1;
+    for (size_t i = 1; i < s_data.states.size(); i++)
+    {
+        s_data.pool->Submit([&, i] {
+            s_isWorkerThread = true;
+            update(*s_data.states[i]);
+            std::lock_guard<std::mutex> lock(mutex);
+            if (--remaining == 0)
+            {
+                done.notify_one();
+            }
+        });
+    }
+
+    update(*s_data.states.front());
+
+    std::unique_lock<std::mutex> lock(mutex);
+    done.wait(lock, [&] { return remaining == 0; });
+}
+
+void ScriptEngine::UpdateEntities(ScriptState& state, float ts)
+{
+    using namespace std::chrono;
+
+    auto start      = steady_clock::now();
+    state.suspended = 0;
+    state.deferred  = 0;
+    state.overBudget.clear();
+
+    bool hasFrameBudget  = s_data.frameBudgetMs > 0.0;
+    bool hasEntityBudget = s_data.entityBudgetMs > 0.0;
+    auto frameDeadline   = start + duration_cast<steady_clock::duration>(
+                                   duration<double, std::milli>(s_data.frameBudgetMs));
+
+    // Starting where the last frame ran out of time, everyone gets a turn.
+    size_t count = state.entities.size();
+    size_t first = count != 0 ? state.roundRobin % count : 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        auto now = steady_clock::now();
+        if (hasFrameBudget && now >= frameDeadline)
+        {
+            state.deferred   = count - i;
+            state.roundRobin = first + i;
+            break;
+        }
+
+        s_hasDeadline = hasFrameBudget || hasEntityBudget;
+        s_deadline    = hasFrameBudget ? frameDeadline : steady_clock::time_point::max();
+        if (hasEntityBudget)
+        {
+            s_deadline = std::min(s_deadline,
+                                  now + duration_cast<steady_clock::duration>(
+                                          duration<double, std::milli>(s_data.entityBudgetMs)));
+        }
+
+        LuaScriptEntity* entity = state.entities[(first + i) % count];
+        entity->OnUpdate(ts);
+        if (entity->m_isUpdateSuspended)
+        {
+            state.suspended++;
+            state.overBudget.push_back(entity->GetName());
+        }
+    }
+    s_hasDeadline = false;
+
+    state.updateMs = duration<float, std::milli>(steady_clock::now() - start).count();
+}
+
 void ScriptEngine::OnCreate(LuaScriptEntity* entity)
 {
-    auto& lua = *s_data.LuaState;
+    BR_PROFILE_FUNCTION();
+
+    auto& lua = *s_data.states[entity->m_state]->LuaState;
     LUA_CALL(entity->GetName(), "OnCreate");
 }
 
 void ScriptEngine::OnDestroyed(const LuaScriptEntity* entity)
 {
-    auto& lua = *s_data.LuaState;
+    BR_PROFILE_FUNCTION();
+
+    auto& lua = *s_data.states[entity->m_state]->LuaState;
     LUA_CALL(entity->GetName(), "OnDestroyed");
 }
 
-void ScriptEngine::OnUpdate(const LuaScriptEntity* entity, float ts)
+void ScriptEngine::OnUpdate(LuaScriptEntity* entity, float ts)
 {
-    auto& lua = *s_data.LuaState;
-    LUA_CALL(entity->GetName(), "OnUpdate", ts);
+    BR_PROFILE_FUNCTION();
+
+    lua_State* L = s_data.states[entity->m_state]->LuaState->lua_state();
+    if (entity->m_updateThread == nullptr)
+    {
+        entity->m_updateThread    = lua_newthread(L);
+        entity->m_updateThreadRef = luaL_ref(L, LUA_REGISTRYINDEX);
+    }
+
+    // A suspended OnUpdate carries on with the arguments it had.
+    lua_State* thread = entity->m_updateThread;
+    int        nargs  = 0;
+    if (!entity->m_isUpdateSuspended)
+    {
+        lua_getglobal(thread, entity->GetName().c_str());
+        lua_getfield(thread, -1, "OnUpdate");
+        lua_remove(thread, -2);
+        lua_pushnumber(thread, ts);
+        nargs = 1;
+    }
+
+    bool isProfiling = ScriptProfiler::IsRunning();
+    if (s_hasDeadline || isProfiling)
+    {
+        int count = isProfiling ? int(ScriptProfiler::GetInstructionsPerSample())
+                                : s_budgetCheckInstructions;
+        lua_sethook(thread, &BudgetHook, LUA_MASKCOUNT, count);
+    }
+
+    ScriptProfiler::BeginCall(thread, entity->GetName(), "OnUpdate", false);
+    s_updateThread = thread;
+    s_isOverBudget = false;
+    int results    = 0;
+    int status     = lua_resume(thread, L, nargs, &results);
+    s_updateThread = nullptr;
+    ScriptProfiler::EndCall(thread, false);
+    lua_sethook(thread, nullptr, 0, 0);
+
+    entity->m_isUpdateSuspended = status == LUA_YIELD && s_isOverBudget;
+    if (status == LUA_OK || entity->m_isUpdateSuspended)
+    {
+        lua_pop(thread, results);
+        return;
+    }
+
+    if (status == LUA_YIELD)
+    {
+        // A coroutine.yield() of the script, OnUpdate isn't a coroutine as far as it knows.
+        lua_pop(thread, results);
+        luaL_traceback(L, thread, "attempt to yield from outside a coroutine", 0);
+    }
+    else
+    {
+        const char* message = lua_tostring(thread, -1);
+        luaL_traceback(L, thread, message != nullptr ? message : "(no message)", 0);
+    }
+    BR_CORE_ERROR("[ScriptEngine] Lua error in {}.OnUpdate! {}",
+                  entity->GetName(),
+                  lua_tostring(L, -1));
+    lua_pop(L, 1);
+    // Ready for the next frame.
+    lua_resetthread(thread);
 }
 
 void ScriptEngine::OnRender(const LuaScriptEntity* entity)
 {
-    auto& lua = *s_data.LuaState;
+    BR_PROFILE_FUNCTION();
+
+    auto& lua = *s_data.states[entity->m_state]->LuaState;
     LUA_CALL(entity->GetName(), "OnRender");
 }
 
@@ -188,8 +815,10 @@ void ScriptEngine::OnRender(const LuaScriptEntity* entity)
 LuaScriptEntity::LuaScriptEntity(const std::string& path, const std::string& name)
 : m_path(path), m_name(name)
 {
-    ScriptEngine::LoadEntityScript(path);
-    auto& lua = *s_data.LuaState;
+    m_state = ScriptEngine::AssignState(name);
+    ScriptEngine::LoadEntityScript(path, m_state);
+    FindCallbacks();
+    auto& lua = *s_data.states[m_state]->LuaState;
 
     auto self               = lua.new_usertype<LuaScriptEntity>("this", sol::no_constructor);
     self["GetTagComponent"] = [this]() -> TagComponent& {
@@ -205,27 +834,48 @@ LuaScriptEntity::LuaScriptEntity(const std::string& path, const std::string& nam
 
 void LuaScriptEntity::Reload()
 {
-    ScriptEngine::LoadEntityScript(m_path);
+    ScriptEngine::LoadEntityScript(m_path, m_state);
+    FindCallbacks();
 }
 
 void LuaScriptEntity::OnCreate()
 {
-    ScriptEngine::OnCreate(this);
+    if (m_hasOnCreate)
+    {
+        ScriptEngine::OnCreate(this);
+    }
 }
 
 void LuaScriptEntity::OnUpdate(Timestep ts)
 {
-    ScriptEngine::OnUpdate(this, ts);
+    if (m_hasOnUpdate)
+    {
+        ScriptEngine::OnUpdate(this, ts);
+    }
 }
 
 void LuaScriptEntity::OnRender()
 {
-    ScriptEngine::OnRender(this);
+    if (m_hasOnRender)
+    {
+        ScriptEngine::OnRender(this);
+    }
 }
 
 void LuaScriptEntity::OnDestroy()
 {
-    ScriptEngine::OnDestroyed(this);
+    if (m_hasOnDestroy)
+    {
+        ScriptEngine::OnDestroyed(this);
+    }
+}
+
+void LuaScriptEntity::FindCallbacks()
+{
+    m_hasOnCreate  = ScriptEngine::HasFunction(m_state, m_name, "OnCreate");
+    m_hasOnUpdate  = ScriptEngine::HasFunction(m_state, m_name, "OnUpdate");
+    m_hasOnRender  = ScriptEngine::HasFunction(m_state, m_name, "OnRender");
+    m_hasOnDestroy = ScriptEngine::HasFunction(m_state, m_name, "OnDestroyed");
 }
 /*********************************************************************************************************************/
 // [SECTION] Private Function Declarations
@@ -29,8 +29,12 @@
 
 #include "Brigerad/Core/Timestep.h"
 #include "Brigerad/Scene/Entity.h"
+#include "Brigerad/Script/LuaAllocator.h"
 
 #include <string>
+#include <vector>
+
+struct lua_State;
 
 namespace Brigerad
 {
@@ -64,11 +68,27 @@ protected:
     void OnRender();
     void OnDestroy();
 
+private:
+    void FindCallbacks();
+
 private:
     Entity      m_entity;
-    std::string m_path = "";
-    std::string m_name = "";
+    std::string m_path  = "";
+    std::string m_name  = "";
+    size_t      m_state = 0;    // The Lua state running the script.
+
+    // The callbacks the script doesn't define are never called, idle scripts cost nothing.
+    bool m_hasOnCreate  = false;
+    bool m_hasOnUpdate  = false;
+    bool m_hasOnRender  = false;
+    bool m_hasOnDestroy = false;
+
+    // OnUpdate runs in a coroutine of its own, suspended where it is when over its time budget.
+    lua_State* m_updateThread      = nullptr;
+    int        m_updateThreadRef   = -2;    // LUA_NOREF.
+    bool       m_isUpdateSuspended = false;
     friend class Scene;
+    friend class ScriptEngine;
 };    // namespace Brigerad
 
 
@@ -83,16 +103,74 @@ private:
 class ScriptEngine
 {
 public:
-    static void Init();
+    static void Init(size_t stateCount = 1);
     static void Shutdown();
 
+    /**
+     * The scripts are spread over count Lua states, updated in parallel, one per thread. Each state
+     * has its own bindings and globals, the scripts of different states talk to each other with
+     * send(script, message), which calls script.OnMessage(message) on the next update.
+     * Must be called before any script is loaded.
+     */
+    static void   SetStateCount(size_t count);
+    static size_t GetStateCount();
+
+    struct MemoryStats
+    {
+        size_t              stateCount = 0;
+        LuaAllocator::Stats allocator;    // Summed over the states.
+        size_t              gcDebt = 0;       // Bytes the collector still has to go through.
+        float               gcMs   = 0.0f;    // Time spent collecting in the last frame.
+    };
+
+    /**
+     * The collector doesn't run on its own: once per frame, this does the incremental collection
+     * work owed for what the scripts allocated since the last call, for at most budgetMs. What
+     * doesn't fit is carried over to the next frame.
+     */
+    static void        StepGarbageCollector(double budgetMs);
+    static MemoryStats GetMemoryStats();
+
+    /** Runs the script in every state. */
     static void ExecuteScript(const std::string& file);
-    static void LoadEntityScript(const std::string& file);
+    /** The state the script will run in, the least busy one for a new script. */
+    static size_t AssignState(const std::string& script);
+    static void   LoadEntityScript(const std::string& file, size_t state = 0);
+    /** True if the global table of the script defines the function. */
+    static bool HasFunction(size_t state, const std::string& script, const char* function);
+
+    /**
+     * Caps the time spent in OnUpdate, in milliseconds, 0 for no limit. Each state gets frameMs per
+     * frame, each entity entityMs. A script going over is suspended where it is and picks up from
+     * there on the next frame. Past the frame budget, the remaining entities wait for the next
+     * frame, where they go first.
+     */
+    static void SetTimeBudget(double frameMs, double entityMs);
+
+    struct BudgetStats
+    {
+        float                    updateMs  = 0.0f;    // In OnUpdate, for the slowest state.
+        size_t                   suspended = 0;       // OnUpdate suspended over budget.
+        size_t                   deferred  = 0;       // Entities that didn't get to run.
+        std::vector<std::string> overBudget;          // The scripts suspended.
+    };
+    static BudgetStats GetBudgetStats();
+
+    /**
+     * Run OnUpdate for the entities and resume the coroutines, every state on its own thread.
+     * The states don't share anything Lua, but the bindings reach the engine: this is the last
+     * entity created in the state, and what isn't thread-safe, Renderer2D.DrawQuad and
+     * Texture2D.Create, raises an error during the update of a state other than the first.
+     */
+    static void Update(const std::vector<LuaScriptEntity*>& entities, float ts);
 
     // Lua functions to call from C++.
     static void OnCreate(LuaScriptEntity* entity);
     static void OnDestroyed(const LuaScriptEntity* entity);
-    static void OnUpdate(const LuaScriptEntity* entity, float ts);
+    static void OnUpdate(LuaScriptEntity* entity, float ts);
     static void OnRender(const LuaScriptEntity* entity);
+
+private:
+    static void UpdateEntities(struct ScriptState& state, float ts);
 };
 }    // namespace Brigerad
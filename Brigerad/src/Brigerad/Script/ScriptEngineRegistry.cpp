@@ -29,8 +29,19 @@
 
 #include "ScriptEngineRegistry.h"
 
+#define SOL_ALL_SAFETIES_ON 1
+#define SOL_SAFE_USERTYPE   1
+#define SOL_CHECK_ARGUMENTS 1
+#include <sol/sol.hpp>
+
+#include <chrono>
+
 namespace Brigerad
 {
+namespace Scripting
+{
+extern sol::state* GetState();
+}
 /*********************************************************************************************************************/
 // [SECTION] Private Macro Definitions
 /*********************************************************************************************************************/
@@ -55,11 +66,26 @@ void ScriptEngineRegistry::RegisterAllTypes()
     RegisterTexture2D();
     RegisterSubTexture2D();
     RegisterDrawQuad();
+    RegisterClock();
 }
 
 /*********************************************************************************************************************/
 // [SECTION] Private Method Definitions
 /*********************************************************************************************************************/
+/**
+ * @brief   Clock.Now(), seconds from an arbitrary origin, to time things from the scripts.
+ */
+void ScriptEngineRegistry::RegisterClock()
+{
+    auto lua = Scripting::GetState();
+
+    auto clock   = lua->create_named_table("Clock");
+    clock["Now"] = []() -> double {
+        return std::chrono::duration<double>(
+                 std::chrono::steady_clock::now().time_since_epoch())
+          .count();
+    };
+}
 
 
 /*********************************************************************************************************************/
@@ -52,5 +52,6 @@ private:
     static void RegisterTexture2D();
     static void RegisterSubTexture2D();
     static void RegisterDrawQuad();
+    static void RegisterClock();
 };
 }    // namespace Brigerad
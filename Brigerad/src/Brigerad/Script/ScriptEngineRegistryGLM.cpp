@@ -37,6 +37,8 @@
 #include "glm/glm.hpp"
 #include "glm/gtc/matrix_transform.hpp"
 
+#include <algorithm>
+#include <functional>
 #include <string>
 
 namespace Brigerad
@@ -53,7 +55,179 @@ extern sol::state* GetState();
 /*********************************************************************************************************************/
 // [SECTION] Private Function Declarations
 /*********************************************************************************************************************/
+// The vectors are bound with raw Lua functions instead of sol::overload: the type of each operand
+// is read once and the operation is done right away, without trying every overload in turn.
+// The *InPlace methods and the batch helpers modify existing vectors and return them, so a script
+// can do its math every frame without creating a single userdata.
 
+// Registry key of the metatable of the vectors held by value, one per type.
+template<typename Vec>
+static const char s_metatableKey = 0;
+
+template<typename Vec>
+static Vec& CheckVec(lua_State* L, int index)
+{
+    // Vectors created by the scripts are held by value, compare their metatable with the one of
+    // the type before falling back on sol's check, which also accepts pointers and references.
+    bool isValue = false;
+    if (lua_getmetatable(L, index) != 0)
+    {
+        lua_rawgetp(L, LUA_REGISTRYINDEX, &s_metatableKey<Vec>);
+        isValue = lua_rawequal(L, -1, -2) != 0;
+        lua_pop(L, 2);
+    }
+
+    if (!isValue && !sol::stack::check<Vec>(L, index))
+    {
+        luaL_argerror(L, index, "vector of the wrong size");
+    }
+    return sol::stack::unqualified_get<Vec&>(L, index);
+}
+
+/**
+ * @brief   Get an operand that is either a vector or a number, spread over every component.
+ */
+template<typename Vec>
+static Vec GetOperand(lua_State* L, int index)
+{
+    if (lua_type(L, index) == LUA_TNUMBER)
+    {
+        return Vec((float)lua_tonumber(L, index));
+    }
+    return CheckVec<Vec>(L, index);
+}
+
+/**
+ * @brief   a + b, a - b, a * b and a / b, with either side being a number.
+ *          Pushes a new vector.
+ */
+template<typename Vec, typename Op>
+static int Arithmetic(lua_State* L)
+{
+    return sol::stack::push(L, Op()(GetOperand<Vec>(L, 1), GetOperand<Vec>(L, 2)));
+}
+
+template<typename Vec>
+static int Equal(lua_State* L)
+{
+    lua_pushboolean(L, CheckVec<Vec>(L, 1) == CheckVec<Vec>(L, 2));
+    return 1;
+}
+
+template<typename Vec>
+static int UnaryMinus(lua_State* L)
+{
+    return sol::stack::push(L, -CheckVec<Vec>(L, 1));
+}
+
+/**
+ * @brief   v:addInPlace(w), v:subInPlace(w), v:mulInPlace(w) and v:divInPlace(w), w being a vector
+ *          or a number. Returns v.
+ */
+template<typename Vec, typename Op>
+static int InPlace(lua_State* L)
+{
+    Vec& self = CheckVec<Vec>(L, 1);
+    self      = Op()(self, GetOperand<Vec>(L, 2));
+    lua_settop(L, 1);
+    return 1;
+}
+
+/**
+ * @brief   v:set(x, y, ...), one number per component, or v:set(w) to copy another vector.
+ *          Returns v.
+ */
+template<typename Vec>
+static int Set(lua_State* L)
+{
+    Vec& self = CheckVec<Vec>(L, 1);
+    if (lua_type(L, 2) == LUA_TNUMBER)
+    {
+        for (int i = 0; i < Vec::length(); i++)
+        {
+            self[i] = (float)luaL_checknumber(L, i + 2);
+        }
+    }
+    else
+    {
+        self = CheckVec<Vec>(L, 2);
+    }
+    lua_settop(L, 1);
+    return 1;
+}
+
+/**
+ * @brief   vec.addAll(list, w), vec.subAll(list, w), vec.mulAll(list, w) and vec.divAll(list, w):
+ *          apply the operation in place to every vector of the list, w being a vector or a number.
+ */
+template<typename Vec, typename Op>
+static int BatchInPlace(lua_State* L)
+{
+    luaL_checktype(L, 1, LUA_TTABLE);
+    Vec operand = GetOperand<Vec>(L, 2);
+
+    lua_Integer count = (lua_Integer)lua_rawlen(L, 1);
+    for (lua_Integer i = 1; i <= count; i++)
+    {
+        lua_rawgeti(L, 1, i);
+        Vec& v = CheckVec<Vec>(L, -1);
+        v      = Op()(v, operand);
+        lua_pop(L, 1);
+    }
+    return 0;
+}
+
+/**
+ * @brief   vec.addScaledAll(list, others, f): list[i] += others[i] * f for every vector of the
+ *          lists, like moving positions by their velocities times a time step.
+ */
+template<typename Vec>
+static int BatchAddScaled(lua_State* L)
+{
+    luaL_checktype(L, 1, LUA_TTABLE);
+    luaL_checktype(L, 2, LUA_TTABLE);
+    float factor = (float)luaL_checknumber(L, 3);
+
+    lua_Integer count = (lua_Integer)std::min(lua_rawlen(L, 1), lua_rawlen(L, 2));
+    for (lua_Integer i = 1; i <= count; i++)
+    {
+        lua_rawgeti(L, 1, i);
+        lua_rawgeti(L, 2, i);
+        CheckVec<Vec>(L, -2) += CheckVec<Vec>(L, -1) * factor;
+        lua_pop(L, 2);
+    }
+    return 0;
+}
+
+/**
+ * @brief   Register the operators, the in-place methods and the batch helpers of a vector type
+ *          whose constructors and components are already bound.
+ */
+template<typename Vec>
+static void RegisterVecMath(lua_State* L, sol::usertype<Vec>& type)
+{
+    luaL_getmetatable(L, sol::usertype_traits<Vec>::metatable().c_str());
+    lua_rawsetp(L, LUA_REGISTRYINDEX, &s_metatableKey<Vec>);
+
+    type[sol::meta_function::addition]       = &Arithmetic<Vec, std::plus<Vec>>;
+    type[sol::meta_function::subtraction]    = &Arithmetic<Vec, std::minus<Vec>>;
+    type[sol::meta_function::multiplication] = &Arithmetic<Vec, std::multiplies<Vec>>;
+    type[sol::meta_function::division]       = &Arithmetic<Vec, std::divides<Vec>>;
+    type[sol::meta_function::unary_minus]    = &UnaryMinus<Vec>;
+    type[sol::meta_function::equal_to]       = &Equal<Vec>;
+
+    type["addInPlace"] = &InPlace<Vec, std::plus<Vec>>;
+    type["subInPlace"] = &InPlace<Vec, std::minus<Vec>>;
+    type["mulInPlace"] = &InPlace<Vec, std::multiplies<Vec>>;
+    type["divInPlace"] = &InPlace<Vec, std::divides<Vec>>;
+    type["set"]        = &Set<Vec>;
+
+    type["addAll"]       = &BatchInPlace<Vec, std::plus<Vec>>;
+    type["subAll"]       = &BatchInPlace<Vec, std::minus<Vec>>;
+    type["mulAll"]       = &BatchInPlace<Vec, std::multiplies<Vec>>;
+    type["divAll"]       = &BatchInPlace<Vec, std::divides<Vec>>;
+    type["addScaledAll"] = &BatchAddScaled<Vec>;
+}
 
 /*********************************************************************************************************************/
 // [SECTION] Public Method Definitions
@@ -68,76 +242,21 @@ void ScriptEngineRegistry::RegisterVec2()
 {
     auto lua = Scripting::GetState();
 
-    auto addOverloads =
-      sol::overload([](const glm::vec2& v1, const glm::vec2& v2) -> glm::vec2 { return v1 + v2; },
-                    [](const glm::vec2& v1, float f) -> glm::vec2 { return v1 + f; },
-                    [](float f, const glm::vec2& v1) -> glm::vec2 { return v1 + f; });
-
-    auto subOverloads =
-      sol::overload([](const glm::vec2& v1, const glm::vec2& v2) -> glm::vec2 { return v1 - v2; },
-                    [](const glm::vec2& v1, float f) -> glm::vec2 { return v1 - f; },
-                    [](float f, const glm::vec2& v1) -> glm::vec2 { return v1 - f; });
-
-    auto multOverloads =
-      sol::overload([](const glm::vec2& v1, const glm::vec2& v2) -> glm::vec2 { return v1 * v2; },
-                    [](const glm::vec2& v1, float f) -> glm::vec2 { return v1 * f; },
-                    [](float f, const glm::vec2& v1) -> glm::vec2 { return v1 * f; });
-
-    auto divOverloads =
-      sol::overload([](const glm::vec2& v1, const glm::vec2& v2) -> glm::vec2 { return v1 - v2; },
-                    [](const glm::vec2& v1, float f) -> glm::vec2 { return v1 - f; },
-                    [](float f, const glm::vec2& v1) -> glm::vec2 { return v1 - f; });
-
-    auto eqOverloads =
-      sol::overload([](const glm::vec2& v1, const glm::vec2& v2) -> bool { return v1 == v2; });
-
-    lua->new_usertype<glm::vec2>(
+    auto vec2 = lua->new_usertype<glm::vec2>(
       "vec2",
       sol::constructors<glm::vec2(), glm::vec2(float), glm::vec2(float, float)>(),
       "x",
       &glm::vec2::x,
       "y",
-      &glm::vec2::y,
-      sol::meta_function::addition,
-      addOverloads,
-      sol::meta_function::subtraction,
-      subOverloads,
-      sol::meta_function::multiplication,
-      multOverloads,
-      sol::meta_function::division,
-      divOverloads,
-      sol::meta_function::equal_to,
-      eqOverloads);
+      &glm::vec2::y);
+    RegisterVecMath(lua->lua_state(), vec2);
 }
 
 void ScriptEngineRegistry::RegisterVec3()
 {
     auto lua = Scripting::GetState();
 
-    auto addOverloads =
-      sol::overload([](const glm::vec3& v1, const glm::vec3& v2) -> glm::vec3 { return v1 + v2; },
-                    [](const glm::vec3& v1, float f) -> glm::vec3 { return v1 + f; },
-                    [](float f, const glm::vec3& v1) -> glm::vec3 { return v1 + f; });
-
-    auto subOverloads =
-      sol::overload([](const glm::vec3& v1, const glm::vec3& v2) -> glm::vec3 { return v1 - v2; },
-                    [](const glm::vec3& v1, float f) -> glm::vec3 { return v1 - f; },
-                    [](float f, const glm::vec3& v1) -> glm::vec3 { return v1 - f; });
-
-    auto multOverloads =
-      sol::overload([](const glm::vec3& v1, const glm::vec3& v2) -> glm::vec3 { return v1 * v2; },
-                    [](const glm::vec3& v1, float f) -> glm::vec3 { return v1 * f; },
-                    [](float f, const glm::vec3& v1) -> glm::vec3 { return v1 * f; });
-
-    auto divOverloads =
-      sol::overload([](const glm::vec3& v1, const glm::vec3& v2) -> glm::vec3 { return v1 - v2; },
-                    [](const glm::vec3& v1, float f) -> glm::vec3 { return v1 - f; },
-                    [](float f, const glm::vec3& v1) -> glm::vec3 { return v1 - f; });
-
-    auto eqOverloads =
-      sol::overload([](const glm::vec3& v1, const glm::vec3& v2) -> bool { return v1 == v2; });
-
-    lua->new_usertype<glm::vec3>(
+    auto vec3 = lua->new_usertype<glm::vec3>(
       "vec3",
       sol::constructors<glm::vec3(), glm::vec3(float), glm::vec3(float, float, float)>(),
       "x",
@@ -145,47 +264,15 @@ void ScriptEngineRegistry::RegisterVec3()
       "y",
       &glm::vec3::y,
       "z",
-      &glm::vec3::z,
-      sol::meta_function::addition,
-      addOverloads,
-      sol::meta_function::subtraction,
-      subOverloads,
-      sol::meta_function::multiplication,
-      multOverloads,
-      sol::meta_function::division,
-      divOverloads,
-      sol::meta_function::equal_to,
-      eqOverloads);
+      &glm::vec3::z);
+    RegisterVecMath(lua->lua_state(), vec3);
 }
 
 void ScriptEngineRegistry::RegisterVec4()
 {
     auto lua = Scripting::GetState();
 
-    auto addOverloads =
-      sol::overload([](const glm::vec4& v1, const glm::vec4& v2) -> glm::vec4 { return v1 + v2; },
-                    [](const glm::vec4& v1, float f) -> glm::vec4 { return v1 + f; },
-                    [](float f, const glm::vec4& v1) -> glm::vec4 { return v1 + f; });
-
-    auto subOverloads =
-      sol::overload([](const glm::vec4& v1, const glm::vec4& v2) -> glm::vec4 { return v1 - v2; },
-                    [](const glm::vec4& v1, float f) -> glm::vec4 { return v1 - f; },
-                    [](float f, const glm::vec4& v1) -> glm::vec4 { return v1 - f; });
-
-    auto multOverloads =
-      sol::overload([](const glm::vec4& v1, const glm::vec4& v2) -> glm::vec4 { return v1 * v2; },
-                    [](const glm::vec4& v1, float f) -> glm::vec4 { return v1 * f; },
-                    [](float f, const glm::vec4& v1) -> glm::vec4 { return v1 * f; });
-
-    auto divOverloads =
-      sol::overload([](const glm::vec4& v1, const glm::vec4& v2) -> glm::vec4 { return v1 - v2; },
-                    [](const glm::vec4& v1, float f) -> glm::vec4 { return v1 - f; },
-                    [](float f, const glm::vec4& v1) -> glm::vec4 { return v1 - f; });
-
-    auto eqOverloads =
-      sol::overload([](const glm::vec4& v1, const glm::vec4& v2) -> bool { return v1 == v2; });
-
-    lua->new_usertype<glm::vec4>(
+    auto vec4 = lua->new_usertype<glm::vec4>(
       "vec4",
       sol::constructors<glm::vec4(), glm::vec4(float), glm::vec4(float, float, float, float)>(),
       "x",
@@ -195,17 +282,8 @@ void ScriptEngineRegistry::RegisterVec4()
       "z",
       &glm::vec4::z,
       "w",
-      &glm::vec4::w,
-      sol::meta_function::addition,
-      addOverloads,
-      sol::meta_function::subtraction,
-      subOverloads,
-      sol::meta_function::multiplication,
-      multOverloads,
-      sol::meta_function::division,
-      divOverloads,
-      sol::meta_function::equal_to,
-      eqOverloads);
+      &glm::vec4::w);
+    RegisterVecMath(lua->lua_state(), vec4);
 }
 
 void ScriptEngineRegistry::RegisterMat4()
@@ -42,6 +42,8 @@ namespace Brigerad
 namespace Scripting
 {
 extern sol::state* GetState();
+// Raises an error instead of calling the function from a worker thread.
+extern sol::object MainThreadOnly(const char* name, const sol::object& function);
 }
 /*********************************************************************************************************************/
 // [SECTION] Private Macro Definitions
@@ -66,8 +68,9 @@ void ScriptEngineRegistry::RegisterDrawQuad()
 {
     auto lua = Scripting::GetState();
 
+    // The batch of Renderer2D isn't locked, only the main thread draws.
     auto renderer        = lua->new_usertype<Renderer2D>("Renderer2D", sol::no_constructor);
-    renderer["DrawQuad"] = sol::overload(
+    auto drawQuad        = sol::overload(
       static_cast<void (*)(const glm::vec2&, const glm::vec2&, const glm::vec4&)>(
         &Renderer2D::DrawQuad),
       static_cast<void (*)(const glm::vec3&, const glm::vec2&, const glm::vec4&)>(
@@ -124,6 +127,8 @@ void ScriptEngineRegistry::RegisterDrawQuad()
          const Ref<SubTexture2D>& texture,
          const glm::vec2&         scale,
          const glm::vec4&         tint) { Renderer2D::DrawQuad(pos, size, texture, scale, tint); });
+    renderer["DrawQuad"] = Scripting::MainThreadOnly(
+      "Renderer2D.DrawQuad", sol::make_object(lua->lua_state(), std::move(drawQuad)));
 }
 
 /*********************************************************************************************************************/
@@ -41,6 +41,8 @@ namespace Brigerad
 namespace Scripting
 {
 extern sol::state* GetState();
+// Raises an error instead of calling the function from a worker thread.
+extern sol::object MainThreadOnly(const char* name, const sol::object& function);
 }
 /*********************************************************************************************************************/
 // [SECTION] Private Macro Definitions
@@ -64,9 +66,14 @@ void ScriptEngineRegistry::RegisterTexture2D()
     auto lua = Scripting::GetState();
 
     auto texture2D      = lua->new_usertype<Texture2D>("Texture2D", sol::no_constructor);
-    texture2D["Create"] = sol::overload(
-      static_cast<Ref<Texture2D> (*)(const std::string&)>(&Texture2D::Create),
-      static_cast<Ref<Texture2D> (*)(uint32_t, uint32_t, uint8_t)>(&Texture2D::Create));
+    // The GL objects are created on the main thread, or queued to the render thread from it.
+    texture2D["Create"] = Scripting::MainThreadOnly(
+      "Texture2D.Create",
+      sol::make_object(
+        lua->lua_state(),
+        sol::overload(
+          static_cast<Ref<Texture2D> (*)(const std::string&)>(&Texture2D::Create),
+          static_cast<Ref<Texture2D> (*)(uint32_t, uint32_t, uint8_t)>(&Texture2D::Create))));
     texture2D["GetWidth"]    = &Texture2D::GetWidth;
     texture2D["GetHeight"]   = &Texture2D::GetHeight;
     texture2D["GetFormat"]   = &Texture2D::GetFormat;
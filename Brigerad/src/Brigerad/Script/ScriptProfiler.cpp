@@ -0,0 +1,414 @@
+/**
+ * @file    ScriptProfiler.cpp
+ * @author  Samuel Martel
+ * @p       https://github.com/smartel99
+ * @date    10/19/2026 9:20:00 PM
+ *
+ * @brief
+ ******************************************************************************
+ * Copyright (C) 2020  Samuel Martel
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *****************************************************************************/
+
+/*********************************************************************************************************************/
+// [SECTION] Includes
+/*********************************************************************************************************************/
+#include "brpch.h"
+#include "ScriptProfiler.h"
+
+#include "Brigerad/Debug/Instrumentor.h"
+
+#include "lua.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+namespace Brigerad
+{
+/*********************************************************************************************************************/
+// [SECTION] Private Variable Definitions
+/*********************************************************************************************************************/
+using Clock = std::chrono::high_resolution_clock;
+
+// Identity of a function, the strings of lua_Debug are interned by Lua.
+struct FunctionKey
+{
+    const char* source;
+    int         line;
+    const char* name;    // Only for C functions, which all share the same source.
+
+    bool operator==(const FunctionKey& other) const
+    {
+        return source == other.source && line == other.line && name == other.name;
+    }
+};
+
+struct FunctionKeyHash
+{
+    size_t operator()(const FunctionKey& key) const
+    {
+        return std::hash<const void*>()(key.source) ^ (std::hash<int>()(key.line) << 1) ^
+               (std::hash<const void*>()(key.name) << 2);
+    }
+};
+
+struct FunctionData
+{
+    ScriptProfiler::FunctionStats   stats;
+    std::unordered_map<int, double> lineSelfMs;
+    uint64_t                        lastSample = 0;    // To count recursive functions once.
+};
+
+// A function on the stack in the trace output, written once it leaves the stack.
+struct OpenSpan
+{
+    uint32_t          function;
+    Clock::time_point start;
+};
+
+struct ScriptProfilerData
+{
+    std::mutex mutex;
+
+    std::atomic<bool> isRunning             {false};    // Read without the lock on every call.
+    bool              traceOutput           = false;
+    uint32_t          instructionsPerSample = 1000;
+
+    std::unordered_map<FunctionKey, uint32_t, FunctionKeyHash> functionIds;
+    std::unordered_map<std::string, uint32_t>                  callIds;
+    std::vector<FunctionData>                                  functions;
+    ScriptProfiler::CallNode                                   root;
+    double                                                     totalMs     = 0.0;
+    uint64_t                                                   sampleCount = 0;
+    uint64_t                                                   generation  = 0;    // Of Clear.
+};
+
+// The call in progress on a thread, every Lua state runs its scripts on its own thread.
+struct CallState
+{
+    bool                  inCall = false;
+    std::string           name;
+    uint32_t              callRoot   = 0;
+    uint64_t              generation = 0;
+    Clock::time_point     lastSample;
+    std::vector<uint32_t> stack;    // Root first.
+    std::vector<OpenSpan> openSpans;
+};
+
+static ScriptProfilerData     s_data;
+static thread_local CallState s_call;
+
+/*********************************************************************************************************************/
+// [SECTION] Private Function Declarations
+/*********************************************************************************************************************/
+static uint32_t AddFunction(std::string name)
+{
+    FunctionData data;
+    data.stats.name = std::move(name);
+    s_data.functions.push_back(std::move(data));
+    return uint32_t(s_data.functions.size() - 1);
+}
+
+// Must be called with the lock held.
+static uint32_t GetCallId(const std::string& name)
+{
+    auto it = s_data.callIds.find(name);
+    if (it == s_data.callIds.end())
+    {
+        it = s_data.callIds.emplace(name, AddFunction(name)).first;
+    }
+    return it->second;
+}
+
+// Must be called with the lock held. The ids of the call are stale once Clear went through.
+static void RefreshCall()
+{
+    if (s_call.generation != s_data.generation)
+    {
+        s_call.generation = s_data.generation;
+        s_call.callRoot   = GetCallId(s_call.name);
+        s_call.openSpans.clear();
+    }
+}
+
+static uint32_t GetFunctionId(const lua_Debug& ar)
+{
+    bool        isC = ar.what != nullptr && ar.what[0] == 'C';
+    FunctionKey key = {ar.source, ar.linedefined, isC ? ar.name : nullptr};
+
+    auto it = s_data.functionIds.find(key);
+    if (it != s_data.functionIds.end())
+    {
+        return it->second;
+    }
+
+    std::string name = ar.name != nullptr      ? ar.name
+                       : ar.what[0] == 'm' ? "main chunk"
+                                           : "(anonymous)";
+    if (isC)
+    {
+        name += " [C]";
+    }
+    else
+    {
+        name += " (" + std::string(ar.short_src) + ":" + std::to_string(ar.linedefined) + ")";
+    }
+
+    uint32_t id = AddFunction(std::move(name));
+    s_data.functionIds.emplace(key, id);
+    return id;
+}
+
+static void WriteSpan(const OpenSpan& span, Clock::time_point end)
+{
+    using namespace std::chrono;
+    long long start = time_point_cast<microseconds>(span.start).time_since_epoch().count();
+    long long stop  = time_point_cast<microseconds>(end).time_since_epoch().count();
+    uint32_t  threadID = (uint32_t)std::hash<std::thread::id> {}(std::this_thread::get_id());
+    Instrumentor::Get().WriteProfile(
+      {s_data.functions[span.function].stats.name, start, stop, threadID});
+}
+
+/**
+ * @brief   Account the time since the last sample to the functions of s_call.stack.
+ */
+static void AddSample(Clock::time_point now, int topLine)
+{
+    double ms         = std::chrono::duration<double, std::milli>(now - s_call.lastSample).count();
+    uint64_t sampleId = ++s_data.sampleCount;
+
+    s_data.totalMs += ms;
+    ScriptProfiler::CallNode* node = &s_data.root;
+    node->totalMs += ms;
+    for (uint32_t function : s_call.stack)
+    {
+        auto child = std::find_if(node->children.begin(),
+                                  node->children.end(),
+                                  [=](const auto& c) { return c.function == function; });
+        if (child == node->children.end())
+        {
+            node->children.emplace_back(function);
+            child = node->children.end() - 1;
+        }
+        node = &*child;
+        node->totalMs += ms;
+
+        FunctionData& data = s_data.functions[function];
+        if (data.lastSample != sampleId)
+        {
+            data.lastSample = sampleId;
+            data.stats.totalMs += ms;
+            data.stats.samples++;
+        }
+    }
+    node->selfMs += ms;
+
+    FunctionData& top = s_data.functions[s_call.stack.back()];
+    top.stats.selfMs += ms;
+    if (topLine >= 0)
+    {
+        top.lineSelfMs[topLine] += ms;
+    }
+
+    if (s_data.traceOutput)
+    {
+        // Close what left the stack, open what came in, the interval belongs to the new stack.
+        size_t common = 0;
+        while (common < s_call.openSpans.size() && common < s_call.stack.size() &&
+               s_call.openSpans[common].function == s_call.stack[common])
+        {
+            common++;
+        }
+        while (s_call.openSpans.size() > common)
+        {
+            WriteSpan(s_call.openSpans.back(), s_call.lastSample);
+            s_call.openSpans.pop_back();
+        }
+        for (size_t i = common; i < s_call.stack.size(); i++)
+        {
+            s_call.openSpans.push_back({s_call.stack[i], s_call.lastSample});
+        }
+    }
+
+    s_call.lastSample = now;
+}
+
+static void SampleHook(lua_State* L, lua_Debug* ar)
+{
+    if (ar->event == LUA_HOOKCOUNT)
+    {
+        ScriptProfiler::Sample(L);
+    }
+}
+
+/*********************************************************************************************************************/
+// [SECTION] Public Method Definitions
+/*********************************************************************************************************************/
+void ScriptProfiler::Start(uint32_t instructionsPerSample)
+{
+    std::lock_guard<std::mutex> lock(s_data.mutex);
+    s_data.isRunning             = true;
+    s_data.instructionsPerSample = std::max(instructionsPerSample, 1u);
+}
+
+void ScriptProfiler::Stop()
+{
+    std::lock_guard<std::mutex> lock(s_data.mutex);
+    s_data.isRunning = false;
+}
+
+bool ScriptProfiler::IsRunning()
+{
+    return s_data.isRunning;
+}
+
+void ScriptProfiler::Clear()
+{
+    std::lock_guard<std::mutex> lock(s_data.mutex);
+    s_data.functionIds.clear();
+    s_data.callIds.clear();
+    s_data.functions.clear();
+    s_data.root        = {};
+    s_data.totalMs     = 0.0;
+    s_data.sampleCount = 0;
+    s_data.generation++;
+}
+
+void ScriptProfiler::SetTraceOutput(bool enabled)
+{
+    std::lock_guard<std::mutex> lock(s_data.mutex);
+    s_data.traceOutput = enabled;
+}
+
+bool ScriptProfiler::GetTraceOutput()
+{
+    std::lock_guard<std::mutex> lock(s_data.mutex);
+    return s_data.traceOutput;
+}
+
+uint32_t ScriptProfiler::GetInstructionsPerSample()
+{
+    std::lock_guard<std::mutex> lock(s_data.mutex);
+    return s_data.instructionsPerSample;
+}
+
+void ScriptProfiler::BeginCall(lua_State*         L,
+                               const std::string& script,
+                               const char*        callback,
+                               bool               installHook)
+{
+    if (!s_data.isRunning)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(s_data.mutex);
+    s_call.name       = script + "." + callback;
+    s_call.generation = s_data.generation;
+    s_call.callRoot   = GetCallId(s_call.name);
+
+    s_call.inCall     = true;
+    s_call.lastSample = Clock::now();
+    s_call.openSpans.clear();
+    if (installHook)
+    {
+        lua_sethook(L, &SampleHook, LUA_MASKCOUNT, int(s_data.instructionsPerSample));
+    }
+}
+
+void ScriptProfiler::EndCall(lua_State* L, bool removeHook)
+{
+    Clock::time_point           now = Clock::now();
+    std::lock_guard<std::mutex> lock(s_data.mutex);
+    // Still closes a call started before Stop.
+    if (!s_call.inCall)
+    {
+        return;
+    }
+    RefreshCall();
+
+    // What ran after the last sample is only known to belong to the call.
+    s_call.stack.assign(1, s_call.callRoot);
+    AddSample(now, -1);
+    for (auto span = s_call.openSpans.rbegin(); span != s_call.openSpans.rend(); ++span)
+    {
+        WriteSpan(*span, now);
+    }
+    s_call.openSpans.clear();
+
+    s_call.inCall = false;
+    if (removeHook)
+    {
+        lua_sethook(L, nullptr, 0, 0);
+    }
+}
+
+void ScriptProfiler::Sample(lua_State* L)
+{
+    Clock::time_point           now = Clock::now();
+    std::lock_guard<std::mutex> lock(s_data.mutex);
+    if (!s_call.inCall)
+    {
+        return;
+    }
+    RefreshCall();
+
+    // lua_getstack goes from the top of the stack down, the samples are stored root first.
+    s_call.stack.clear();
+    int       topLine = -1;
+    lua_Debug frame;
+    for (int level = 0; lua_getstack(L, level, &frame) != 0; level++)
+    {
+        lua_getinfo(L, "Snl", &frame);
+        if (level == 0)
+        {
+            topLine = frame.currentline;
+        }
+        s_call.stack.push_back(GetFunctionId(frame));
+    }
+    s_call.stack.push_back(s_call.callRoot);
+    std::reverse(s_call.stack.begin(), s_call.stack.end());
+
+    AddSample(now, topLine);
+}
+
+ScriptProfiler::Report ScriptProfiler::GetReport()
+{
+    std::lock_guard<std::mutex> lock(s_data.mutex);
+
+    Report report;
+    report.root    = s_data.root;
+    report.totalMs = s_data.totalMs;
+    report.functions.reserve(s_data.functions.size());
+    for (const auto& data : s_data.functions)
+    {
+        FunctionStats stats = data.stats;
+        double        best  = -1.0;
+        for (const auto& [line, ms] : data.lineSelfMs)
+        {
+            if (ms > best)
+            {
+                best          = ms;
+                stats.hotLine = line;
+            }
+        }
+        report.functions.push_back(std::move(stats));
+    }
+    return report;
+}
+}    // namespace Brigerad
@@ -0,0 +1,112 @@
+/**
+ * @file    ScriptProfiler.h
+ * @author  Samuel Martel
+ * @p       https://github.com/smartel99
+ * @date    10/19/2026 9:20:00 PM
+ *
+ * @brief
+ ******************************************************************************
+ * Copyright (C) 2020  Samuel Martel
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *****************************************************************************/
+#pragma once
+
+/*********************************************************************************************************************/
+// [SECTION] Includes
+/*********************************************************************************************************************/
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct lua_State;
+
+namespace Brigerad
+{
+/*********************************************************************************************************************/
+// [SECTION] Class Declarations
+/*********************************************************************************************************************/
+/**
+ * Sampling profiler of the Lua scripts.
+ *
+ * Once started, a count hook takes a sample of the Lua stack every N instructions. Each sample is
+ * weighted by the time elapsed since the previous one, so the results are in milliseconds even
+ * though the sampling is driven by instructions. ScriptEngine brackets every call into a script
+ * with BeginCall/EndCall, which keeps the time spent in C++ between two calls out of the samples
+ * and roots the stacks of a call under the name of the callback, e.g. "Player.OnUpdate". Calls
+ * made on different threads, by different Lua states, are sampled independently.
+ *
+ * With trace output on, the sampled stacks are also written as nested scopes into the current
+ * Instrumentor session, inside the C++ scope that called the script.
+ */
+class ScriptProfiler
+{
+public:
+    struct FunctionStats
+    {
+        std::string name;             // "function (file:line)".
+        double      selfMs  = 0.0;    // Time with the function on top of the stack.
+        double      totalMs = 0.0;    // Time with the function anywhere in the stack.
+        uint32_t    samples = 0;
+        int         hotLine = -1;     // Line of the function with the most self time.
+    };
+
+    /** Node of the call tree, the flame graph. */
+    struct CallNode
+    {
+        uint32_t              function = 0;    // Index in Report::functions.
+        double                totalMs  = 0.0;
+        double                selfMs   = 0.0;
+        std::vector<CallNode> children;
+
+        CallNode() = default;
+        explicit CallNode(uint32_t index) : function(index) {}
+    };
+
+    struct Report
+    {
+        std::vector<FunctionStats> functions;
+        CallNode                   root;    // Sums every call, its function is unused.
+        double                     totalMs = 0.0;
+    };
+
+    /** Start sampling the scripts of the engine, one sample every instructionsPerSample. */
+    static void Start(uint32_t instructionsPerSample = 1000);
+    static void Stop();
+    static bool IsRunning();
+    /** Forget everything sampled so far. */
+    static void Clear();
+
+    /** Write the sampled stacks into the Instrumentor session too. */
+    static void SetTraceOutput(bool enabled);
+    static bool GetTraceOutput();
+
+    /**
+     * Called by ScriptEngine around every call into a script. The profiler hooks L for the call,
+     * unless the caller has a hook of its own, which then calls Sample.
+     */
+    static void BeginCall(lua_State*         L,
+                          const std::string& script,
+                          const char*        callback,
+                          bool               installHook = true);
+    static void EndCall(lua_State* L, bool removeHook = true);
+
+    /** Take a sample of the stack of L, from a count hook. */
+    static void     Sample(lua_State* L);
+    static uint32_t GetInstructionsPerSample();
+
+    /** Copy of the results, safe to call while sampling. */
+    static Report GetReport();
+};
+}    // namespace Brigerad
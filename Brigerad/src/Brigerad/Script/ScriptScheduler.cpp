@@ -0,0 +1,593 @@
+/**
+ * @file    ScriptScheduler.cpp
+ * @author  Samuel Martel
+ * @p       https://github.com/smartel99
+ * @date    10/19/2026 10:30:00 PM
+ *
+ * @brief
+ ******************************************************************************
+ * Copyright (C) 2020  Samuel Martel
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *****************************************************************************/
+
+/*********************************************************************************************************************/
+// [SECTION] Includes
+/*********************************************************************************************************************/
+#include "brpch.h"
+#include "ScriptScheduler.h"
+
+#include "ScriptProfiler.h"
+
+#include "Brigerad/Core/Core.h"
+#include "Brigerad/Events/ImGuiEvents.h"
+#include "Brigerad/Events/KeyEvents.h"
+#include "Brigerad/Events/MouseEvent.h"
+#include "Brigerad/Events/SerialEvents.h"
+
+#include "lua.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <unordered_map>
+
+namespace Brigerad
+{
+/*********************************************************************************************************************/
+// [SECTION] Private Variable Definitions
+/*********************************************************************************************************************/
+// Names of the EventType values, in order, as given to waitEvent.
+static const char* s_eventNames[] = {
+  "None",
+  "WindowClose",
+  "WindowResize",
+  "WindowFocus",
+  "WindowLostFocus",
+  "WindowMoved",
+  "AppTick",
+  "AppUpdate",
+  "AppRender",
+  "KeyPressed",
+  "KeyReleased",
+  "KeyTyped",
+  "MouseButtonPressed",
+  "MouseButtonReleased",
+  "MouseMoved",
+  "MouseScrolled",
+  "ImGuiButtonPressed",
+  "ImGuiButtonReleased",
+  "SerialPortAdded",
+  "SerialPortRemoved",
+};
+static constexpr size_t s_eventTypeCount = sizeof(s_eventNames) / sizeof(s_eventNames[0]);
+static_assert(size_t(EventType::SerialPortRemoved) + 1 == s_eventTypeCount,
+              "s_eventNames must list every EventType");
+
+// The timer wheel of wait() counts in milliseconds, a turn of the wheel is about a second.
+static constexpr double s_ticksPerSecond = 1000.0;
+static constexpr size_t s_timeSlots      = 1024;
+static constexpr size_t s_frameSlots     = 64;
+
+/**
+ * Hashed timer wheel: a timer sits in the slot of its deadline, modulo the number of slots.
+ * Advancing only looks at the slots passed since the last call, timers due in a later turn are
+ * left where they are.
+ */
+class TimerWheel
+{
+public:
+    explicit TimerWheel(size_t slots) : m_slots(slots) {}
+
+    uint64_t GetNow() const { return m_now; }
+
+    void Schedule(uint64_t id, uint64_t deadline)
+    {
+        // Never in the current slot, it was already walked.
+        deadline = std::max(deadline, m_now + 1);
+        m_slots[deadline % m_slots.size()].push_back({id, deadline});
+    }
+
+    /** Move the timers due by now into due, in the order they are due. */
+    void Advance(uint64_t now, std::vector<uint64_t>& due)
+    {
+        // Past a whole turn, every slot is walked once.
+        uint64_t steps = std::min<uint64_t>(now - m_now, m_slots.size());
+        for (uint64_t i = 1; i <= steps; i++)
+        {
+            auto&  slot = m_slots[(m_now + i) % m_slots.size()];
+            size_t kept = 0;
+            for (const Timer& timer : slot)
+            {
+                if (timer.deadline <= now)
+                {
+                    due.push_back(timer.id);
+                }
+                else
+                {
+                    slot[kept++] = timer;
+                }
+            }
+            slot.resize(kept);
+        }
+        m_now = now;
+    }
+
+private:
+    struct Timer
+    {
+        uint64_t id;
+        uint64_t deadline;
+    };
+
+    std::vector<std::vector<Timer>> m_slots;
+    uint64_t                        m_now = 0;
+};
+
+enum class WaitKind
+{
+    None,
+    Time,
+    Frames,
+    Event,
+};
+
+// What an event carries back to waitEvent, and what its filter is compared to.
+struct EventSource
+{
+    bool        isNumber = false;
+    lua_Integer number   = 0;
+    std::string text;
+};
+
+struct Coroutine
+{
+    lua_State*  thread = nullptr;
+    int         ref    = LUA_NOREF;    // Keeps the thread alive.
+    std::string name;                  // Where its function is defined.
+
+    WaitKind    waitKind  = WaitKind::None;
+    EventType   eventType = EventType::None;
+    bool        hasFilter = false;
+    EventSource filter;
+
+    bool isRunning   = false;
+    bool isCancelled = false;    // Cancelled while running, freed once it yields.
+};
+
+struct ReadyCoroutine
+{
+    uint64_t    id;
+    EventSource source;
+};
+
+struct ScriptSchedulerData
+{
+    lua_State* L = nullptr;
+
+    std::unordered_map<uint64_t, Coroutine> coroutines;
+    std::unordered_map<lua_State*, uint64_t> threads;
+    uint64_t                                 nextId = 1;
+
+    double     time = 0.0;    // Seconds, the sum of the updates.
+    TimerWheel timeWheel {s_timeSlots};
+    TimerWheel frameWheel {s_frameSlots};
+
+    std::vector<uint64_t>       eventWaiters[s_eventTypeCount];
+    std::vector<ReadyCoroutine> ready;    // Woken up by an event, resumed on the next update.
+
+    std::vector<uint64_t> due;    // Reused by every update.
+    size_t                resumed = 0;
+};
+
+// One per Lua state.
+static std::vector<Scope<ScriptSchedulerData>> s_schedulers;
+
+/*********************************************************************************************************************/
+// [SECTION] Private Function Declarations
+/*********************************************************************************************************************/
+static void Free(ScriptSchedulerData& data, uint64_t id)
+{
+    auto it = data.coroutines.find(id);
+    if (it == data.coroutines.end())
+    {
+        return;
+    }
+
+    // The ids left in the wheels and the event lists are skipped once they come up.
+    data.threads.erase(it->second.thread);
+    luaL_unref(data.L, LUA_REGISTRYINDEX, it->second.ref);
+    data.coroutines.erase(it);
+}
+
+static void PushSource(lua_State* L, const EventSource& source)
+{
+    if (source.isNumber)
+    {
+        lua_pushinteger(L, source.number);
+    }
+    else
+    {
+        lua_pushlstring(L, source.text.data(), source.text.size());
+    }
+}
+
+/**
+ * @brief   Run a coroutine until it waits or ends. nargs values are on top of its stack.
+ */
+static void Resume(ScriptSchedulerData& data, uint64_t id, lua_State* from, int nargs)
+{
+    auto it = data.coroutines.find(id);
+    if (it == data.coroutines.end())
+    {
+        return;
+    }
+
+    Coroutine& coroutine = it->second;
+    lua_State* thread    = coroutine.thread;
+    coroutine.waitKind   = WaitKind::None;
+    coroutine.isRunning  = true;
+
+    int results = 0;
+    int status  = lua_resume(thread, from, nargs, &results);
+    data.resumed++;
+
+    // Still valid, a running coroutine is only flagged when cancelled.
+    coroutine.isRunning = false;
+
+    if (status == LUA_YIELD && !coroutine.isCancelled)
+    {
+        lua_pop(thread, results);
+        if (coroutine.waitKind == WaitKind::None)
+        {
+            // A bare coroutine.yield(), try again next frame.
+            coroutine.waitKind = WaitKind::Frames;
+            data.frameWheel.Schedule(id, data.frameWheel.GetNow() + 1);
+        }
+        return;
+    }
+
+    if (status != LUA_OK && status != LUA_YIELD)
+    {
+        const char* message = lua_tostring(thread, -1);
+        luaL_traceback(data.L, thread, message != nullptr ? message : "(no message)", 0);
+        BR_CORE_ERROR("[ScriptEngine] Error in coroutine {}: {}",
+                      coroutine.name,
+                      lua_tostring(data.L, -1));
+        lua_pop(data.L, 1);
+    }
+    Free(data, id);
+}
+
+static void ResumeFromScheduler(ScriptSchedulerData& data, uint64_t id, int nargs)
+{
+    auto it = data.coroutines.find(id);
+    if (it == data.coroutines.end())
+    {
+        if (nargs > 0)
+        {
+            lua_pop(data.L, nargs);
+        }
+        return;
+    }
+
+    lua_State* thread = it->second.thread;
+    lua_xmove(data.L, thread, nargs);
+
+    ScriptProfiler::BeginCall(thread, it->second.name, "resume");
+    Resume(data, id, data.L, nargs);
+    ScriptProfiler::EndCall(thread);
+}
+
+static std::vector<Scope<ScriptSchedulerData>>::iterator FindScheduler(lua_State* L)
+{
+    return std::find_if(s_schedulers.begin(), s_schedulers.end(), [=](const auto& data) {
+        return data->L == L;
+    });
+}
+
+static ScriptSchedulerData& GetData(lua_State* L)
+{
+    return *static_cast<ScriptSchedulerData*>(lua_touserdata(L, lua_upvalueindex(1)));
+}
+
+static Coroutine& GetCurrentCoroutine(ScriptSchedulerData& data,
+                                      lua_State*           L,
+                                      const char*          function)
+{
+    auto it = data.threads.find(L);
+    if (it == data.threads.end())
+    {
+        luaL_error(L, "%s can only be called from a coroutine started with async", function);
+    }
+    return data.coroutines.at(it->second);
+}
+
+static int Lua_Async(lua_State* L)
+{
+    luaL_checktype(L, 1, LUA_TFUNCTION);
+    ScriptSchedulerData& data  = GetData(L);
+    int                  nargs = lua_gettop(L) - 1;
+
+    lua_State* thread = lua_newthread(L);
+    int        ref    = luaL_ref(L, LUA_REGISTRYINDEX);
+    lua_xmove(L, thread, nargs + 1);
+
+    lua_Debug ar;
+    lua_pushvalue(thread, 1);
+    lua_getinfo(thread, ">S", &ar);
+
+    uint64_t  id        = data.nextId++;
+    Coroutine coroutine = {};
+    coroutine.thread    = thread;
+    coroutine.ref       = ref;
+    coroutine.name      = std::string(ar.short_src) + ":" + std::to_string(ar.linedefined);
+    data.coroutines.emplace(id, std::move(coroutine));
+    data.threads.emplace(thread, id);
+
+    Resume(data, id, L, nargs);
+
+    lua_pushinteger(L, lua_Integer(id));
+    return 1;
+}
+
+static int Lua_Cancel(lua_State* L)
+{
+    ScriptSchedulerData& data = GetData(L);
+    uint64_t             id   = uint64_t(luaL_checkinteger(L, 1));
+    auto                 it   = data.coroutines.find(id);
+    if (it != data.coroutines.end())
+    {
+        if (it->second.isRunning)
+        {
+            it->second.isCancelled = true;
+        }
+        else
+        {
+            Free(data, id);
+        }
+    }
+    return 0;
+}
+
+static int Lua_Wait(lua_State* L)
+{
+    ScriptSchedulerData& data      = GetData(L);
+    lua_Number           seconds   = luaL_checknumber(L, 1);
+    Coroutine&           coroutine = GetCurrentCoroutine(data, L, "wait");
+
+    auto deadline      = uint64_t(std::ceil((data.time + seconds) * s_ticksPerSecond));
+    coroutine.waitKind = WaitKind::Time;
+    data.timeWheel.Schedule(data.threads.at(L), deadline);
+    return lua_yield(L, 0);
+}
+
+static int Lua_WaitFrames(lua_State* L)
+{
+    ScriptSchedulerData& data      = GetData(L);
+    lua_Integer          frames    = std::max<lua_Integer>(luaL_optinteger(L, 1, 1), 1);
+    Coroutine&           coroutine = GetCurrentCoroutine(data, L, "waitFrames");
+
+    coroutine.waitKind = WaitKind::Frames;
+    data.frameWheel.Schedule(data.threads.at(L), data.frameWheel.GetNow() + uint64_t(frames));
+    return lua_yield(L, 0);
+}
+
+static int Lua_WaitEvent(lua_State* L)
+{
+    ScriptSchedulerData& data = GetData(L);
+    int                  type = luaL_checkoption(L, 1, nullptr, s_eventNames);
+
+    Coroutine& coroutine = GetCurrentCoroutine(data, L, "waitEvent");
+    coroutine.waitKind   = WaitKind::Event;
+    coroutine.eventType  = EventType(type);
+    coroutine.hasFilter  = !lua_isnoneornil(L, 2);
+    if (coroutine.hasFilter)
+    {
+        coroutine.filter.isNumber = lua_isinteger(L, 2) != 0;
+        if (coroutine.filter.isNumber)
+        {
+            coroutine.filter.number = lua_tointeger(L, 2);
+        }
+        else
+        {
+            coroutine.filter.text = luaL_checkstring(L, 2);
+        }
+    }
+
+    data.eventWaiters[type].push_back(data.threads.at(L));
+    return lua_yield(L, 0);
+}
+
+static EventSource GetEventSource(Event& e)
+{
+    EventSource source;
+    switch (e.GetEventType())
+    {
+        case EventType::ImGuiButtonPressed:
+        case EventType::ImGuiButtonReleased:
+        {
+            const Entity& button = static_cast<ImGuiButtonEvent&>(e).GetButton();
+            if (button.HasComponent<TagComponent>())
+            {
+                source.text = button.GetComponent<TagComponent>().tag;
+            }
+            break;
+        }
+        case EventType::SerialPortAdded:
+        case EventType::SerialPortRemoved:
+            source.text = static_cast<SerialPortEvent&>(e).GetPort().port;
+            break;
+        case EventType::KeyPressed:
+        case EventType::KeyReleased:
+        case EventType::KeyTyped:
+            source.isNumber = true;
+            source.number   = lua_Integer(static_cast<KeyEvent&>(e).GetKeyCode());
+            break;
+        case EventType::MouseButtonPressed:
+        case EventType::MouseButtonReleased:
+            source.isNumber = true;
+            source.number   = lua_Integer(static_cast<MouseButtonEvent&>(e).GetMouseButton());
+            break;
+        default:
+            break;
+    }
+    return source;
+}
+
+static bool Matches(const EventSource& filter, const EventSource& source)
+{
+    if (filter.isNumber != source.isNumber)
+    {
+        return false;
+    }
+    return filter.isNumber ? filter.number == source.number : filter.text == source.text;
+}
+
+/*********************************************************************************************************************/
+// [SECTION] Public Method Definitions
+/*********************************************************************************************************************/
+void ScriptScheduler::Init(lua_State* L)
+{
+    s_schedulers.push_back(CreateScope<ScriptSchedulerData>());
+    ScriptSchedulerData& data = *s_schedulers.back();
+    data.L                    = L;
+
+    static const luaL_Reg functions[] = {
+      {"async", &Lua_Async},
+      {"cancel", &Lua_Cancel},
+      {"wait", &Lua_Wait},
+      {"waitFrames", &Lua_WaitFrames},
+      {"waitEvent", &Lua_WaitEvent},
+      {nullptr, nullptr},
+    };
+    lua_pushglobaltable(L);
+    lua_pushlightuserdata(L, &data);
+    luaL_setfuncs(L, functions, 1);
+    lua_pop(L, 1);
+}
+
+void ScriptScheduler::Shutdown(lua_State* L)
+{
+    auto it = FindScheduler(L);
+    if (it == s_schedulers.end())
+    {
+        return;
+    }
+
+    ScriptSchedulerData& data = **it;
+    while (!data.coroutines.empty())
+    {
+        Free(data, data.coroutines.begin()->first);
+    }
+    s_schedulers.erase(it);
+}
+
+void ScriptScheduler::Update(lua_State* L, float ts)
+{
+    BR_PROFILE_FUNCTION();
+
+    auto it = FindScheduler(L);
+    if (it == s_schedulers.end())
+    {
+        return;
+    }
+
+    ScriptSchedulerData& data = **it;
+    data.resumed              = 0;
+    data.time += ts;
+
+    // Collected first, what the coroutines schedule while resuming is for the next update.
+    std::vector<uint64_t> due;
+    due.swap(data.due);
+    due.clear();
+    data.frameWheel.Advance(data.frameWheel.GetNow() + 1, due);
+    data.timeWheel.Advance(uint64_t(data.time * s_ticksPerSecond), due);
+
+    std::vector<ReadyCoroutine> ready;
+    ready.swap(data.ready);
+    for (const ReadyCoroutine& coroutine : ready)
+    {
+        PushSource(data.L, coroutine.source);
+        ResumeFromScheduler(data, coroutine.id, 1);
+    }
+    for (uint64_t id : due)
+    {
+        ResumeFromScheduler(data, id, 0);
+    }
+
+    // Kept for its capacity.
+    due.swap(data.due);
+}
+
+void ScriptScheduler::OnEvent(Event& e)
+{
+    EventSource source;
+    bool        hasSource = false;
+    for (auto& scheduler : s_schedulers)
+    {
+        ScriptSchedulerData& data    = *scheduler;
+        auto&                waiters = data.eventWaiters[size_t(e.GetEventType())];
+        if (waiters.empty())
+        {
+            continue;
+        }
+
+        if (!hasSource)
+        {
+            source    = GetEventSource(e);
+            hasSource = true;
+        }
+
+        size_t kept = 0;
+        for (uint64_t id : waiters)
+        {
+            auto it = data.coroutines.find(id);
+            if (it == data.coroutines.end() || it->second.waitKind != WaitKind::Event)
+            {
+                continue;
+            }
+
+            const Coroutine& coroutine = it->second;
+            if (coroutine.hasFilter && !Matches(coroutine.filter, source))
+            {
+                waiters[kept++] = id;
+                continue;
+            }
+            data.ready.push_back({id, source});
+        }
+        waiters.resize(kept);
+    }
+}
+
+ScriptScheduler::Stats ScriptScheduler::GetStats()
+{
+    Stats stats;
+    for (const auto& data : s_schedulers)
+    {
+        stats.coroutines += data->coroutines.size();
+        stats.resumed += data->resumed;
+        for (const auto& [id, coroutine] : data->coroutines)
+        {
+            switch (coroutine.waitKind)
+            {
+                case WaitKind::Time: stats.waitingTime++; break;
+                case WaitKind::Frames: stats.waitingFrames++; break;
+                case WaitKind::Event: stats.waitingEvents++; break;
+                default: break;
+            }
+        }
+    }
+    return stats;
+}
+}    // namespace Brigerad
@@ -0,0 +1,82 @@
+/**
+ * @file    ScriptScheduler.h
+ * @author  Samuel Martel
+ * @p       https://github.com/smartel99
+ * @date    10/19/2026 10:30:00 PM
+ *
+ * @brief
+ ******************************************************************************
+ * Copyright (C) 2020  Samuel Martel
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *****************************************************************************/
+#pragma once
+
+/*********************************************************************************************************************/
+// [SECTION] Includes
+/*********************************************************************************************************************/
+#include <cstddef>
+
+struct lua_State;
+
+namespace Brigerad
+{
+class Event;
+
+/*********************************************************************************************************************/
+// [SECTION] Class Declarations
+/*********************************************************************************************************************/
+/**
+ * Runs the coroutines of the scripts, so that they wait for something instead of polling for it
+ * in OnUpdate.
+ *
+ * From Lua:
+ *  - async(f, ...) runs f in a new coroutine until it first waits, returns the id of the coroutine.
+ *  - cancel(id) stops a coroutine.
+ *  - wait(seconds), waitFrames(n) and waitEvent(type [, source]) suspend the calling coroutine.
+ *    waitEvent takes the name of an EventType, e.g. "ImGuiButtonReleased", and returns the source
+ *    of the event: the tag of the button, the serial port, the key or the mouse button. When a
+ *    source is given, only the events of that source wake the coroutine up.
+ *  - A plain coroutine.yield() waits for the next frame.
+ *
+ * Sleeping coroutines cost nothing: the timed ones are kept in timer wheels and the others in the
+ * list of the event they wait for, only the coroutines whose condition fired are resumed.
+ */
+class ScriptScheduler
+{
+public:
+    struct Stats
+    {
+        size_t coroutines    = 0;
+        size_t waitingTime   = 0;
+        size_t waitingFrames = 0;
+        size_t waitingEvents = 0;
+        size_t resumed       = 0;    // In the last update.
+    };
+
+    // Every Lua state has its own coroutines.
+    static void Init(lua_State* L);
+    static void Shutdown(lua_State* L);
+
+    /**
+     * Resume the coroutines of L that are due, once per frame. ts is the time they see passing.
+     * Called by the thread running the scripts of L, the states are updated in parallel.
+     */
+    static void Update(lua_State* L, float ts);
+    /** Wakes up the coroutines waiting for e on the next update. Not during the updates. */
+    static void OnEvent(Event& e);
+
+    static Stats GetStats();
+};
+}    // namespace Brigerad
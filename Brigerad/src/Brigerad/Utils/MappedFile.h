@@ -0,0 +1,102 @@
+/**
+ * @file    MappedFile.h
+ * @author  Samuel Martel
+ * @p       https://github.com/smartel99
+ * @date    10/19/2026 10:12:00 AM
+ *
+ * @brief
+ ******************************************************************************
+ * Copyright (C) 2020  Samuel Martel
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *****************************************************************************/
+#pragma once
+
+/*********************************************************************************************************************/
+// [SECTION] Includes
+/*********************************************************************************************************************/
+#include "Brigerad/Core/Core.h"
+
+#include <cstdint>
+#include <string>
+
+namespace Brigerad
+{
+/*********************************************************************************************************************/
+// [SECTION] Class Declarations
+/*********************************************************************************************************************/
+/**
+ * A file mapped in the address space of the process.
+ *
+ * Reads and writes go straight to the page cache, the OS takes care of writing the pages back to
+ * the disk. The implementation is platform specific, see Platform/<OS>/<OS>MappedFile.cpp.
+ */
+class MappedFile
+{
+public:
+    enum class Mode
+    {
+        Read,
+        ReadWrite
+    };
+
+    MappedFile() = default;
+    ~MappedFile() { Close(); }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * Map a file in memory.
+     *
+     * \param path The path of the file.
+     * \param mode Read maps an existing file, ReadWrite creates the file if it doesn't exist.
+     * \param size The size to give to the file in ReadWrite mode, 0 to keep its current size.
+     *
+     * \return true if the file is mapped.
+     */
+    bool Open(const std::string& path, Mode mode, size_t size = 0);
+
+    /**
+     * Grow or shrink a file opened in ReadWrite mode and map it again.
+     * Pointers previously returned by Data are invalidated.
+     *
+     * \return true if the file is mapped with its new size.
+     */
+    bool Resize(size_t size);
+
+    /** Ask the OS to write the dirty pages back to the disk, without waiting for it. */
+    void Flush();
+
+    void Close();
+
+    bool               IsOpen() const { return m_data != nullptr; }
+    uint8_t*           Data() { return m_data; }
+    const uint8_t*     Data() const { return m_data; }
+    size_t             Size() const { return m_size; }
+    const std::string& GetPath() const { return m_path; }
+
+private:
+    bool Map();
+    void Unmap();
+
+private:
+    std::string m_path    = "";
+    Mode        m_mode    = Mode::Read;
+    uint8_t*    m_data    = nullptr;
+    size_t      m_size    = 0;
+    intptr_t    m_file    = -1;    // File descriptor or HANDLE.
+    intptr_t    m_mapping = 0;     // Mapping HANDLE, unused on Linux.
+};
+}    // namespace Brigerad
@@ -0,0 +1,128 @@
+/**
+ * @file    RingBuffer.h
+ * @author  Samuel Martel
+ * @p       https://github.com/smartel99
+ * @date    10/19/2026 9:30:00 AM
+ *
+ * @brief
+ ******************************************************************************
+ * Copyright (C) 2020  Samuel Martel
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *****************************************************************************/
+#pragma once
+
+/*********************************************************************************************************************/
+// [SECTION] Includes
+/*********************************************************************************************************************/
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace Brigerad
+{
+/*********************************************************************************************************************/
+// [SECTION] Class Declarations
+/*********************************************************************************************************************/
+/**
+ * Lock-free ring buffer for exactly one producer thread and one consumer thread.
+ *
+ * Neither side ever blocks: Push fails when the buffer is full and Pop fails when it is empty.
+ * The indices only ever grow, the capacity must therefore be a power of two so that wrapping
+ * around is a simple mask.
+ *
+ * \tparam T The type of the elements. Must be trivially copyable to be cheap to move around.
+ * \tparam N The capacity of the buffer, in elements.
+ */
+template<typename T, size_t N>
+class RingBuffer
+{
+    static_assert(N != 0 && (N & (N - 1)) == 0, "RingBuffer capacity must be a power of two");
+
+public:
+    /**
+     * Push an element at the back of the buffer. Must only be called by the producer.
+     *
+     * \return true if the element was pushed.
+     * \return false if the buffer is full.
+     */
+    bool Push(const T& value)
+    {
+        size_t head = m_head.load(std::memory_order_relaxed);
+        if (head - m_tail.load(std::memory_order_acquire) == N)
+        {
+            return false;
+        }
+
+        m_data[head & s_mask] = value;
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Pop the element at the front of the buffer. Must only be called by the consumer.
+     *
+     * \return true if an element was popped into out.
+     * \return false if the buffer is empty.
+     */
+    bool Pop(T& out)
+    {
+        size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail == m_head.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+
+        out = m_data[tail & s_mask];
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Pop up to maxCount elements at once. Must only be called by the consumer.
+     *
+     * \return The number of elements popped into out.
+     */
+    size_t PopMany(T* out, size_t maxCount)
+    {
+        size_t tail  = m_tail.load(std::memory_order_relaxed);
+        size_t count = m_head.load(std::memory_order_acquire) - tail;
+        count        = count < maxCount ? count : maxCount;
+
+        for (size_t i = 0; i < count; i++)
+        {
+            out[i] = m_data[(tail + i) & s_mask];
+        }
+        m_tail.store(tail + count, std::memory_order_release);
+        return count;
+    }
+
+    /** Approximate number of elements in the buffer, exact when called by either side. */
+    size_t Size() const
+    {
+        return m_head.load(std::memory_order_acquire) - m_tail.load(std::memory_order_acquire);
+    }
+
+    static constexpr size_t Capacity() { return N; }
+
+private:
+    static constexpr size_t s_mask = N - 1;
+
+    // Keep the indices on separate cache lines so that the producer and the consumer don't
+    // invalidate each other's line on every operation.
+    alignas(64) std::atomic<size_t> m_head = 0;
+    alignas(64) std::atomic<size_t> m_tail = 0;
+    alignas(64) std::array<T, N> m_data;
+};
+}    // namespace Brigerad
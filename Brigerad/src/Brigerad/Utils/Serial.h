@@ -48,6 +48,7 @@
 // [SECTION] Includes
 /*********************************************************************************************************************/
 #include "Brigerad.h"
+#include "Brigerad/Utils/SerialCapture.h"
 
 #include "serial/serial.h"
 
@@ -66,6 +67,12 @@ namespace Brigerad
 /*********************************************************************************************************************/
 // [SECTION] Class Declarations
 /*********************************************************************************************************************/
+/**
+ * Serial port.
+ *
+ * Every transfer goes through Open, IsOpen, Close, BytesAvailable, WaitForByte, Read(uint8_t*) and
+ * Write(const uint8_t*), which are virtual so that a SerialReplay can stand in for a real port.
+ */
 class Serial
 {
 public:
@@ -93,6 +100,20 @@ public:
         Baud921600
     };
 
+    /** The rate, in bits per second, of each entry of Baudrates. */
+    static constexpr uint32_t s_baudrateValues[] = {
+      110,    300,    600,    1200,   2400,   4800,   9600,   14400,  19200,  38400,
+      56000,  57600,  115200, 128000, 153600, 230400, 256000, 460800, 500000, 921600};
+
+    static constexpr uint32_t ToRate(Baudrates baudrate)
+    {
+        return s_baudrateValues[static_cast<size_t>(baudrate)];
+    }
+
+    static_assert(sizeof(s_baudrateValues) / sizeof(s_baudrateValues[0]) ==
+                    static_cast<size_t>(Baudrates::Baud921600) + 1,
+                  "Every entry of Baudrates needs a rate");
+
     enum class ByteSizes
     {
         FiveBits  = 5,
@@ -154,8 +175,28 @@ public:
            Parities           parity      = Parities::None,
            StopBits           stopBit     = StopBits::One,
            FlowControls       flowControl = FlowControls::None)
+    : Serial(port, ToRate(baudrate), timeout, byteSize, parity, stopBit, flowControl)
+    {
+    }
+
+    /**
+     * Creates a Serial object with an arbitrary baud rate, for the rates that are not in
+     * Serial::Baudrates (e.g. 2 or 3 Mbaud on FTDI and CP210x adapters).
+     *
+     * Whether the rate is actually supported is up to the driver of the port. On Linux, rates
+     * without a Bxxx constant are set with termios2.
+     *
+     * \see Serial::Serial
+     */
+    Serial(const std::string& port,
+           uint32_t           baudrate,
+           Timeout            timeout     = Timeout(),
+           ByteSizes          byteSize    = ByteSizes::EightBits,
+           Parities           parity      = Parities::None,
+           StopBits           stopBit     = StopBits::One,
+           FlowControls       flowControl = FlowControls::None)
     : m_port(port,
-             (uint32_t)baudrate,
+             baudrate,
              timeout,
              (serial::bytesize_t)byteSize,
              (serial::parity_t)parity,
@@ -163,8 +204,10 @@ public:
              (serial::flowcontrol_t)flowControl)
     {
     }
-    ~Serial() {}
+    virtual ~Serial() { StopCapture(); }
 
+    // Enumerates the ports from scratch, which is slow. UI code should use
+    // SerialPortRegistry::GetPorts instead.
     static std::vector<PortInfo> ListPorts() { return serial::list_ports(); }
 
     /**
@@ -181,7 +224,7 @@ public:
      * \throw SerialException
      * \throw IOException
      */
-    bool Open()
+    virtual bool Open()
     {
         m_port.open();
         return m_port.isOpen();
@@ -193,13 +236,13 @@ public:
      * \return true if the port is open
      * \return false if the port is closed
      */
-    bool IsOpen() const { return m_port.isOpen(); }
+    virtual bool IsOpen() const { return m_port.isOpen(); }
 
     /** Close the serial port. */
-    void Close() { m_port.close(); }
+    virtual void Close() { m_port.close(); }
 
     /** Return the number of characters in the buffer */
-    size_t BytesAvailable() { return m_port.available(); }
+    virtual size_t BytesAvailable() { return m_port.available(); }
 
     /**
      * Block until there is serial data to read or read_timeout_constant number
@@ -208,7 +251,7 @@ public:
      * \return true when the function exits with the port in a readable state
      * \return false otherwise (due to timeout or select interruption)
      */
-    bool WaitForByte() { return m_port.waitReadable(); }
+    virtual bool WaitForByte() { return m_port.waitReadable(); }
 
     /**
      * Block for a period of time corresponding to the transmission time of
@@ -249,7 +292,12 @@ public:
      * \throw PortNotOpenedException
      * \throw SerialException
      */
-    size_t Read(uint8_t* buffer, size_t size) { return m_port.read(buffer, size); }
+    virtual size_t Read(uint8_t* buffer, size_t size)
+    {
+        size_t len = m_port.read(buffer, size);
+        Capture(SerialCapture::Direction::Read, buffer, len);
+        return len;
+    }
 
     /** Read a given amount of bytes from the serial port into a give buffer.
      *
@@ -261,7 +309,14 @@ public:
      * \throw serial::PortNotOpenedException
      * \throw serial::SerialException
      */
-    size_t Read(std::vector<uint8_t>& buffer, size_t size = 1) { return m_port.read(buffer, size); }
+    size_t Read(std::vector<uint8_t>& buffer, size_t size = 1)
+    {
+        size_t start = buffer.size();
+        buffer.resize(start + size);
+        size_t len = Read(buffer.data() + start, size);
+        buffer.resize(start + len);
+        return len;
+    }
 
     /**
      * Read a given amount of bytes from the serial port into a given buffer.
@@ -274,7 +329,14 @@ public:
      * \throw serial::PortNotOpenedException
      * \throw serial::SerialException
      */
-    size_t Read(std::string& buffer, size_t size = 1) { return m_port.read(buffer, size); }
+    size_t Read(std::string& buffer, size_t size = 1)
+    {
+        size_t start = buffer.size();
+        buffer.resize(start + size);
+        size_t len = Read(reinterpret_cast<uint8_t*>(&buffer[start]), size);
+        buffer.resize(start + len);
+        return len;
+    }
 
     /**
      * Read a given amount of bytes from the serial port into a given buffer.
@@ -286,7 +348,12 @@ public:
      * \throw PortNotOpenedException
      * \throw SerialException
      */
-    std::string Read(size_t size = 1) { return m_port.read(size); }
+    std::string Read(size_t size = 1)
+    {
+        std::string buffer;
+        Read(buffer, size);
+        return buffer;
+    }
 
     /**
      * Read in a line or until a given delimiter has been processed.
@@ -304,7 +371,24 @@ public:
      */
     size_t ReadLine(std::string& buffer, size_t size = 65536, const std::string& eol = "\n")
     {
-        return m_port.readline(buffer, size, eol);
+        // One byte at a time, so that nothing past the delimiter is consumed.
+        size_t len = 0;
+        while (len < size)
+        {
+            uint8_t c;
+            if (Read(&c, 1) == 0)
+            {
+                break;    // Timeout.
+            }
+            buffer.push_back((char)c);
+            len++;
+            if (len >= eol.size() &&
+                buffer.compare(buffer.size() - eol.size(), eol.size(), eol) == 0)
+            {
+                break;
+            }
+        }
+        return len;
     }
 
     /**
@@ -322,7 +406,9 @@ public:
      */
     std::string ReadLine(size_t size = 65536, const std::string& eol = "\n")
     {
-        return m_port.readline(size, eol);
+        std::string buffer;
+        ReadLine(buffer, size, eol);
+        return buffer;
     }
 
     /**
@@ -341,7 +427,17 @@ public:
      */
     std::vector<std::string> ReadLines(size_t maxLines = 65536, const std::string& eol = "\n")
     {
-        return m_port.readlines(maxLines, eol);
+        std::vector<std::string> lines;
+        while (lines.size() < maxLines)
+        {
+            std::string line = ReadLine(65536, eol);
+            if (line.empty())
+            {
+                break;    // Timeout.
+            }
+            lines.push_back(std::move(line));
+        }
+        return lines;
     }
 
     /**
@@ -356,7 +452,12 @@ public:
      * \throw SerialException
      * \throw IOException
      */
-    size_t Write(const uint8_t* data, size_t len) { return m_port.write(data, len); }
+    virtual size_t Write(const uint8_t* data, size_t len)
+    {
+        size_t written = m_port.write(data, len);
+        Capture(SerialCapture::Direction::Write, data, written);
+        return written;
+    }
 
     /**
      * Write a string to the serial port.
@@ -369,7 +470,7 @@ public:
      * \throw SerialException
      * \throw IOException
      */
-    size_t Write(const std::vector<uint8_t>& data) { return m_port.write(data); }
+    size_t Write(const std::vector<uint8_t>& data) { return Write(data.data(), data.size()); }
 
     /**
      * Write a string to the serial port.
@@ -382,7 +483,10 @@ public:
      * \throw SerialException
      * \throw IOException
      */
-    size_t Write(const std::string& data) { return m_port.write(data); }
+    size_t Write(const std::string& data)
+    {
+        return Write(reinterpret_cast<const uint8_t*>(data.data()), data.size());
+    }
 
     /**
      * Set the serial port identifier.
@@ -466,22 +570,31 @@ public:
     /**
      * Sets the baudrate for the serial port.
      *
-     * \param baudrate An integer that sets the baud rate for the serial port.
+     * \param baudrate One of the standard baud rates.
+     *
+     * \throw InvalidArgument
+     */
+    void SetBaudrate(Baudrates baudrate) { m_port.setBaudrate(ToRate(baudrate)); }
+
+    /**
+     * Sets the baudrate for the serial port.
+     *
+     * \param baudrate The baud rate in bits per second, standard or not.
      *
      * \throw InvalidArgument
      */
-    void SetBaudrate(Baudrates baudrate) { m_port.setBaudrate((uint32_t)baudrate); }
+    void SetBaudrate(uint32_t baudrate) { m_port.setBaudrate(baudrate); }
 
     /**
      * Get the baudrate for the serial port.
      *
-     * \return The baud rate of the serial port.
+     * \return The baud rate of the serial port, in bits per second.
      *
      * \see Serial::SetBaudrate
      *
      * \throw InvalidArguments
      */
-    Baudrates GetBaudrate() const { return (Baudrates)m_port.getBaudrate(); }
+    uint32_t GetBaudrate() const { return m_port.getBaudrate(); }
 
     /**
      * Set the byte size for the serial port.
@@ -635,8 +748,37 @@ public:
      */
     bool GetCD() { return m_port.getCD(); }
 
+    /**
+     * Record every byte read from and written to the port, with its time, until StopCapture is
+     * called. The capture can be fed back with SerialReplay.
+     *
+     * \return true if the capture file could be created.
+     */
+    bool StartCapture(const std::string& path)
+    {
+        auto capture = CreateScope<SerialCapture>();
+        if (!capture->Open(path))
+        {
+            return false;
+        }
+        m_capture = std::move(capture);
+        return true;
+    }
+
+    /** Close the capture file, if any. Must not be called while another thread uses the port. */
+    void StopCapture() { m_capture.reset(); }
+
+protected:
+    void Capture(SerialCapture::Direction direction, const uint8_t* data, size_t len)
+    {
+        if (m_capture)
+        {
+            m_capture->Append(direction, data, len);
+        }
+    }
 
 private:
-    serial::Serial m_port;
+    serial::Serial      m_port;
+    Scope<SerialCapture> m_capture;
 };
 }    // namespace Brigerad
@@ -0,0 +1,185 @@
+/**
+ * @file    SerialCapture.cpp
+ * @author  Samuel Martel
+ * @p       https://github.com/smartel99
+ * @date    10/19/2026 2:30:00 PM
+ *
+ * @brief
+ ******************************************************************************
+ * Copyright (C) 2020  Samuel Martel
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *****************************************************************************/
+
+/*********************************************************************************************************************/
+// [SECTION] Includes
+/*********************************************************************************************************************/
+#include "brpch.h"
+#include "SerialCapture.h"
+
+namespace Brigerad
+{
+/*********************************************************************************************************************/
+// [SECTION] Private Function Definitions
+/*********************************************************************************************************************/
+template<typename T>
+static void PutLE(uint8_t* out, T value)
+{
+    for (size_t i = 0; i < sizeof(T); i++)
+    {
+        out[i] = (uint8_t)(value >> (8 * i));
+    }
+}
+
+template<typename T>
+static T GetLE(const uint8_t* in)
+{
+    T value = 0;
+    for (size_t i = 0; i < sizeof(T); i++)
+    {
+        value |= (T)in[i] << (8 * i);
+    }
+    return value;
+}
+
+/*********************************************************************************************************************/
+// [SECTION] Public Method Definitions
+/*********************************************************************************************************************/
+bool SerialCapture::Open(const std::string& path)
+{
+    std::lock_guard<std::mutex> lock(m_lock);
+
+    m_file.close();
+    m_file.open(path, std::ios::binary | std::ios::trunc);
+    if (!m_file.is_open())
+    {
+        BR_CORE_ERROR("[SerialCapture] Unable to create '{}'.", path);
+        return false;
+    }
+
+    uint8_t header[SERIAL_CAPTURE_HEADER_LEN] = {0};
+    memcpy(header, SERIAL_CAPTURE_MAGIC, 4);
+    header[4] = SERIAL_CAPTURE_VERSION;
+    m_file.write(reinterpret_cast<const char*>(header), sizeof(header));
+
+    m_start = std::chrono::steady_clock::now();
+    m_pendingData.clear();
+    return true;
+}
+
+void SerialCapture::Close()
+{
+    std::lock_guard<std::mutex> lock(m_lock);
+    if (m_file.is_open())
+    {
+        WritePending();
+        m_file.close();
+    }
+}
+
+void SerialCapture::Append(Direction direction, const uint8_t* data, size_t len)
+{
+    auto now = std::chrono::steady_clock::now();
+
+    std::lock_guard<std::mutex> lock(m_lock);
+    if (!m_file.is_open() || len == 0)
+    {
+        return;
+    }
+
+    uint64_t time = std::chrono::duration_cast<std::chrono::nanoseconds>(now - m_start).count();
+    if (m_pendingData.empty() || direction != m_pendingDirection ||
+        time - m_pendingTime > SERIAL_CAPTURE_MERGE_WINDOW_NS)
+    {
+        WritePending();
+        m_pendingTime      = time;
+        m_pendingDirection = direction;
+    }
+    m_pendingData.insert(m_pendingData.end(), data, data + len);
+}
+
+bool SerialCapture::Load(const std::string&    path,
+                         std::vector<Record>&  records,
+                         std::vector<uint8_t>& data)
+{
+    records.clear();
+    data.clear();
+
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open())
+    {
+        BR_CORE_ERROR("[SerialCapture] Unable to open '{}'.", path);
+        return false;
+    }
+
+    std::vector<uint8_t> content((size_t)file.tellg());
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(content.data()), content.size());
+
+    if (content.size() < SERIAL_CAPTURE_HEADER_LEN ||
+        memcmp(content.data(), SERIAL_CAPTURE_MAGIC, 4) != 0 ||
+        content[4] != SERIAL_CAPTURE_VERSION)
+    {
+        BR_CORE_ERROR("[SerialCapture] '{}' is not a serial capture.", path);
+        return false;
+    }
+
+    // Only the record headers are dropped, the data is kept back to back.
+    data.reserve(content.size());
+    size_t pos = SERIAL_CAPTURE_HEADER_LEN;
+    while (pos + SERIAL_CAPTURE_RECORD_HEADER <= content.size())
+    {
+        Record record;
+        record.time      = GetLE<uint64_t>(&content[pos]);
+        record.direction = (Direction)content[pos + 8];
+        record.length    = GetLE<uint32_t>(&content[pos + 9]);
+        record.offset    = data.size();
+        pos += SERIAL_CAPTURE_RECORD_HEADER;
+
+        if (record.length > content.size() - pos)
+        {
+            BR_CORE_WARN("[SerialCapture] '{}' is truncated, keeping {} records.",
+                         path,
+                         records.size());
+            break;
+        }
+
+        data.insert(data.end(), &content[pos], &content[pos] + record.length);
+        records.push_back(record);
+        pos += record.length;
+    }
+
+    return true;
+}
+
+/*********************************************************************************************************************/
+// [SECTION] Private Method Definitions
+/*********************************************************************************************************************/
+void SerialCapture::WritePending()
+{
+    if (m_pendingData.empty())
+    {
+        return;
+    }
+
+    uint8_t header[SERIAL_CAPTURE_RECORD_HEADER];
+    PutLE<uint64_t>(&header[0], m_pendingTime);
+    header[8] = (uint8_t)m_pendingDirection;
+    PutLE<uint32_t>(&header[9], (uint32_t)m_pendingData.size());
+
+    m_file.write(reinterpret_cast<const char*>(header), sizeof(header));
+    m_file.write(reinterpret_cast<const char*>(m_pendingData.data()), m_pendingData.size());
+    m_pendingData.clear();
+}
+}    // namespace Brigerad
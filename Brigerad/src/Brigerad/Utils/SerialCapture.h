@@ -0,0 +1,117 @@
+/**
+ * @file    SerialCapture.h
+ * @author  Samuel Martel
+ * @p       https://github.com/smartel99
+ * @date    10/19/2026 2:30:00 PM
+ *
+ * @brief
+ ******************************************************************************
+ * Copyright (C) 2020  Samuel Martel
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *****************************************************************************/
+#pragma once
+
+/*********************************************************************************************************************/
+// [SECTION] Includes
+/*********************************************************************************************************************/
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Brigerad
+{
+/*********************************************************************************************************************/
+// [SECTION] Defines
+/*********************************************************************************************************************/
+// A capture file starts with a header, followed by one record per call to Read or Write:
+//  Header: "V21S", u8 version, 3 reserved bytes.
+//  Record: u64 nanoseconds since the start of the capture, u8 direction, u32 length, then the data.
+// Every integer is little-endian.
+#define SERIAL_CAPTURE_MAGIC         "V21S"
+#define SERIAL_CAPTURE_VERSION       1
+#define SERIAL_CAPTURE_HEADER_LEN    8
+#define SERIAL_CAPTURE_RECORD_HEADER 13
+// Transfers in the same direction closer than this are merged in a single record, so that
+// byte-per-byte reads (e.g. Serial::ReadLine) don't cost a record header per byte.
+#define SERIAL_CAPTURE_MERGE_WINDOW_NS 100000
+
+/*********************************************************************************************************************/
+// [SECTION] Class Declarations
+/*********************************************************************************************************************/
+/**
+ * Records the traffic of a serial port to a file, to replay it later with SerialReplay.
+ */
+class SerialCapture
+{
+public:
+    enum class Direction : uint8_t
+    {
+        Read  = 0,
+        Write = 1,
+    };
+
+    struct Record
+    {
+        uint64_t  time;    // Nanoseconds since the start of the capture.
+        Direction direction;
+        size_t    offset;    // Where the data of the record starts in the buffer it was loaded in.
+        uint32_t  length;
+    };
+
+    /**
+     * Create the capture file, replacing it if it exists.
+     *
+     * \return true if the file is ready to be written to.
+     */
+    bool Open(const std::string& path);
+    void Close();
+
+    ~SerialCapture() { Close(); }
+
+    bool IsOpen() const { return m_file.is_open(); }
+
+    /** Append a record. Safe to call from the reading and the writing thread at the same time. */
+    void Append(Direction direction, const uint8_t* data, size_t len);
+
+    /**
+     * Load a capture file.
+     *
+     * \param path The path of the capture file.
+     * \param records Receives the records, in the order they were captured.
+     * \param data Receives the data of every record, back to back.
+     *
+     * \return true if the file is a valid capture. A capture cut short keeps its complete records.
+     */
+    static bool Load(const std::string&   path,
+                     std::vector<Record>&  records,
+                     std::vector<uint8_t>& data);
+
+private:
+    void WritePending();
+
+private:
+    std::mutex                            m_lock;
+    std::ofstream                         m_file;
+    std::chrono::steady_clock::time_point m_start;
+
+    // Record being merged into, written when a transfer can't be merged into it anymore.
+    uint64_t             m_pendingTime      = 0;
+    Direction            m_pendingDirection = Direction::Read;
+    std::vector<uint8_t> m_pendingData;
+};
+}    // namespace Brigerad
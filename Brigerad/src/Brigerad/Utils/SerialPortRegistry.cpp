@@ -0,0 +1,120 @@
+/**
+ * @file    SerialPortRegistry.cpp
+ * @author  Samuel Martel
+ * @p       https://github.com/smartel99
+ * @date    10/19/2026 1:15:00 PM
+ *
+ * @brief
+ ******************************************************************************
+ * Copyright (C) 2020  Samuel Martel
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *****************************************************************************/
+
+/*********************************************************************************************************************/
+// [SECTION] Includes
+/*********************************************************************************************************************/
+#include "brpch.h"
+#include "SerialPortRegistry.h"
+
+#include "Brigerad/Core/Application.h"
+#include "Brigerad/Events/SerialEvents.h"
+
+namespace Brigerad
+{
+/*********************************************************************************************************************/
+// [SECTION] Private Variables
+/*********************************************************************************************************************/
+// Only ever replaced as a whole, with std::atomic_store, so readers never see a partial update.
+static std::shared_ptr<const SerialPortRegistry::PortList> s_ports =
+  std::make_shared<const SerialPortRegistry::PortList>();
+static bool s_isWatching     = false;
+static bool s_isFirstRefresh = true;
+
+/*********************************************************************************************************************/
+// [SECTION] Public Method Definitions
+/*********************************************************************************************************************/
+void SerialPortRegistry::Init()
+{
+    BR_PROFILE_FUNCTION();
+
+    if (!s_isWatching)
+    {
+        StartWatching();
+        s_isWatching = true;
+    }
+}
+
+void SerialPortRegistry::Shutdown()
+{
+    BR_PROFILE_FUNCTION();
+
+    if (s_isWatching)
+    {
+        StopWatching();
+        s_isWatching     = false;
+        s_isFirstRefresh = true;
+    }
+}
+
+std::shared_ptr<const SerialPortRegistry::PortList> SerialPortRegistry::GetPorts()
+{
+    return std::atomic_load(&s_ports);
+}
+
+/*********************************************************************************************************************/
+// [SECTION] Private Method Definitions
+/*********************************************************************************************************************/
+void SerialPortRegistry::Refresh()
+{
+    BR_PROFILE_FUNCTION();
+
+    auto newPorts = std::make_shared<PortList>(serial::list_ports());
+    std::sort(newPorts->begin(), newPorts->end(), [](const auto& a, const auto& b) {
+        return a.port < b.port;
+    });
+
+    auto oldPorts = std::atomic_load(&s_ports);
+    std::atomic_store(&s_ports, std::shared_ptr<const PortList>(newPorts));
+
+    // The ports that are there at start up are not news.
+    if (s_isFirstRefresh)
+    {
+        s_isFirstRefresh = false;
+        return;
+    }
+
+    // Both lists are sorted, walk them side by side to find what changed.
+    auto oldIt = oldPorts->begin();
+    auto newIt = newPorts->begin();
+    while (oldIt != oldPorts->end() || newIt != newPorts->end())
+    {
+        if (newIt == newPorts->end() || (oldIt != oldPorts->end() && oldIt->port < newIt->port))
+        {
+            BR_CORE_INFO("[SerialPortRegistry] '{}' removed.", oldIt->port);
+            Application::Get().QueueEvent(CreateScope<SerialPortRemovedEvent>(*oldIt++));
+        }
+        else if (oldIt == oldPorts->end() || newIt->port < oldIt->port)
+        {
+            BR_CORE_INFO("[SerialPortRegistry] '{}' added.", newIt->port);
+            Application::Get().QueueEvent(CreateScope<SerialPortAddedEvent>(*newIt++));
+        }
+        else
+        {
+            ++oldIt;
+            ++newIt;
+        }
+    }
+}
+}    // namespace Brigerad
@@ -0,0 +1,67 @@
+/**
+ * @file    SerialPortRegistry.h
+ * @author  Samuel Martel
+ * @p       https://github.com/smartel99
+ * @date    10/19/2026 1:15:00 PM
+ *
+ * @brief
+ ******************************************************************************
+ * Copyright (C) 2020  Samuel Martel
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *****************************************************************************/
+#pragma once
+
+/*********************************************************************************************************************/
+// [SECTION] Includes
+/*********************************************************************************************************************/
+#include "serial/serial.h"
+
+#include <memory>
+#include <vector>
+
+namespace Brigerad
+{
+/*********************************************************************************************************************/
+// [SECTION] Class Declarations
+/*********************************************************************************************************************/
+/**
+ * Keeps the list of the serial ports of the system up to date.
+ *
+ * Enumerating the ports is slow, so it is done once at start up and then only when the platform
+ * reports a change, on a background thread. The UI reads the last snapshot without ever waiting
+ * for an enumeration, and each change is raised as a SerialPortAddedEvent or a
+ * SerialPortRemovedEvent through the Application.
+ */
+class SerialPortRegistry
+{
+public:
+    using PortList = std::vector<serial::PortInfo>;
+
+    static void Init();
+    static void Shutdown();
+
+    /** The ports found by the last enumeration. Empty until the first one completes. */
+    static std::shared_ptr<const PortList> GetPorts();
+
+private:
+    /** Enumerate the ports, publish the new snapshot and raise an event for each difference. */
+    static void Refresh();
+
+    // Implemented by each platform: watch for changes on a background thread, calling Refresh
+    // once right away and then every time a port might have appeared or disappeared.
+    static void StartWatching();
+    static void StopWatching();
+};
+}    // namespace Brigerad
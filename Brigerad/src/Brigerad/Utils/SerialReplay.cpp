@@ -0,0 +1,203 @@
+/**
+ * @file    SerialReplay.cpp
+ * @author  Samuel Martel
+ * @p       https://github.com/smartel99
+ * @date    10/19/2026 2:30:00 PM
+ *
+ * @brief
+ ******************************************************************************
+ * Copyright (C) 2020  Samuel Martel
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *****************************************************************************/
+
+/*********************************************************************************************************************/
+// [SECTION] Includes
+/*********************************************************************************************************************/
+#include "brpch.h"
+#include "SerialReplay.h"
+
+#include <thread>
+
+namespace Brigerad
+{
+/*********************************************************************************************************************/
+// [SECTION] Public Method Definitions
+/*********************************************************************************************************************/
+SerialReplay::SerialReplay(const std::string& path, Timing timing, Timeout timeout)
+: Serial("", Baudrates::Baud9600, timeout), m_timing(timing)
+{
+    m_isLoaded = SerialCapture::Load(path, m_records, m_data);
+    Open();
+}
+
+bool SerialReplay::Open()
+{
+    m_start       = std::chrono::steady_clock::now();
+    m_readRecord  = 0;
+    m_readOffset  = 0;
+    m_writeRecord = 0;
+    m_writeOffset = 0;
+    m_isOpen      = m_isLoaded;
+
+    SkipToNextRead();
+    return m_isOpen;
+}
+
+size_t SerialReplay::BytesAvailable()
+{
+    SkipToNextRead();
+
+    size_t available = 0;
+    size_t offset    = m_readOffset;
+    for (size_t i = m_readRecord; i < m_records.size() && HasArrived(m_records[i]); i++)
+    {
+        if (m_records[i].direction == SerialCapture::Direction::Read)
+        {
+            available += m_records[i].length - offset;
+            offset = 0;
+        }
+    }
+
+    return available;
+}
+
+bool SerialReplay::WaitForByte()
+{
+    SkipToNextRead();
+    if (IsFinished())
+    {
+        return false;
+    }
+
+    const SerialCapture::Record& record = m_records[m_readRecord];
+    if (!HasArrived(record))
+    {
+        auto deadline = std::chrono::steady_clock::now() +
+                        std::chrono::milliseconds(GetTimeout().read_timeout_constant);
+        std::this_thread::sleep_until(std::min(deadline, GetArrival(record)));
+    }
+
+    return HasArrived(record);
+}
+
+size_t SerialReplay::Read(uint8_t* buffer, size_t size)
+{
+    if (!m_isOpen)
+    {
+        throw serial::PortNotOpenedException("SerialReplay::Read");
+    }
+
+    // Same timeout as a real port: a constant plus a multiple of the requested size.
+    Timeout timeout  = GetTimeout();
+    auto    deadline = std::chrono::steady_clock::now() +
+                    std::chrono::milliseconds(timeout.read_timeout_constant +
+                                              (timeout.read_timeout_multiplier * size));
+
+    size_t read = 0;
+    while (read < size)
+    {
+        SkipToNextRead();
+        if (IsFinished())
+        {
+            // Nothing will ever come, behave like an idle port.
+            if (m_timing == Timing::Original)
+            {
+                std::this_thread::sleep_until(deadline);
+            }
+            break;
+        }
+
+        const SerialCapture::Record& record = m_records[m_readRecord];
+        if (!HasArrived(record))
+        {
+            auto arrival = GetArrival(record);
+            if (arrival > deadline)
+            {
+                std::this_thread::sleep_until(deadline);
+                break;
+            }
+            std::this_thread::sleep_until(arrival);
+        }
+
+        size_t len = std::min(size - read, (size_t)record.length - m_readOffset);
+        memcpy(buffer + read, &m_data[record.offset + m_readOffset], len);
+        read += len;
+        m_readOffset += len;
+    }
+
+    SkipToNextRead();
+    return read;
+}
+
+size_t SerialReplay::Write(const uint8_t* data, size_t len)
+{
+    if (!m_isOpen)
+    {
+        throw serial::PortNotOpenedException("SerialReplay::Write");
+    }
+
+    size_t mismatches = 0;
+    for (size_t i = 0; i < len; i++)
+    {
+        while (m_writeRecord < m_records.size() &&
+               (m_records[m_writeRecord].direction != SerialCapture::Direction::Write ||
+                m_writeOffset == m_records[m_writeRecord].length))
+        {
+            m_writeRecord++;
+            m_writeOffset = 0;
+        }
+
+        if (m_writeRecord == m_records.size() ||
+            m_data[m_records[m_writeRecord].offset + m_writeOffset++] != data[i])
+        {
+            mismatches++;
+        }
+    }
+
+    if (mismatches != 0 && m_writeMismatches == 0)
+    {
+        BR_CORE_WARN("[SerialReplay] The data written differs from the capture.");
+    }
+    m_writeMismatches += mismatches;
+
+    return len;
+}
+
+/*********************************************************************************************************************/
+// [SECTION] Private Method Definitions
+/*********************************************************************************************************************/
+void SerialReplay::SkipToNextRead()
+{
+    while (m_readRecord < m_records.size() &&
+           (m_records[m_readRecord].direction != SerialCapture::Direction::Read ||
+            m_readOffset == m_records[m_readRecord].length))
+    {
+        m_readRecord++;
+        m_readOffset = 0;
+    }
+}
+
+bool SerialReplay::HasArrived(const SerialCapture::Record& record) const
+{
+    return m_timing == Timing::AsFastAsPossible ||
+           std::chrono::steady_clock::now() >= GetArrival(record);
+}
+
+std::chrono::steady_clock::time_point SerialReplay::GetArrival(
+  const SerialCapture::Record& record) const
+{
+    return m_start + std::chrono::nanoseconds(record.time);
+}
+}    // namespace Brigerad
@@ -0,0 +1,109 @@
+/**
+ * @file    SerialReplay.h
+ * @author  Samuel Martel
+ * @p       https://github.com/smartel99
+ * @date    10/19/2026 2:30:00 PM
+ *
+ * @brief
+ ******************************************************************************
+ * Copyright (C) 2020  Samuel Martel
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *****************************************************************************/
+#pragma once
+
+/*********************************************************************************************************************/
+// [SECTION] Includes
+/*********************************************************************************************************************/
+#include "Brigerad/Utils/Serial.h"
+#include "Brigerad/Utils/SerialCapture.h"
+
+#include <atomic>
+#include <chrono>
+
+namespace Brigerad
+{
+/*********************************************************************************************************************/
+// [SECTION] Class Declarations
+/*********************************************************************************************************************/
+/**
+ * Serial port that plays back a capture made with Serial::StartCapture instead of talking to a
+ * device, to run code built on Serial without the hardware.
+ *
+ * Reads return the recorded stream byte for byte. Writes go nowhere, but are compared with the
+ * ones that were recorded so that a diverging replay is noticed.
+ */
+class SerialReplay : public Serial
+{
+public:
+    enum class Timing
+    {
+        Original,            // Bytes become readable when they were received during the capture.
+        AsFastAsPossible,    // Every byte is readable right away, to measure throughput.
+    };
+
+    /**
+     * Load a capture. The replay starts right away, or when Open is called again.
+     *
+     * \param path The path of the capture file.
+     * \param timing When the recorded bytes become readable.
+     * \param timeout Same as for a Serial, only the read timeout is used.
+     */
+    SerialReplay(const std::string& path,
+                 Timing             timing  = Timing::Original,
+                 Timeout            timeout = Timeout());
+
+    /** Start over from the beginning of the capture. */
+    bool   Open() override;
+    bool   IsOpen() const override { return m_isOpen; }
+    void   Close() override { m_isOpen = false; }
+    size_t BytesAvailable() override;
+    bool   WaitForByte() override;
+    size_t Read(uint8_t* buffer, size_t size) override;
+    size_t Write(const uint8_t* data, size_t len) override;
+
+    // Keep the overloads of Serial visible, they all go through the ones above.
+    using Serial::Read;
+    using Serial::Write;
+
+    /** True once every recorded byte has been read. */
+    bool IsFinished() const { return m_readRecord >= m_records.size(); }
+
+    /** Number of written bytes that differ from the capture, or that go past its end. */
+    size_t GetWriteMismatchCount() const { return m_writeMismatches; }
+
+private:
+    /** Move the read cursor past the write records and the read records already consumed. */
+    void SkipToNextRead();
+
+    bool HasArrived(const SerialCapture::Record& record) const;
+    std::chrono::steady_clock::time_point GetArrival(const SerialCapture::Record& record) const;
+
+private:
+    Timing                                m_timing;
+    std::vector<SerialCapture::Record>    m_records;
+    std::vector<uint8_t>                  m_data;
+    bool                                  m_isLoaded = false;
+    bool                                  m_isOpen   = false;
+    std::chrono::steady_clock::time_point m_start;
+
+    // Position in the capture, one for each direction.
+    size_t m_readRecord  = 0;
+    size_t m_readOffset  = 0;
+    size_t m_writeRecord = 0;
+    size_t m_writeOffset = 0;
+
+    std::atomic<size_t> m_writeMismatches = 0;
+};
+}    // namespace Brigerad
@@ -0,0 +1,80 @@
+/**
+ * @file    ThreadPool.h
+ * @author  Samuel Martel
+ * @p       https://github.com/smartel99
+ * @date    10/19/2026 3:40:00 PM
+ *
+ * @brief
+ ******************************************************************************
+ * Copyright (C) 2020  Samuel Martel
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *****************************************************************************/
+#pragma once
+
+/*********************************************************************************************************************/
+// [SECTION] Includes
+/*********************************************************************************************************************/
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Brigerad
+{
+/*********************************************************************************************************************/
+// [SECTION] Class Declarations
+/*********************************************************************************************************************/
+/**
+ * Fixed set of worker threads running the jobs submitted to it, in submission order.
+ */
+class ThreadPool
+{
+public:
+    /**
+     * \param threadCount Number of workers. 0 uses one per hardware thread, minus the one that
+     *                    submits the jobs.
+     */
+    explicit ThreadPool(size_t threadCount = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    void Submit(std::function<void()> job);
+
+    size_t GetThreadCount() const { return m_threads.size(); }
+
+    /**
+     * The pool the engine shares between its users, e.g. the systems of every scene, so that
+     * they don't each start one thread per core. Created on first use, with the default count.
+     */
+    static ThreadPool& GetShared();
+    /** Stop the workers of the shared pool, once nothing submits to it anymore. */
+    static void ShutdownShared();
+
+private:
+    void WorkerMain();
+
+private:
+    std::vector<std::thread>          m_threads;
+    std::mutex                        m_mutex;
+    std::condition_variable           m_cv;
+    std::deque<std::function<void()>> m_jobs;
+    bool                              m_stopping = false;
+};
+}    // namespace Brigerad
@@ -0,0 +1,129 @@
+/**
+ * @file   LinuxMappedFile.cpp
+ * @author Samuel Martel
+ * @date   2026/10/19
+ *
+ * @brief  Source for the MappedFile module.
+ */
+#include "brpch.h"
+#include "Brigerad/Utils/MappedFile.h"
+
+#if defined(BR_PLATFORM_LINUX)
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace Brigerad
+{
+bool MappedFile::Open(const std::string& path, Mode mode, size_t size)
+{
+    Close();
+
+    int fd = open(path.c_str(), mode == Mode::Read ? O_RDONLY : (O_RDWR | O_CREAT), 0644);
+    if (fd < 0)
+    {
+        BR_CORE_ERROR("[MappedFile] Unable to open '{}': {}", path, strerror(errno));
+        return false;
+    }
+
+    m_path = path;
+    m_mode = mode;
+    m_file = fd;
+
+    if (size == 0)
+    {
+        struct stat st;
+        if (fstat(fd, &st) != 0)
+        {
+            BR_CORE_ERROR("[MappedFile] Unable to stat '{}': {}", path, strerror(errno));
+            Close();
+            return false;
+        }
+        size = (size_t)st.st_size;
+    }
+    else if (mode == Mode::ReadWrite && ftruncate(fd, (off_t)size) != 0)
+    {
+        BR_CORE_ERROR("[MappedFile] Unable to resize '{}': {}", path, strerror(errno));
+        Close();
+        return false;
+    }
+
+    m_size = size;
+    if (!Map())
+    {
+        Close();
+        return false;
+    }
+    return true;
+}
+
+bool MappedFile::Resize(size_t size)
+{
+    BR_CORE_ASSERT(m_mode == Mode::ReadWrite, "Can't resize a read-only mapping!");
+    if (m_file < 0 || m_mode != Mode::ReadWrite)
+    {
+        return false;
+    }
+
+    Unmap();
+    if (ftruncate((int)m_file, (off_t)size) != 0)
+    {
+        BR_CORE_ERROR("[MappedFile] Unable to resize '{}': {}", m_path, strerror(errno));
+        return false;
+    }
+    m_size = size;
+    return Map();
+}
+
+void MappedFile::Flush()
+{
+    if (m_data != nullptr && m_mode == Mode::ReadWrite)
+    {
+        msync(m_data, m_size, MS_ASYNC);
+    }
+}
+
+void MappedFile::Close()
+{
+    Unmap();
+    if (m_file >= 0)
+    {
+        close((int)m_file);
+        m_file = -1;
+    }
+    m_size = 0;
+}
+
+bool MappedFile::Map()
+{
+    if (m_size == 0)
+    {
+        // mmap refuses empty mappings, an empty file is still a valid file.
+        return true;
+    }
+
+    int   prot = m_mode == Mode::Read ? PROT_READ : (PROT_READ | PROT_WRITE);
+    void* data = mmap(nullptr, m_size, prot, MAP_SHARED, (int)m_file, 0);
+    if (data == MAP_FAILED)
+    {
+        BR_CORE_ERROR("[MappedFile] Unable to map '{}': {}", m_path, strerror(errno));
+        return false;
+    }
+
+    m_data = static_cast<uint8_t*>(data);
+    return true;
+}
+
+void MappedFile::Unmap()
+{
+    if (m_data != nullptr)
+    {
+        munmap(m_data, m_size);
+        m_data = nullptr;
+    }
+}
+}    // namespace Brigerad
+#endif
@@ -0,0 +1,157 @@
+/**
+ * @file   LinuxSerialPortRegistry.cpp
+ * @author Samuel Martel
+ * @date   2026/10/19
+ *
+ * @brief  Source for the SerialPortRegistry module.
+ */
+#include "brpch.h"
+#include "Brigerad/Utils/SerialPortRegistry.h"
+
+#if defined(BR_PLATFORM_LINUX)
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <thread>
+
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+namespace Brigerad
+{
+// udev creates the node, then renames and chmods it, wait for it to settle before enumerating.
+static constexpr int s_settleTimeMs = 100;
+// Without inotify, fall back to enumerating every so often.
+static constexpr int s_fallbackPeriodMs = 2000;
+
+static std::thread s_thread;
+static int         s_inotify   = -1;
+static int         s_wakeup[2] = {-1, -1};    // Written to by StopWatching to unblock the thread.
+
+static bool IsSerialNode(const char* name)
+{
+    // The same prefixes serial::list_ports looks for.
+    static const char* prefixes[] = {"ttyACM", "ttyS", "ttyUSB", "tty.", "cu.", "rfcomm"};
+    for (const char* prefix : prefixes)
+    {
+        if (strncmp(name, prefix, strlen(prefix)) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Read the pending inotify events.
+ *
+ * \return true if one of them concerns a serial port.
+ */
+static bool DrainEvents()
+{
+    alignas(inotify_event) char buffer[4096];
+    bool                        isRelevant = false;
+
+    ssize_t len;
+    while ((len = read(s_inotify, buffer, sizeof(buffer))) > 0)
+    {
+        for (char* p = buffer; p < buffer + len;)
+        {
+            const auto* event = reinterpret_cast<const inotify_event*>(p);
+            if (event->len != 0 && IsSerialNode(event->name))
+            {
+                isRelevant = true;
+            }
+            p += sizeof(inotify_event) + event->len;
+        }
+    }
+
+    return isRelevant;
+}
+
+void SerialPortRegistry::StartWatching()
+{
+    if (pipe(s_wakeup) != 0)
+    {
+        // The thread could never be stopped, settle for a single enumeration.
+        BR_CORE_ERROR("[SerialPortRegistry] Unable to create pipe: {}", strerror(errno));
+        s_wakeup[0] = s_wakeup[1] = -1;
+        Refresh();
+        return;
+    }
+
+    s_inotify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (s_inotify < 0 ||
+        inotify_add_watch(
+          s_inotify, "/dev", IN_CREATE | IN_DELETE | IN_ATTRIB | IN_MOVED_FROM | IN_MOVED_TO) < 0)
+    {
+        BR_CORE_WARN("[SerialPortRegistry] Unable to watch /dev ({}), polling instead.",
+                     strerror(errno));
+        if (s_inotify >= 0)
+        {
+            close(s_inotify);
+            s_inotify = -1;
+        }
+    }
+
+    s_thread = std::thread([]() {
+        Refresh();
+
+        pollfd fds[2] = {{s_wakeup[0], POLLIN, 0}, {s_inotify, POLLIN, 0}};
+        nfds_t count  = s_inotify >= 0 ? 2 : 1;
+        int    wait   = s_inotify >= 0 ? -1 : s_fallbackPeriodMs;
+        while (true)
+        {
+            int ret = poll(fds, count, wait);
+            if (ret < 0 && errno != EINTR)
+            {
+                BR_CORE_ERROR("[SerialPortRegistry] poll failed: {}", strerror(errno));
+                return;
+            }
+            if ((fds[0].revents & POLLIN) != 0)
+            {
+                // StopWatching was called.
+                return;
+            }
+
+            if (s_inotify < 0)
+            {
+                Refresh();
+            }
+            else if ((fds[1].revents & POLLIN) != 0 && DrainEvents())
+            {
+                // Let the rest of the burst come in, then enumerate once for all of it.
+                while (poll(&fds[1], 1, s_settleTimeMs) > 0)
+                {
+                    DrainEvents();
+                }
+                Refresh();
+            }
+        }
+    });
+}
+
+void SerialPortRegistry::StopWatching()
+{
+    if (s_thread.joinable())
+    {
+        char c = 0;
+        if (write(s_wakeup[1], &c, 1) != 1)
+        {
+            BR_CORE_ERROR("[SerialPortRegistry] Unable to stop the watcher: {}", strerror(errno));
+        }
+        s_thread.join();
+    }
+
+    for (int* fd : {&s_inotify, &s_wakeup[0], &s_wakeup[1]})
+    {
+        if (*fd >= 0)
+        {
+            close(*fd);
+            *fd = -1;
+        }
+    }
+}
+}    // namespace Brigerad
+#endif
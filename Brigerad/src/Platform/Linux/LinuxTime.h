@@ -2,11 +2,22 @@
 #if defined(BR_PLATFORM_LINUX)
 #include "GLFW/glfw3.h"
 
+#include <cstdint>
+#include <time.h>
+
 namespace Brigerad
 {
-double LinuxGetTime()
+inline double LinuxGetTime()
 {
     return glfwGetTime();
 }
+
+inline int64_t LinuxGetTimeNs()
+{
+    // CLOCK_MONOTONIC is not affected by changes of the system time.
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
 } // namespace Brigerad
 #endif
@@ -5,6 +5,8 @@
 #include "Brigerad/Events/MouseEvent.h"
 #include "Brigerad/Events/KeyEvents.h"
 
+#include "Brigerad/Renderer/RenderThread.h"
+
 #include "Platform/OpenGL/OpenGLContext.h"
 
 #if defined(BR_PLATFORM_LINUX)
@@ -30,16 +32,31 @@ void LinuxWindow::OnUpdate()
     m_context->SwapBuffers();
 }
 
+void LinuxWindow::WaitEvents(double timeout)
+{
+    BR_PROFILE_FUNCTION();
+
+    glfwWaitEventsTimeout(timeout);
+}
+
+void LinuxWindow::Wake()
+{
+    glfwPostEmptyEvent();
+}
+
 void LinuxWindow::SetVSync(bool enabled)
 {
-    if (enabled)
-    {
-        glfwSwapInterval(1);
-    }
-    else
-    {
-        glfwSwapInterval(0);
-    }
+    // The swap interval applies to the context current on the calling thread.
+    RenderThread::Submit([enabled]() {
+        if (enabled)
+        {
+            glfwSwapInterval(1);
+        }
+        else
+        {
+            glfwSwapInterval(0);
+        }
+    });
 
     m_data.vsync = enabled;
 }
@@ -1,6 +1,8 @@
 #include "brpch.h"
 #include "OpenGLBuffer.h"
 
+#include "Brigerad/Renderer/RenderThread.h"
+
 #include <glad/glad.h>
 
 namespace Brigerad
@@ -13,25 +15,29 @@ OpenGLVertexBuffer::OpenGLVertexBuffer(uint32_t size)
 {
     BR_PROFILE_FUNCTION();
 
-    glCreateBuffers(1, &m_rendererID);
-    glBindBuffer(GL_ARRAY_BUFFER, m_rendererID);
-    glBufferData(GL_ARRAY_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
+    RenderThread::Execute([&]() {
+        glCreateBuffers(1, &m_rendererID);
+        glBindBuffer(GL_ARRAY_BUFFER, m_rendererID);
+        glBufferData(GL_ARRAY_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
+    });
 }
 
 OpenGLVertexBuffer::OpenGLVertexBuffer(float* vertices, uint32_t size)
 {
     BR_PROFILE_FUNCTION();
 
-    glCreateBuffers(1, &m_rendererID);
-    glBindBuffer(GL_ARRAY_BUFFER, m_rendererID);
-    glBufferData(GL_ARRAY_BUFFER, size, vertices, GL_STATIC_DRAW);
+    RenderThread::Execute([&]() {
+        glCreateBuffers(1, &m_rendererID);
+        glBindBuffer(GL_ARRAY_BUFFER, m_rendererID);
+        glBufferData(GL_ARRAY_BUFFER, size, vertices, GL_STATIC_DRAW);
+    });
 }
 
 OpenGLVertexBuffer::~OpenGLVertexBuffer()
 {
     BR_PROFILE_FUNCTION();
 
-    glDeleteBuffers(1, &m_rendererID);
+    RenderThread::Submit([id = m_rendererID]() { glDeleteBuffers(1, &id); });
 }
 
 
@@ -39,20 +45,29 @@ void OpenGLVertexBuffer::Bind() const
 {
     BR_PROFILE_FUNCTION();
 
-    glBindBuffer(GL_ARRAY_BUFFER, m_rendererID);
+    RenderThread::Submit([id = m_rendererID]() { glBindBuffer(GL_ARRAY_BUFFER, id); });
 }
 
 void OpenGLVertexBuffer::Unbind() const
 {
     BR_PROFILE_FUNCTION();
 
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    RenderThread::Submit([]() { glBindBuffer(GL_ARRAY_BUFFER, 0); });
+}
+
+void OpenGLVertexBuffer::SetData(const void* data, uint32_t size, uint32_t offset)
+{
+    RenderThread::Submit(
+      [id = m_rendererID, data = RenderThread::CopyData(data, size), size, offset]() {
+          glBindBuffer(GL_ARRAY_BUFFER, id);
+          glBufferSubData(GL_ARRAY_BUFFER, offset, size, data);
+      });
 }
 
-void OpenGLVertexBuffer::SetData(const void* data, uint32_t size)
+void OpenGLVertexBuffer::BindStorage(uint32_t binding) const
 {
-    glBindBuffer(GL_ARRAY_BUFFER, m_rendererID);
-    glBufferSubData(GL_ARRAY_BUFFER, 0, size, data);
+    RenderThread::Submit(
+      [id = m_rendererID, binding]() { glBindBufferBase(GL_SHADER_STORAGE_BUFFER, binding, id); });
 }
 
 
@@ -65,16 +80,18 @@ OpenGLIndexBuffer::OpenGLIndexBuffer(uint32_t* indices, uint32_t count)
 {
     BR_PROFILE_FUNCTION();
 
-    glCreateBuffers(1, &m_rendererID);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_rendererID);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, count * sizeof(uint32_t), indices, GL_STATIC_DRAW);
+    RenderThread::Execute([&]() {
+        glCreateBuffers(1, &m_rendererID);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_rendererID);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, count * sizeof(uint32_t), indices, GL_STATIC_DRAW);
+    });
 }
 
 OpenGLIndexBuffer::~OpenGLIndexBuffer()
 {
     BR_PROFILE_FUNCTION();
 
-    glDeleteBuffers(1, &m_rendererID);
+    RenderThread::Submit([id = m_rendererID]() { glDeleteBuffers(1, &id); });
 }
 
 
@@ -82,14 +99,14 @@ void OpenGLIndexBuffer::Bind() const
 {
     BR_PROFILE_FUNCTION();
 
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_rendererID);
+    RenderThread::Submit([id = m_rendererID]() { glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id); });
 }
 
 void OpenGLIndexBuffer::Unbind() const
 {
     BR_PROFILE_FUNCTION();
 
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    RenderThread::Submit([]() { glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0); });
 }
 
 }  // namespace Brigerad
@@ -19,7 +19,9 @@ class OpenGLVertexBuffer : public VertexBuffer
         m_layout = layout;
     }
 
-    virtual void SetData(const void* data, uint32_t size) override;
+    virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) override;
+
+    virtual void BindStorage(uint32_t binding) const override;
 
     virtual const uint32_t GetId() const override { return m_rendererID; }
 
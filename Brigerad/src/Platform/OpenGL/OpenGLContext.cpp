@@ -8,6 +8,8 @@
 #include "brpch.h"
 #include "OpenGLContext.h"
 
+#include "Brigerad/Renderer/RenderThread.h"
+
 #include <GLFW/glfw3.h>
 #include <glad/glad.h>
 
@@ -50,7 +52,17 @@ void OpenGLContext::Init()
 void OpenGLContext::SwapBuffers()
 {
     BR_PROFILE_FUNCTION();
-    glfwSwapBuffers(m_windowHandle);
+    RenderThread::Submit([window = m_windowHandle]() { glfwSwapBuffers(window); });
+}
+
+void OpenGLContext::MakeCurrent()
+{
+    glfwMakeContextCurrent(m_windowHandle);
+}
+
+void OpenGLContext::ReleaseCurrent()
+{
+    glfwMakeContextCurrent(nullptr);
 }
 }
 
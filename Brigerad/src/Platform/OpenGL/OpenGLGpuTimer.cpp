@@ -0,0 +1,77 @@
+/**
+ * @file   OpenGLGpuTimer.cpp
+ * @author Samuel Martel
+ * @date   2026/10/19
+ *
+ * @brief  Source for the OpenGLGpuTimer module.
+ */
+#include "brpch.h"
+#include "OpenGLGpuTimer.h"
+
+#include "Brigerad/Renderer/RenderThread.h"
+
+#include <glad/glad.h>
+
+namespace Brigerad
+{
+OpenGLGpuTimer::OpenGLGpuTimer()
+{
+    RenderThread::Execute([&]() { glGenQueries(GLsizei(s_ringSize), m_queries); });
+}
+
+OpenGLGpuTimer::~OpenGLGpuTimer()
+{
+    // Waits for the commands still using the queries.
+    RenderThread::Execute([&]() { glDeleteQueries(GLsizei(s_ringSize), m_queries); });
+}
+
+void OpenGLGpuTimer::Begin()
+{
+    RenderThread::Submit([this]() {
+        ReadResults();
+        if (m_pending == s_ringSize)
+        {
+            // Every query is still in flight, skip this measurement.
+            return;
+        }
+
+        glBeginQuery(GL_TIME_ELAPSED, m_queries[(m_first + m_pending) % s_ringSize]);
+        m_isActive = true;
+    });
+}
+
+void OpenGLGpuTimer::End()
+{
+    RenderThread::Submit([this]() {
+        if (!m_isActive)
+        {
+            return;
+        }
+
+        glEndQuery(GL_TIME_ELAPSED);
+        m_isActive = false;
+        m_pending++;
+    });
+}
+
+void OpenGLGpuTimer::ReadResults()
+{
+    // The queries complete in order, stop at the first one that isn't done.
+    while (m_pending != 0)
+    {
+        GLint isAvailable = GL_FALSE;
+        glGetQueryObjectiv(m_queries[m_first], GL_QUERY_RESULT_AVAILABLE, &isAvailable);
+        if (isAvailable == GL_FALSE)
+        {
+            break;
+        }
+
+        GLuint64 ns = 0;
+        glGetQueryObjectui64v(m_queries[m_first], GL_QUERY_RESULT, &ns);
+        m_lastMs.store(float(double(ns) * 1e-6), std::memory_order_relaxed);
+
+        m_first = (m_first + 1) % s_ringSize;
+        m_pending--;
+    }
+}
+}    // namespace Brigerad
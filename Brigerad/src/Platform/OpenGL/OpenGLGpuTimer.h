@@ -0,0 +1,43 @@
+/**
+ * @file   OpenGLGpuTimer.h
+ * @author Samuel Martel
+ * @date   2026/10/19
+ *
+ * @brief  Header for the OpenGLGpuTimer module.
+ */
+#pragma once
+
+#include "Brigerad/Renderer/GpuTimer.h"
+
+#include <atomic>
+
+namespace Brigerad
+{
+/**
+ * A ring of GL_TIME_ELAPSED queries, one per measurement in flight.
+ * Everything but the last result is only touched on the render thread.
+ */
+class OpenGLGpuTimer : public GpuTimer
+{
+public:
+    OpenGLGpuTimer();
+    ~OpenGLGpuTimer() override;
+
+    void Begin() override;
+    void End() override;
+
+    float GetLastMs() const override { return m_lastMs.load(std::memory_order_relaxed); }
+
+private:
+    void ReadResults();
+
+private:
+    static constexpr size_t s_ringSize = 4;
+
+    uint32_t           m_queries[s_ringSize] = {};
+    size_t             m_first               = 0;    // Oldest query waiting for its result.
+    size_t             m_pending             = 0;    // Queries ended, waiting for their results.
+    bool               m_isActive            = false;
+    std::atomic<float> m_lastMs              = -1.0f;
+};
+}    // namespace Brigerad
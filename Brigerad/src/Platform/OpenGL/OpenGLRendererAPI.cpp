@@ -8,6 +8,8 @@
 #include "brpch.h"
 #include "OpenGLRendererAPI.h"
 
+#include "Brigerad/Renderer/RenderThread.h"
+
 #include <glad/glad.h>
 
 namespace Brigerad
@@ -16,37 +18,68 @@ void OpenGLRendererAPI::Init()
 {
     BR_PROFILE_FUNCTION();
 
-    // Enable alpha blending.
-    glEnable(GL_BLEND);
-    // Set the way the blending is done.
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    RenderThread::Submit([]() {
+        // Enable alpha blending.
+        glEnable(GL_BLEND);
+        // Set the way the blending is done.
+        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
-    // Enable depth testing, which tells OpenGL to check if the pixel to be
-    // drawn is in front or behind the others.
-    glEnable(GL_DEPTH_TEST);
+        // Enable depth testing, which tells OpenGL to check if the pixel to be
+        // drawn is in front or behind the others.
+        glEnable(GL_DEPTH_TEST);
 
-    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);  // Disable byte-alignment restriction.
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);  // Disable byte-alignment restriction.
+    });
 }
 
 void OpenGLRendererAPI::SetClearColor(const glm::vec4& color)
 {
-    glClearColor(color.r, color.g, color.b, color.a);
+    RenderThread::Submit([color]() { glClearColor(color.r, color.g, color.b, color.a); });
 }
 
 void OpenGLRendererAPI::Clear()
 {
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    RenderThread::Submit([]() { glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT); });
 }
 
 void OpenGLRendererAPI::DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount)
 {
     uint32_t count = indexCount == 0 ? vertexArray->GetIndexBuffers()->GetCount() : indexCount;
-    glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr);
-    glBindTexture(GL_TEXTURE_2D, 0);
+    RenderThread::Submit([count]() {
+        glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr);
+        glBindTexture(GL_TEXTURE_2D, 0);
+    });
+}
+
+void OpenGLRendererAPI::DrawIndexedInstanced(const Ref<VertexArray>& vertexArray,
+                                             uint32_t                indexCount,
+                                             uint32_t                instanceCount)
+{
+    uint32_t count = indexCount == 0 ? vertexArray->GetIndexBuffers()->GetCount() : indexCount;
+    RenderThread::Submit([count, instanceCount]() {
+        glDrawElementsInstanced(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr, instanceCount);
+    });
+}
+
+bool OpenGLRendererAPI::SupportsCompute() const
+{
+    // Filled by gladLoadGLLoader when the context was created.
+    return GLAD_GL_VERSION_4_3 != 0;
+}
+
+void OpenGLRendererAPI::DispatchCompute(uint32_t groupCountX)
+{
+    RenderThread::Submit([groupCountX]() {
+        glDispatchCompute(groupCountX, 1, 1);
+        // The buffers are read as vertices and by the next dispatch, and updated with
+        // glBufferSubData when particles are emitted.
+        glMemoryBarrier(GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT | GL_SHADER_STORAGE_BARRIER_BIT |
+                        GL_BUFFER_UPDATE_BARRIER_BIT);
+    });
 }
 
 void OpenGLRendererAPI::SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height)
 {
-    glViewport(x, y, width, height);
+    RenderThread::Submit([x, y, width, height]() { glViewport(x, y, width, height); });
 }
 }  // namespace Brigerad
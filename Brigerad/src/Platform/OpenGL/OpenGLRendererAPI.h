@@ -12,6 +12,12 @@ class OpenGLRendererAPI : public RendererAPI
 
     virtual void DrawIndexed(const Ref<VertexArray>& vertexArray,
                              uint32_t indexCount = 0) override;
+    virtual void DrawIndexedInstanced(const Ref<VertexArray>& vertexArray,
+                                      uint32_t indexCount,
+                                      uint32_t instanceCount) override;
+
+    virtual bool SupportsCompute() const override;
+    virtual void DispatchCompute(uint32_t groupCountX) override;
 };
 
 }  // namespace Brigerad
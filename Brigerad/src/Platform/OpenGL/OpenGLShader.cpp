@@ -9,6 +9,8 @@
 #include "brpch.h"
 #include "OpenGLShader.h"
 
+#include "Brigerad/Renderer/RenderThread.h"
+
 #include <fstream>
 #include <glad/glad.h>
 #include <glm/gtc/type_ptr.hpp>
@@ -35,6 +37,10 @@ static GLenum ShaderTypeFromString(const std::string& type)
     {
         return GL_FRAGMENT_SHADER;
     }
+    else if (type == "compute")
+    {
+        return GL_COMPUTE_SHADER;
+    }
     else
     {
         BR_CORE_ASSERT(false, "Unknown shader type!");
@@ -42,6 +48,17 @@ static GLenum ShaderTypeFromString(const std::string& type)
     }
 }
 
+// The uniforms are set when the command runs, keep a copy of what they point to until then.
+static const char* KeepName(const std::string& name)
+{
+    return static_cast<const char*>(RenderThread::CopyData(name.c_str(), name.size() + 1));
+}
+
+static const int* KeepValues(const int* values, uint32_t count)
+{
+    return static_cast<const int*>(RenderThread::CopyData(values, count * sizeof(int)));
+}
+
 
 /**
  * @brief Construct a new OpenGLShader object from a file.
@@ -103,7 +120,7 @@ OpenGLShader::OpenGLShader(const std::string& name,
 OpenGLShader::~OpenGLShader()
 {
     BR_PROFILE_FUNCTION();
-    glDeleteProgram(m_rendererID);
+    RenderThread::Submit([id = m_rendererID]() { glDeleteProgram(id); });
 }
 
 
@@ -146,7 +163,7 @@ std::string OpenGLShader::ReadFile(const std::string& filePath)
  * @brief   Pre-processes the source file to ensure a valid structure.
  *          This process takes the content of the file and ensures that there is
  *          at least one "#type vertex" token and either one "#type fragment" or
- *          "#type pixel" token.
+ *          "#type pixel" token, or a single "#type compute" token.
  *
  * @param source The source file.
  * @return  std::unordered_map<GLenum, std::string> A map containing the
@@ -199,90 +216,92 @@ std::unordered_map<GLenum, std::string> OpenGLShader::PreProcess(const std::stri
 void OpenGLShader::Compile(const std::unordered_map<GLenum, std::string>& shaderSrcs)
 {
     BR_PROFILE_FUNCTION();
-    // Create an OpenGL program.
-    GLuint program = glCreateProgram();
-    BR_CORE_ASSERT(shaderSrcs.size() <= 2, "Maximum 2 shaders per file");
-    std::array<GLuint, 2> shaderIDs;
-    int shaderIdIdx = 0;
-
-    // For each shaders in the map:
-    for (auto& kv : shaderSrcs)
-    {
-        GLenum type               = kv.first;
-        const std::string& source = kv.second;
+    RenderThread::Execute([&]() {
+        // Create an OpenGL program.
+        GLuint program = glCreateProgram();
+        BR_CORE_ASSERT(shaderSrcs.size() <= 2, "Maximum 2 shaders per file");
+        std::array<GLuint, 2> shaderIDs;
+        int shaderIdIdx = 0;
+
+        // For each shaders in the map:
+        for (auto& kv : shaderSrcs)
+        {
+            GLenum type               = kv.first;
+            const std::string& source = kv.second;
 
-        // Create an empty shader handle.
-        GLuint shader = glCreateShader(type);
+            // Create an empty shader handle.
+            GLuint shader = glCreateShader(type);
 
-        // Send the shader source code to GL.
-        const GLchar* sourceCStr = (const GLchar*)source.c_str();
-        glShaderSource(shader, 1, &sourceCStr, nullptr);
+            // Send the shader source code to GL.
+            const GLchar* sourceCStr = (const GLchar*)source.c_str();
+            glShaderSource(shader, 1, &sourceCStr, nullptr);
 
-        // Compile the shader.
-        glCompileShader(shader);
+            // Compile the shader.
+            glCompileShader(shader);
 
-        // Make sure that the shader compiled successfully.
-        GLint isCompiled = 0;
-        glGetShaderiv(shader, GL_COMPILE_STATUS, &isCompiled);
-        if (isCompiled == GL_FALSE)
-        {
-            GLint maxLength = 0;
-            glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &maxLength);
+            // Make sure that the shader compiled successfully.
+            GLint isCompiled = 0;
+            glGetShaderiv(shader, GL_COMPILE_STATUS, &isCompiled);
+            if (isCompiled == GL_FALSE)
+            {
+                GLint maxLength = 0;
+                glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &maxLength);
 
-            // The maxLength includes the NULL terminator.
-            std::vector<GLchar> infoLog(maxLength);
-            glGetShaderInfoLog(shader, maxLength, &maxLength, &infoLog[0]);
+                // The maxLength includes the NULL terminator.
+                std::vector<GLchar> infoLog(maxLength);
+                glGetShaderInfoLog(shader, maxLength, &maxLength, &infoLog[0]);
 
-            // We don't need that shader anymore.
-            glDeleteShader(shader);
+                // We don't need that shader anymore.
+                glDeleteShader(shader);
 
-            BR_CORE_ERROR("{0}", infoLog.data());
-            BR_CORE_ASSERT(false, "Unable to compile vertex shader");
+                BR_CORE_ERROR("{0}", infoLog.data());
+                BR_CORE_ASSERT(false, "Unable to compile vertex shader");
+            }
+
+            // Attach our shaders to our program
+            glAttachShader(program, shader);
+            shaderIDs[shaderIdIdx++] = shader;
         }
 
-        // Attach our shaders to our program
-        glAttachShader(program, shader);
-        shaderIDs[shaderIdIdx++] = shader;
-    }
+        // Vertex and Fragment shaders are successfully compiled.
+        // Now time to link them together into a program.
+        // Link our program.
+        glLinkProgram(program);
 
-    // Vertex and Fragment shaders are successfully compiled.
-    // Now time to link them together into a program.
-    // Link our program.
-    glLinkProgram(program);
+        // Note the different functions here: glGetProgram* instead of glGetShader*.
+        GLint isLinked = 0;
+        glGetProgramiv(program, GL_LINK_STATUS, (int*)&isLinked);
+        if (isLinked == GL_FALSE)
+        {
+            GLint maxLength = 0;
+            glGetProgramiv(program, GL_INFO_LOG_LENGTH, &maxLength);
 
-    // Note the different functions here: glGetProgram* instead of glGetShader*.
-    GLint isLinked = 0;
-    glGetProgramiv(program, GL_LINK_STATUS, (int*)&isLinked);
-    if (isLinked == GL_FALSE)
-    {
-        GLint maxLength = 0;
-        glGetProgramiv(program, GL_INFO_LOG_LENGTH, &maxLength);
+            // The maxLength includes the NULL terminator.
+            std::vector<GLchar> infoLog(maxLength);
+            glGetProgramInfoLog(program, maxLength, &maxLength, &infoLog[0]);
 
-        // The maxLength includes the NULL terminator.
-        std::vector<GLchar> infoLog(maxLength);
-        glGetProgramInfoLog(program, maxLength, &maxLength, &infoLog[0]);
+            // Delete the program.
+            glDeleteProgram(program);
 
-        // Delete the program.
-        glDeleteProgram(program);
+            // We don't need the shaders anymore.
+            for (auto id : shaderIDs)
+            {
+                glDeleteShader(id);
+            }
 
-        // We don't need the shaders anymore.
+            BR_CORE_ERROR("{0}", infoLog.data());
+            BR_CORE_ASSERT(false, "Unable to link shader");
+
+            return;
+        }
+
+        // Detach shaders after successful link.
         for (auto id : shaderIDs)
         {
-            glDeleteShader(id);
+            glDetachShader(program, id);
         }
-
-        BR_CORE_ERROR("{0}", infoLog.data());
-        BR_CORE_ASSERT(false, "Unable to link shader");
-
-        return;
-    }
-
-    // Detach shaders after successful link.
-    for (auto id : shaderIDs)
-    {
-        glDetachShader(program, id);
-    }
-    m_rendererID = program;
+        m_rendererID = program;
+    });
 }
 
 
@@ -293,13 +312,15 @@ void OpenGLShader::Bind() const
 {
     BR_PROFILE_FUNCTION();
 
-    // If this shader is not the currently bound shader:
-    if (m_rendererID != pActiveShader)
-    {
-        // Bind it.
-        pActiveShader = m_rendererID;
-        glUseProgram(m_rendererID);
-    }
+    RenderThread::Submit([id = m_rendererID]() {
+        // If this shader is not the currently bound shader:
+        if (id != pActiveShader)
+        {
+            // Bind it.
+            pActiveShader = id;
+            glUseProgram(id);
+        }
+    });
 }
 
 /**
@@ -310,8 +331,10 @@ void OpenGLShader::Unbind() const
 {
     BR_PROFILE_FUNCTION();
 
-    pActiveShader = 0;
-    glUseProgram(0);
+    RenderThread::Submit([]() {
+        pActiveShader = 0;
+        glUseProgram(0);
+    });
 }
 
 
@@ -433,14 +456,19 @@ void OpenGLShader::SetMat4(const std::string& name, const glm::mat4& value)
  */
 void OpenGLShader::UploadUniformInt(const std::string& name, int value)
 {
-    GLint location = glGetUniformLocation(m_rendererID, name.c_str());
-    glUniform1i(location, value);
+    RenderThread::Submit([id = m_rendererID, name = KeepName(name), value]() {
+        GLint location = glGetUniformLocation(id, name);
+        glUniform1i(location, value);
+    });
 }
 
 void OpenGLShader::UploadUniformIntArray(const std::string& name, int* values, uint32_t count)
 {
-    GLint location = glGetUniformLocation(m_rendererID, name.c_str());
-    glUniform1iv(location, count, values);
+    RenderThread::Submit(
+      [id = m_rendererID, name = KeepName(name), values = KeepValues(values, count), count]() {
+          GLint location = glGetUniformLocation(id, name);
+          glUniform1iv(location, count, values);
+      });
 }
 
 /**
@@ -451,8 +479,10 @@ void OpenGLShader::UploadUniformIntArray(const std::string& name, int* values, u
  */
 void OpenGLShader::UploadUniformFloat(const std::string& name, float value)
 {
-    GLint location = glGetUniformLocation(m_rendererID, name.c_str());
-    glUniform1f(location, value);
+    RenderThread::Submit([id = m_rendererID, name = KeepName(name), value]() {
+        GLint location = glGetUniformLocation(id, name);
+        glUniform1f(location, value);
+    });
 }
 
 /**
@@ -463,8 +493,10 @@ void OpenGLShader::UploadUniformFloat(const std::string& name, float value)
  */
 void OpenGLShader::UploadUniformFloat2(const std::string& name, const glm::vec2& values)
 {
-    GLint location = glGetUniformLocation(m_rendererID, name.c_str());
-    glUniform2f(location, values.x, values.y);
+    RenderThread::Submit([id = m_rendererID, name = KeepName(name), values]() {
+        GLint location = glGetUniformLocation(id, name);
+        glUniform2f(location, values.x, values.y);
+    });
 }
 
 /**
@@ -475,8 +507,10 @@ void OpenGLShader::UploadUniformFloat2(const std::string& name, const glm::vec2&
  */
 void OpenGLShader::UploadUniformFloat3(const std::string& name, const glm::vec3& values)
 {
-    GLint location = glGetUniformLocation(m_rendererID, name.c_str());
-    glUniform3f(location, values.x, values.y, values.z);
+    RenderThread::Submit([id = m_rendererID, name = KeepName(name), values]() {
+        GLint location = glGetUniformLocation(id, name);
+        glUniform3f(location, values.x, values.y, values.z);
+    });
 }
 
 /**
@@ -487,8 +521,10 @@ void OpenGLShader::UploadUniformFloat3(const std::string& name, const glm::vec3&
  */
 void OpenGLShader::UploadUniformFloat4(const std::string& name, const glm::vec4& values)
 {
-    GLint location = glGetUniformLocation(m_rendererID, name.c_str());
-    glUniform4f(location, values.x, values.y, values.z, values.w);
+    RenderThread::Submit([id = m_rendererID, name = KeepName(name), values]() {
+        GLint location = glGetUniformLocation(id, name);
+        glUniform4f(location, values.x, values.y, values.z, values.w);
+    });
 }
 
 /**
@@ -499,8 +535,10 @@ void OpenGLShader::UploadUniformFloat4(const std::string& name, const glm::vec4&
  */
 void OpenGLShader::UploadUniformMat3(const std::string& name, const glm::mat3& matrix)
 {
-    GLint location = glGetUniformLocation(m_rendererID, name.c_str());
-    glUniformMatrix3fv(location, 1, GL_FALSE, glm::value_ptr(matrix));
+    RenderThread::Submit([id = m_rendererID, name = KeepName(name), matrix]() {
+        GLint location = glGetUniformLocation(id, name);
+        glUniformMatrix3fv(location, 1, GL_FALSE, glm::value_ptr(matrix));
+    });
 }
 
 /**
@@ -511,8 +549,10 @@ void OpenGLShader::UploadUniformMat3(const std::string& name, const glm::mat3& m
  */
 void OpenGLShader::UploadUniformMat4(const std::string& name, const glm::mat4& matrix)
 {
-    GLint location = glGetUniformLocation(m_rendererID, name.c_str());
-    glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(matrix));
+    RenderThread::Submit([id = m_rendererID, name = KeepName(name), matrix]() {
+        GLint location = glGetUniformLocation(id, name);
+        glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(matrix));
+    });
 }
 
 }  // namespace Brigerad
@@ -8,6 +8,8 @@
 #include "brpch.h"
 #include "OpenGLTexture.h"
 
+#include "Brigerad/Renderer/RenderThread.h"
+
 #include "stb_image.h"
 
 namespace Brigerad
@@ -40,14 +42,16 @@ OpenGLTexture2D::OpenGLTexture2D(uint32_t width, uint32_t height, uint8_t channe
         return;
     }
 
-    glCreateTextures(GL_TEXTURE_2D, 1, &m_rendererID);
-    glTextureStorage2D(m_rendererID, 1, m_internalFormat, m_width, m_height);
+    RenderThread::Execute([&]() {
+        glCreateTextures(GL_TEXTURE_2D, 1, &m_rendererID);
+        glTextureStorage2D(m_rendererID, 1, m_internalFormat, m_width, m_height);
 
-    glTextureParameteri(m_rendererID, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTextureParameteri(m_rendererID, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTextureParameteri(m_rendererID, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTextureParameteri(m_rendererID, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
 
-    glTextureParameteri(m_rendererID, GL_TEXTURE_WRAP_S, GL_REPEAT);
-    glTextureParameteri(m_rendererID, GL_TEXTURE_WRAP_T, GL_REPEAT);
+        glTextureParameteri(m_rendererID, GL_TEXTURE_WRAP_S, GL_REPEAT);
+        glTextureParameteri(m_rendererID, GL_TEXTURE_WRAP_T, GL_REPEAT);
+    });
 }
 
 
@@ -83,17 +87,19 @@ OpenGLTexture2D::OpenGLTexture2D(const std::string& path) : m_path(path)
 
     BR_CORE_ASSERT(internalFormat && dataFormat, "Format not supported");
 
-    glCreateTextures(GL_TEXTURE_2D, 1, &m_rendererID);
-    glTextureStorage2D(m_rendererID, 1, internalFormat, m_width, m_height);
+    RenderThread::Execute([&]() {
+        glCreateTextures(GL_TEXTURE_2D, 1, &m_rendererID);
+        glTextureStorage2D(m_rendererID, 1, internalFormat, m_width, m_height);
 
-    glTextureParameteri(m_rendererID, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTextureParameteri(m_rendererID, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTextureParameteri(m_rendererID, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTextureParameteri(m_rendererID, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
 
-    glTextureParameteri(m_rendererID, GL_TEXTURE_WRAP_S, GL_REPEAT);
-    glTextureParameteri(m_rendererID, GL_TEXTURE_WRAP_T, GL_REPEAT);
+        glTextureParameteri(m_rendererID, GL_TEXTURE_WRAP_S, GL_REPEAT);
+        glTextureParameteri(m_rendererID, GL_TEXTURE_WRAP_T, GL_REPEAT);
 
-    glTextureSubImage2D(
-      m_rendererID, 0, 0, 0, m_width, m_height, dataFormat, GL_UNSIGNED_BYTE, data);
+        glTextureSubImage2D(
+          m_rendererID, 0, 0, 0, m_width, m_height, dataFormat, GL_UNSIGNED_BYTE, data);
+    });
 
     stbi_image_free(data);
 }
@@ -103,7 +109,7 @@ OpenGLTexture2D::~OpenGLTexture2D()
 {
     BR_PROFILE_FUNCTION();
 
-    glDeleteTextures(1, &m_rendererID);
+    RenderThread::Submit([id = m_rendererID]() { glDeleteTextures(1, &id); });
 }
 
 void OpenGLTexture2D::SetData(void* data, uint32_t size)
@@ -118,13 +124,23 @@ void OpenGLTexture2D::SetData(void* data, uint32_t size)
 
     if (m_dataFormat == GL_RGBA || m_dataFormat == GL_RGB)
     {
-        glTextureSubImage2D(
-          m_rendererID, 0, 0, 0, m_width, m_height, m_dataFormat, GL_UNSIGNED_BYTE, data);
+        RenderThread::Submit([id = m_rendererID,
+                              width = m_width,
+                              height = m_height,
+                              format = m_dataFormat,
+                              data = RenderThread::CopyData(data, size)]() {
+            glTextureSubImage2D(id, 0, 0, 0, width, height, format, GL_UNSIGNED_BYTE, data);
+        });
     }
     else if (m_dataFormat == GL_R)
     {
-        glTextureSubImage2D(
-          m_rendererID, 0, 0, 0, m_width, m_height, m_dataFormat, GL_UNSIGNED_BYTE, data);
+        RenderThread::Submit([id = m_rendererID,
+                              width = m_width,
+                              height = m_height,
+                              format = m_dataFormat,
+                              data = RenderThread::CopyData(data, size)]() {
+            glTextureSubImage2D(id, 0, 0, 0, width, height, format, GL_UNSIGNED_BYTE, data);
+        });
         // static const uint8_t d[] = {255};
         // glTexImage2D(GL_TEXTURE_2D, 0, GL_RED, m_width, m_height, 0, GL_RED, GL_UNSIGNED_BYTE,
         // d);
@@ -135,7 +151,7 @@ void OpenGLTexture2D::Bind(uint32_t slot) const
 {
     BR_PROFILE_FUNCTION();
 
-    glBindTextureUnit(slot, m_rendererID);
+    RenderThread::Submit([slot, id = m_rendererID]() { glBindTextureUnit(slot, id); });
 }
 
 
@@ -9,6 +9,8 @@
 #include "brpch.h"
 #include "OpenGLVertexArray.h"
 
+#include "Brigerad/Renderer/RenderThread.h"
+
 #include <glad/glad.h>
 
 namespace Brigerad
@@ -51,27 +53,27 @@ OpenGLVertexArray::OpenGLVertexArray()
 {
     BR_PROFILE_FUNCTION();
 
-    glCreateVertexArrays(1, &m_rendererId);
+    RenderThread::Execute([&]() { glCreateVertexArrays(1, &m_rendererId); });
 }
 
 OpenGLVertexArray::~OpenGLVertexArray()
 {
     BR_PROFILE_FUNCTION();
 
-    glDeleteVertexArrays(1, &m_rendererId);
+    RenderThread::Submit([id = m_rendererId]() { glDeleteVertexArrays(1, &id); });
 }
 
 void OpenGLVertexArray::Bind() const
 {
     BR_PROFILE_FUNCTION();
-    glBindVertexArray(m_rendererId);
+    RenderThread::Submit([id = m_rendererId]() { glBindVertexArray(id); });
 }
 
 
 void OpenGLVertexArray::Unbind() const
 {
     BR_PROFILE_FUNCTION();
-    glBindVertexArray(0);
+    RenderThread::Submit([]() { glBindVertexArray(0); });
 }
 
 
@@ -81,26 +83,28 @@ void OpenGLVertexArray::AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer)
 
     BR_CORE_ASSERT(vertexBuffer->GetLayout().GetElements().size(), "Vertex buffer has no layout");
 
-    glBindVertexArray(m_rendererId);
-    vertexBuffer->Bind();
-
-    uint32_t index = 0;
-    const auto& layout = vertexBuffer->GetLayout();
-    for (const auto& element : layout)
-    {
-        glEnableVertexAttribArray(index);
-// "'type cast': conversion from 'const uint32_t' to 'const void*' of greater
-// size." This is desired behavior.
-        #pragma warning(disable : 4312)
-        glVertexAttribPointer(index,
-                              element.GetComponentCount(),
-                              ShaderDataTypeToOpenGLBaseType(element.type),
-                              element.normalized ? GL_TRUE : GL_FALSE,
-                              layout.GetStride(),
-                              (const void*)element.offset);
-        #pragma warning(default : 4312)
-        index++;
-    }
+    RenderThread::Execute([&]() {
+        glBindVertexArray(m_rendererId);
+        vertexBuffer->Bind();
+
+        const auto& layout = vertexBuffer->GetLayout();
+        for (const auto& element : layout)
+        {
+            uint32_t index = m_attributeIndex++;
+            glEnableVertexAttribArray(index);
+    // "'type cast': conversion from 'const uint32_t' to 'const void*' of greater
+    // size." This is desired behavior.
+            #pragma warning(disable : 4312)
+            glVertexAttribPointer(index,
+                                  element.GetComponentCount(),
+                                  ShaderDataTypeToOpenGLBaseType(element.type),
+                                  element.normalized ? GL_TRUE : GL_FALSE,
+                                  layout.GetStride(),
+                                  (const void*)element.offset);
+            #pragma warning(default : 4312)
+            glVertexAttribDivisor(index, layout.IsPerInstance() ? 1 : 0);
+        }
+    });
 
     m_vertexBuffers.emplace_back(vertexBuffer);
 }
@@ -108,8 +112,10 @@ void OpenGLVertexArray::AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer)
 
 void OpenGLVertexArray::SetIndexBuffer(const Ref<IndexBuffer>& indexBuffer)
 {
-    glBindVertexArray(m_rendererId);
-    indexBuffer->Bind();
+    RenderThread::Execute([&]() {
+        glBindVertexArray(m_rendererId);
+        indexBuffer->Bind();
+    });
 
     m_indexBuffer = indexBuffer;
 }
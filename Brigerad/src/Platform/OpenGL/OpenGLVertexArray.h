@@ -22,6 +22,8 @@ public:
 private:
     std::vector<Ref<VertexBuffer>> m_vertexBuffers;
     Ref<IndexBuffer> m_indexBuffer;
+    // Index of the next attribute, the attributes of every vertex buffer follow each other.
+    uint32_t m_attributeIndex = 0;
 
     uint32_t m_rendererId;
 };
@@ -15,43 +15,47 @@
 namespace Brigerad
 {
 
-bool Input::IsKeyPressed(KeyCode keycode)
+void Input::Poll(InputSnapshot& snapshot)
 {
     auto window = static_cast<GLFWwindow*>(Application::Get().GetWindow().GetNativeWindow());
-    auto state  = glfwGetKey(window, int(keycode));
 
-    return (state == GLFW_PRESS || state == GLFW_REPEAT);
-}
-
-bool Input::IsMouseButtonPressed(MouseCode button)
-{
-    auto window = static_cast<GLFWwindow*>(Application::Get().GetWindow().GetNativeWindow());
-    auto state  = glfwGetMouseButton(window, int(button));
+    for (size_t key = size_t(KeyCode::Space); key < InputSnapshot::s_keyCount; key++)
+    {
+        auto state            = glfwGetKey(window, int(key));
+        snapshot.buttons[key] = (state == GLFW_PRESS || state == GLFW_REPEAT);
+    }
 
-    return state == GLFW_PRESS;
-}
+    for (size_t button = 0; button < InputSnapshot::s_mouseButtonCount; button++)
+    {
+        snapshot.buttons[InputSnapshot::s_firstMouseButton + button] =
+          glfwGetMouseButton(window, int(button)) == GLFW_PRESS;
+    }
 
-std::pair<float, float> Input::GetMousePos()
-{
-    auto   window = static_cast<GLFWwindow*>(Application::Get().GetWindow().GetNativeWindow());
     double xPos, yPos;
     glfwGetCursorPos(window, &xPos, &yPos);
-
-    return {(float)xPos, (float)yPos};
-}
-
-float Input::GetMouseX()
-{
-    auto [x, y] = GetMousePos();
-
-    return x;
-}
-
-float Input::GetMouseY()
-{
-    auto [x, y] = GetMousePos();
-
-    return y;
+    snapshot.mouseX = (float)xPos;
+    snapshot.mouseY = (float)yPos;
+
+    // The first joystick with a gamepad mapping.
+    GLFWgamepadstate gamepad;
+    for (int jid = GLFW_JOYSTICK_1; jid <= GLFW_JOYSTICK_LAST && !snapshot.hasGamepad; jid++)
+    {
+        snapshot.hasGamepad = glfwGetGamepadState(jid, &gamepad) == GLFW_TRUE;
+    }
+    if (!snapshot.hasGamepad)
+    {
+        return;
+    }
+
+    for (size_t button = 0; button < InputSnapshot::s_gamepadButtonCount; button++)
+    {
+        snapshot.buttons[InputSnapshot::s_firstGamepadButton + button] =
+          gamepad.buttons[button] == GLFW_PRESS;
+    }
+    for (size_t axis = 0; axis < InputSnapshot::s_gamepadAxisCount; axis++)
+    {
+        snapshot.gamepadAxes[axis] = gamepad.axes[axis];
+    }
 }
 
 }    // namespace Brigerad
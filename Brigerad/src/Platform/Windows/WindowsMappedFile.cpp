@@ -0,0 +1,152 @@
+/**
+ * @file   WindowsMappedFile.cpp
+ * @author Samuel Martel
+ * @date   2026/10/19
+ *
+ * @brief  Source for the MappedFile module.
+ */
+#include "brpch.h"
+#include "Brigerad/Utils/MappedFile.h"
+
+#if defined(BR_PLATFORM_WINDOWS)
+
+namespace Brigerad
+{
+bool MappedFile::Open(const std::string& path, Mode mode, size_t size)
+{
+    Close();
+
+    DWORD  access = mode == Mode::Read ? GENERIC_READ : (GENERIC_READ | GENERIC_WRITE);
+    DWORD  create = mode == Mode::Read ? OPEN_EXISTING : OPEN_ALWAYS;
+    HANDLE file   = CreateFileA(path.c_str(),
+                              access,
+                              FILE_SHARE_READ,
+                              nullptr,
+                              create,
+                              FILE_ATTRIBUTE_NORMAL,
+                              nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        BR_CORE_ERROR("[MappedFile] Unable to open '{}': error {}", path, GetLastError());
+        return false;
+    }
+
+    m_path = path;
+    m_mode = mode;
+    m_file = (intptr_t)file;
+
+    if (size == 0)
+    {
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize))
+        {
+            BR_CORE_ERROR("[MappedFile] Unable to get the size of '{}'", path);
+            Close();
+            return false;
+        }
+        size = (size_t)fileSize.QuadPart;
+    }
+
+    // In ReadWrite mode, CreateFileMapping grows the file to the size of the mapping.
+    m_size = size;
+    if (!Map())
+    {
+        Close();
+        return false;
+    }
+    return true;
+}
+
+bool MappedFile::Resize(size_t size)
+{
+    BR_CORE_ASSERT(m_mode == Mode::ReadWrite, "Can't resize a read-only mapping!");
+    if (m_file == -1 || m_mode != Mode::ReadWrite)
+    {
+        return false;
+    }
+
+    Unmap();
+
+    // Mappings can only grow a file, shrinking it has to be done by hand.
+    LARGE_INTEGER newSize;
+    newSize.QuadPart = (LONGLONG)size;
+    if (!SetFilePointerEx((HANDLE)m_file, newSize, nullptr, FILE_BEGIN) ||
+        !SetEndOfFile((HANDLE)m_file))
+    {
+        BR_CORE_ERROR("[MappedFile] Unable to resize '{}': error {}", m_path, GetLastError());
+        return false;
+    }
+
+    m_size = size;
+    return Map();
+}
+
+void MappedFile::Flush()
+{
+    if (m_data != nullptr && m_mode == Mode::ReadWrite)
+    {
+        FlushViewOfFile(m_data, 0);
+    }
+}
+
+void MappedFile::Close()
+{
+    Unmap();
+    if (m_file != -1)
+    {
+        CloseHandle((HANDLE)m_file);
+        m_file = -1;
+    }
+    m_size = 0;
+}
+
+bool MappedFile::Map()
+{
+    if (m_size == 0)
+    {
+        // Windows refuses empty mappings, an empty file is still a valid file.
+        return true;
+    }
+
+    DWORD  protect = m_mode == Mode::Read ? PAGE_READONLY : PAGE_READWRITE;
+    HANDLE mapping = CreateFileMappingA((HANDLE)m_file,
+                                        nullptr,
+                                        protect,
+                                        (DWORD)((uint64_t)m_size >> 32),
+                                        (DWORD)(m_size & 0xFFFFFFFF),
+                                        nullptr);
+    if (mapping == nullptr)
+    {
+        BR_CORE_ERROR("[MappedFile] Unable to map '{}': error {}", m_path, GetLastError());
+        return false;
+    }
+
+    DWORD access = m_mode == Mode::Read ? FILE_MAP_READ : FILE_MAP_WRITE;
+    void* data   = MapViewOfFile(mapping, access, 0, 0, m_size);
+    if (data == nullptr)
+    {
+        BR_CORE_ERROR("[MappedFile] Unable to map '{}': error {}", m_path, GetLastError());
+        CloseHandle(mapping);
+        return false;
+    }
+
+    m_mapping = (intptr_t)mapping;
+    m_data    = static_cast<uint8_t*>(data);
+    return true;
+}
+
+void MappedFile::Unmap()
+{
+    if (m_data != nullptr)
+    {
+        UnmapViewOfFile(m_data);
+        m_data = nullptr;
+    }
+    if (m_mapping != 0)
+    {
+        CloseHandle((HANDLE)m_mapping);
+        m_mapping = 0;
+    }
+}
+}    // namespace Brigerad
+#endif
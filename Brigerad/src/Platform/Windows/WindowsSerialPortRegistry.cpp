@@ -0,0 +1,95 @@
+/**
+ * @file   WindowsSerialPortRegistry.cpp
+ * @author Samuel Martel
+ * @date   2026/10/19
+ *
+ * @brief  Source for the SerialPortRegistry module.
+ */
+#include "brpch.h"
+#include "Brigerad/Utils/SerialPortRegistry.h"
+
+#if defined(BR_PLATFORM_WINDOWS)
+#include <thread>
+
+namespace Brigerad
+{
+// Without the SERIALCOMM key, fall back to enumerating every so often.
+static constexpr DWORD s_fallbackPeriodMs = 2000;
+
+static std::thread s_thread;
+static HANDLE      s_stopEvent = nullptr;
+
+void SerialPortRegistry::StartWatching()
+{
+    s_stopEvent = CreateEventA(nullptr, TRUE, FALSE, nullptr);
+    if (s_stopEvent == nullptr)
+    {
+        // The thread could never be stopped, settle for a single enumeration.
+        BR_CORE_ERROR("[SerialPortRegistry] Unable to create event: {}", GetLastError());
+        Refresh();
+        return;
+    }
+
+    s_thread = std::thread([]() {
+        Refresh();
+
+        // Every COM port of the system has a value in this key, Windows updates it as they come
+        // and go. It doesn't exist until the first port shows up.
+        HKEY   key         = nullptr;
+        HANDLE changeEvent = CreateEventA(nullptr, FALSE, FALSE, nullptr);
+
+        while (true)
+        {
+            if (key == nullptr && RegOpenKeyExA(HKEY_LOCAL_MACHINE,
+                                                "HARDWARE\\DEVICEMAP\\SERIALCOMM",
+                                                0,
+                                                KEY_NOTIFY | KEY_QUERY_VALUE,
+                                                &key) != ERROR_SUCCESS)
+            {
+                key = nullptr;
+            }
+
+            bool isNotified =
+              key != nullptr && changeEvent != nullptr &&
+              RegNotifyChangeKeyValue(
+                key, FALSE, REG_NOTIFY_CHANGE_LAST_SET, changeEvent, TRUE) == ERROR_SUCCESS;
+
+            HANDLE handles[2] = {s_stopEvent, changeEvent};
+            DWORD  ret        = WaitForMultipleObjects(isNotified ? 2 : 1,
+                                               handles,
+                                               FALSE,
+                                               isNotified ? INFINITE : s_fallbackPeriodMs);
+            if (ret == WAIT_OBJECT_0 || ret == WAIT_FAILED)
+            {
+                break;
+            }
+            Refresh();
+        }
+
+        if (key != nullptr)
+        {
+            RegCloseKey(key);
+        }
+        if (changeEvent != nullptr)
+        {
+            CloseHandle(changeEvent);
+        }
+    });
+}
+
+void SerialPortRegistry::StopWatching()
+{
+    if (s_thread.joinable())
+    {
+        SetEvent(s_stopEvent);
+        s_thread.join();
+    }
+
+    if (s_stopEvent != nullptr)
+    {
+        CloseHandle(s_stopEvent);
+        s_stopEvent = nullptr;
+    }
+}
+}    // namespace Brigerad
+#endif
@@ -2,11 +2,30 @@
 #if defined(BR_PLATFORM_WINDOWS)
 #include "GLFW/glfw3.h"
 
+#include <cstdint>
+#include <Windows.h>
+
 namespace Brigerad
 {
-double WindowsGetTime()
+inline double WindowsGetTime()
 {
     return glfwGetTime();
 }
+
+inline int64_t WindowsGetTimeNs()
+{
+    static const int64_t frequency = [] {
+        LARGE_INTEGER f;
+        QueryPerformanceFrequency(&f);
+        return (int64_t)f.QuadPart;
+    }();
+
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+    // Split the conversion to avoid overflowing after a few hours at 10 MHz.
+    int64_t seconds = counter.QuadPart / frequency;
+    int64_t rest    = counter.QuadPart % frequency;
+    return seconds * 1000000000 + (rest * 1000000000) / frequency;
+}
 } // namespace Brigerad
 #endif
@@ -8,6 +8,7 @@
 #include "Brigerad/Events/KeyEvents.h"
 
 #include "Brigerad/Renderer/Renderer.h"
+#include "Brigerad/Renderer/RenderThread.h"
 
 #include "Platform/OpenGL/OpenGLContext.h"
 
@@ -186,14 +187,29 @@ void WindowsWindow::OnUpdate()
     m_context->SwapBuffers();
 }
 
+void WindowsWindow::WaitEvents(double timeout)
+{
+    BR_PROFILE_FUNCTION();
+
+    glfwWaitEventsTimeout(timeout);
+}
+
+void WindowsWindow::Wake()
+{
+    glfwPostEmptyEvent();
+}
+
 void WindowsWindow::SetVSync(bool enabled)
 {
     BR_PROFILE_FUNCTION();
 
-    if (enabled)
-        glfwSwapInterval(1);
-    else
-        glfwSwapInterval(0);
+    // The swap interval applies to the context current on the calling thread.
+    RenderThread::Submit([enabled]() {
+        if (enabled)
+            glfwSwapInterval(1);
+        else
+            glfwSwapInterval(0);
+    });
 
     m_data.vsync = enabled;
 }
@@ -17,6 +17,9 @@ public:
 
     void OnUpdate() override;
 
+    void WaitEvents(double timeout) override;
+    void Wake() override;
+
     inline unsigned int GetWidth() const override
     {
         return m_data.width;
@@ -40,6 +43,11 @@ public:
         return reinterpret_cast<void *>(m_window);
     }
 
+    inline GraphicsContext &GetContext() override
+    {
+        return *m_context;
+    }
+
 private:
     virtual void Init(const WindowProps &props);
     virtual void Shutdown();
@@ -0,0 +1,121 @@
+-- Microbenchmarks of the glm bindings.
+-- Run with ScriptEngine::ExecuteScript, prints the time and the memory allocated per operation.
+
+local iterations = 1000000
+local batchSize = 1000
+
+local function Round(x)
+    return math.floor(x * 10 + 0.5) / 10
+end
+
+-- Run body(n) for n operations, with the garbage collector stopped to count what they allocate.
+local function Run(name, body)
+    local ok, err = pcall(body, batchSize)
+    if not ok then
+        print(name .. ": skipped (" .. tostring(err) .. ")")
+        return
+    end
+
+    collectgarbage("collect")
+    collectgarbage("stop")
+    local memoryBefore = collectgarbage("count")
+    local start = Clock.Now()
+    body(iterations)
+    local elapsed = Clock.Now() - start
+    local allocated = (collectgarbage("count") - memoryBefore) * 1024
+    collectgarbage("restart")
+
+    print(name .. ": " .. Round(elapsed * 1e9 / iterations) .. " ns/op, " ..
+          Round(allocated / iterations) .. " B/op")
+end
+
+local function MakeList(count)
+    local list = {}
+    for i = 1, count do
+        list[i] = vec2.new(i, i)
+    end
+    return list
+end
+
+local a = vec2.new(1, 2)
+local b = vec2.new(3, 4)
+local c = vec3.new(1, 2, 3)
+local d = vec3.new(4, 5, 6)
+
+print("---- vec2 ----")
+Run("a + b", function(n)
+    for _ = 1, n do
+        local r = a + b
+    end
+end)
+Run("a * 2", function(n)
+    for _ = 1, n do
+        local r = a * 2
+    end
+end)
+Run("2 / a", function(n)
+    for _ = 1, n do
+        local r = 2 / a
+    end
+end)
+Run("a.x = a.x + b.x", function(n)
+    for _ = 1, n do
+        a.x = a.x + b.x
+    end
+end)
+Run("a:addInPlace(b)", function(n)
+    for _ = 1, n do
+        a:addInPlace(b)
+    end
+end)
+Run("a:mulInPlace(2)", function(n)
+    for _ = 1, n do
+        a:mulInPlace(2)
+    end
+end)
+Run("a:set(1, 2)", function(n)
+    for _ = 1, n do
+        a:set(1, 2)
+    end
+end)
+
+print("---- vec3 ----")
+Run("c + d", function(n)
+    for _ = 1, n do
+        local r = c + d
+    end
+end)
+Run("c:addInPlace(d)", function(n)
+    for _ = 1, n do
+        c:addInPlace(d)
+    end
+end)
+
+-- Per vector of the batch, comparable with the loops above.
+print("---- batches of " .. batchSize .. " vec2 ----")
+local positions = MakeList(batchSize)
+local velocities = MakeList(batchSize)
+Run("p = p + v * dt", function(n)
+    for _ = 1, n // batchSize do
+        for i = 1, batchSize do
+            positions[i] = positions[i] + velocities[i] * 0.016
+        end
+    end
+end)
+Run("p:addInPlace(v * dt)", function(n)
+    for _ = 1, n // batchSize do
+        for i = 1, batchSize do
+            positions[i]:addInPlace(velocities[i] * 0.016)
+        end
+    end
+end)
+Run("vec2.addScaledAll(p, v, dt)", function(n)
+    for _ = 1, n // batchSize do
+        vec2.addScaledAll(positions, velocities, 0.016)
+    end
+end)
+Run("vec2.addAll(p, b)", function(n)
+    for _ = 1, n // batchSize do
+        vec2.addAll(positions, b)
+    end
+end)
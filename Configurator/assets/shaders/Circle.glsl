@@ -0,0 +1,53 @@
+// Circles and rings, cut out of a quad by their distance field.
+
+#type vertex
+#version 330 core
+
+layout(location = 0) in vec3 a_Position;
+layout(location = 1) in vec2 a_Local;
+layout(location = 2) in vec4 a_Color;
+layout(location = 3) in float a_Thickness;
+layout(location = 4) in float a_Fade;
+
+uniform mat4 u_ViewProjection;
+
+out vec2 v_Local;
+out vec4 v_Color;
+out float v_Thickness;
+out float v_Fade;
+
+void main()
+{
+    v_Local = a_Local;
+    v_Color = a_Color;
+    v_Thickness = a_Thickness;
+    v_Fade = a_Fade;
+    gl_Position = u_ViewProjection * vec4(a_Position, 1.0);
+}
+
+
+#type fragment
+#version 330 core
+
+layout(location = 0) out vec4 color;
+
+in vec2 v_Local;
+in vec4 v_Color;
+in float v_Thickness;
+in float v_Fade;
+
+void main()
+{
+    // 0 on the edge of the circle, 1 at its center.
+    float distance = 1.0 - length(v_Local);
+    // smoothstep is undefined unless edge0 < edge1.
+    float fade = max(v_Fade, 1e-5);
+    float alpha = smoothstep(0.0, fade, distance);
+    alpha *= 1.0 - smoothstep(v_Thickness, v_Thickness + fade, distance);
+    if(alpha == 0.0)
+    {
+        discard;
+    }
+
+    color = vec4(v_Color.rgb, v_Color.a * alpha);
+}
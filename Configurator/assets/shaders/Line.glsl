@@ -0,0 +1,50 @@
+// Lines of constant width on screen, one quad per segment.
+
+#type vertex
+#version 330 core
+
+layout(location = 0) in vec3 a_Start;
+layout(location = 1) in vec3 a_End;
+layout(location = 2) in vec4 a_Color;
+// (0 at the start or 1 at the end, -1 or 1 across the segment).
+layout(location = 3) in vec2 a_Corner;
+layout(location = 4) in float a_Width;
+
+uniform mat4 u_ViewProjection;
+uniform vec2 u_ViewportSize;
+
+out vec4 v_Color;
+
+void main()
+{
+    vec4 start = u_ViewProjection * vec4(a_Start, 1.0);
+    vec4 end = u_ViewProjection * vec4(a_End, 1.0);
+
+    // Direction of the segment on screen, in pixels.
+    vec2 halfViewport = u_ViewportSize * 0.5;
+    vec2 direction = (end.xy / end.w - start.xy / start.w) * halfViewport;
+    direction = length(direction) > 0.0 ? normalize(direction) : vec2(1.0, 0.0);
+    vec2 normal = vec2(-direction.y, direction.x);
+
+    // Stretched by half the width past both ends, which fills the joints of the polylines.
+    vec2 offset = (direction * (a_Corner.x * 2.0 - 1.0) + normal * a_Corner.y) * a_Width * 0.5;
+
+    vec4 position = mix(start, end, a_Corner.x);
+    position.xy += offset / halfViewport * position.w;
+
+    v_Color = a_Color;
+    gl_Position = position;
+}
+
+
+#type fragment
+#version 330 core
+
+layout(location = 0) out vec4 color;
+
+in vec4 v_Color;
+
+void main()
+{
+    color = v_Color;
+}
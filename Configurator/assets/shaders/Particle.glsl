@@ -0,0 +1,45 @@
+// Instanced particles, one quad per particle.
+
+#type vertex
+#version 330 core
+
+layout(location = 0) in vec2 a_Corner;
+layout(location = 1) in float i_PositionX;
+layout(location = 2) in float i_PositionY;
+layout(location = 3) in float i_Rotation;
+layout(location = 4) in float i_Age;
+
+uniform mat4 u_ViewProjection;
+uniform vec4 u_ColorBegin;
+uniform vec4 u_ColorEnd;
+uniform vec2 u_Size;     // At the start and at the end of the life of the particles.
+uniform float u_Depth;
+
+out vec4 v_Color;
+
+void main()
+{
+    float t = clamp(i_Age, 0.0, 1.0);
+    // Dead particles, only found in the GPU pools, collapse to nothing.
+    float size = mix(u_Size.x, u_Size.y, t) * (1.0 - step(1.0, i_Age));
+
+    float c = cos(i_Rotation);
+    float s = sin(i_Rotation);
+    vec2 corner = mat2(c, s, -s, c) * (a_Corner * size);
+
+    v_Color = mix(u_ColorBegin, u_ColorEnd, t);
+    gl_Position = u_ViewProjection * vec4(i_PositionX + corner.x, i_PositionY + corner.y, u_Depth, 1.0);
+}
+
+
+#type fragment
+#version 330 core
+
+layout(location = 0) out vec4 color;
+
+in vec4 v_Color;
+
+void main()
+{
+    color = v_Color;
+}
@@ -0,0 +1,47 @@
+// Moves the particles of a GpuParticlePool forward in time.
+
+#type compute
+#version 430 core
+
+layout(local_size_x = 256) in;
+
+// Position, rotation and age, also the instance data of Particle.glsl.
+layout(std430, binding = 0) buffer States
+{
+    vec4 states[];
+};
+
+// Velocity, angular velocity and 1 / lifetime.
+layout(std430, binding = 1) buffer Motions
+{
+    vec4 motions[];
+};
+
+uniform float u_DeltaTime;
+uniform vec2 u_Gravity;
+uniform int u_Count;
+
+void main()
+{
+    int i = int(gl_GlobalInvocationID.x);
+    if(i >= u_Count)
+    {
+        return;
+    }
+
+    vec4 state = states[i];
+    if(state.w >= 1.0)
+    {
+        // Dead, waiting for a new particle to take the slot.
+        return;
+    }
+
+    vec4 motion = motions[i];
+    motion.xy += u_Gravity * u_DeltaTime;
+    state.xy += motion.xy * u_DeltaTime;
+    state.z += motion.z * u_DeltaTime;
+    state.w += motion.w * u_DeltaTime;
+
+    states[i] = state;
+    motions[i] = motion;
+}
@@ -9,8 +9,13 @@ layout(location = 2) in vec2 a_TexCoord;
 layout(location = 3) in vec2 a_TilingFactor;
 layout(location = 4) in float a_TexIndex;
 layout(location = 5) in float a_IsText;
+// Start time, frame duration, frame count, distance between the frames.
+layout(location = 6) in vec4 a_Animation;
 
 uniform mat4 u_ViewProjection;
+// Seconds since the renderer started, the clock of a_Animation. Wraps every u_TimePeriod.
+uniform float u_Time;
+uniform float u_TimePeriod;
 
 out vec4 v_Color;
 out vec2 v_TexCoord;
@@ -22,6 +27,13 @@ void main()
 {
     v_Color = a_Color;
     v_TexCoord = a_TexCoord;
+    if(a_Animation.z > 1.0)
+    {
+        // Walk through the frames of a looping animation, laid side by side in the texture.
+        float elapsed = mod(u_Time - a_Animation.x, u_TimePeriod);
+        float frame = mod(floor(elapsed / a_Animation.y), a_Animation.z);
+        v_TexCoord.x += frame * a_Animation.w;
+    }
     v_TilingFactor = a_TilingFactor;
     v_TexIndex = a_TexIndex;
     v_IsText = a_IsText;
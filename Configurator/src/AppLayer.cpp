@@ -24,18 +24,31 @@ void AppLayer::OnAttach()
     m_background = m_scene->CreateEntity("bg");
     m_background.AddComponent<TextureRendererComponent>("assets/textures/background.png");
     m_background.GetComponentRef<TransformComponent>().scale = glm::vec3 {7.5f, 7.5f, 1.0f};
+    m_background.AddComponent<StaticComponent>();
 
     m_camera = m_scene->CreateEntity("cam");
     m_camera.AddComponent<CameraComponent>();
+
+    Input::LoadActions("assets/input/Actions.yaml");
+    m_newFileAction  = Input::GetAction("NewFile");
+    m_saveFileAction = Input::GetAction("SaveFile");
+    m_openFileAction = Input::GetAction("OpenFile");
 }
 
 
 void AppLayer::OnDetach()
 {
+    m_telemetry.Close();
     Brigerad::Renderer2D::Shutdown();
 }
 
 
+void AppLayer::OnFixedUpdate(Brigerad::Timestep ts)
+{
+    m_scene->OnFixedUpdate(ts);
+}
+
+
 void AppLayer::OnUpdate(Brigerad::Timestep ts)
 {
     BR_PROFILE_FUNCTION();
@@ -51,33 +64,39 @@ void AppLayer::OnUpdate(Brigerad::Timestep ts)
         m_scene->OnViewportResize((uint32_t)m_viewportSize.x, (uint32_t)m_viewportSize.y);
     }
 
-    // Render.
-    Renderer2D::ResetStats();
-    m_fb->Bind();
-    RenderCommand::SetClearColor({0.2f, 0.2f, 0.2f, 1.0f});
-    RenderCommand::Clear();
+    // Render, only when the scene changed: the framebuffer keeps the last image otherwise.
+    if (m_scene->IsDirty())
+    {
+        Renderer2D::ResetStats();
+        m_fb->Bind();
+        RenderCommand::SetClearColor({0.2f, 0.2f, 0.2f, 1.0f});
+        RenderCommand::Clear();
 
-    // Update scene.
-    m_scene->OnUpdate(ts);
+        // Update scene.
+        m_scene->OnUpdate(ts);
 
-    m_fb->Unbind();
+        m_fb->Unbind();
 
-    // Handle keybinds.
-    if (Input::IsKeyPressed(KeyCode::LeftControl))
-    {
-        if (Input::IsKeyPressed(KeyCode::N))
-        {
-            NewFile();
-        }
-        if (Input::IsKeyPressed(KeyCode::S))
-        {
-            SaveFile();
-        }
-        if (Input::IsKeyPressed(KeyCode::O))
+        // Animations, particles and scripts move on their own, in on-demand mode too.
+        if (m_scene->IsDirty())
         {
-            OpenFile();
+            Application::Get().RequestRedraw();
         }
     }
+
+    // Handle keybinds, once per press.
+    if (Input::IsActionJustPressed(m_newFileAction))
+    {
+        NewFile();
+    }
+    if (Input::IsActionJustPressed(m_saveFileAction))
+    {
+        SaveFile();
+    }
+    if (Input::IsActionJustPressed(m_openFileAction))
+    {
+        OpenFile();
+    }
 }
 
 
@@ -136,6 +155,11 @@ void AppLayer::OnImGuiRender()
             {
                 SaveFile();
             }
+            // For units whose firmware only reads the legacy layout.
+            if (ImGui::MenuItem("Sauvegarder (ancien format)"))
+            {
+                SaveFile(CF_Legacy);
+            }
 
             ImGui::Separator();
 
@@ -145,17 +169,27 @@ void AppLayer::OnImGuiRender()
             }
             ImGui::EndMenu();
         }
+        if (ImGui::BeginMenu("Affichage"))
+        {
+            ImGui::MenuItem("Telemetrie", nullptr, &m_telemetry.IsVisible());
+            ImGui::MenuItem("Profileur Lua", nullptr, &m_scriptProfiler.IsVisible());
+            ImGui::EndMenu();
+        }
         ImGui::EndMenuBar();
     }
 
     HandleConfigRendering();
 
     ImGui::End();
+
+    m_telemetry.OnImGuiRender();
+    m_scriptProfiler.OnImGuiRender();
 }
 
 
 void AppLayer::OnEvent(Brigerad::Event& e)
 {
+    m_telemetry.OnEvent(e);
     m_scene->OnEvent(e);
 }
 
@@ -213,7 +247,7 @@ void AppLayer::OpenFile()
 }
 
 
-void AppLayer::SaveFile()
+void AppLayer::SaveFile(uint8_t format)
 {
     std::string path = File::OpenFile(FileTypes::Ini, FileMode::Save);
 
@@ -222,11 +256,21 @@ void AppLayer::SaveFile()
         // Path is empty, user did not pick a file.
         return;
     }
+
+    // Serialize the configuration before opening the file, not to overwrite it if that fails.
+    uint8_t* data = nullptr;
+    size_t   len  = m_config.Serialize(&data, format);
+    if (len == 0)
+    {
+        return;
+    }
+
     std::ofstream file = std::ofstream(path, std::ios::binary);
     if (file.is_open() == false)
     {
         // Unable to open file.
         BR_ERROR("Unable to open '{}'.", path.c_str());
+        delete[] data;
         return;
     }
 
@@ -235,10 +279,6 @@ void AppLayer::SaveFile()
     m_isNew   = false;
     m_isSaved = true;
 
-    // Serialize the configuration.
-    uint8_t* data = nullptr;
-    size_t   len  = m_config.Serialize(&data);
-
     file.write(reinterpret_cast<char*>(data), len);
 
     file.close();
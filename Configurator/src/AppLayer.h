@@ -19,6 +19,8 @@
 #include "Brigerad/Renderer/Texture.h"
 
 #include "Config.h"
+#include "ScriptProfilerPanel.h"
+#include "TelemetryPanel.h"
 
 #include <string>
 
@@ -42,6 +44,7 @@ public:
     virtual void OnAttach() override;
     virtual void OnDetach() override;
 
+    virtual void OnFixedUpdate(Brigerad::Timestep ts) override;
     virtual void OnUpdate(Brigerad::Timestep ts) override;
     virtual void OnImGuiRender() override;
     virtual void OnEvent(Brigerad::Event& e) override;
@@ -49,7 +52,7 @@ public:
 private:
     void NewFile();
     void OpenFile();
-    void SaveFile();
+    void SaveFile(uint8_t format = CF_Tlv);
     void HandleConfigRendering();
     void HandleSensorTypeSelect(const std::string& label, uint8_t& sensor);
     void HandleLineConfig(const std::string& label, uint8_t& line);
@@ -60,12 +63,19 @@ private:
     bool        m_isSaved = false;
     std::string m_path    = "";
 
+    TelemetryPanel      m_telemetry;
+    ScriptProfilerPanel m_scriptProfiler;
+
     Ref<Scene>       m_scene;
     Entity           m_background;
     Entity           m_camera;
     Ref<Framebuffer> m_fb;
 
     glm::vec2 m_viewportSize = glm::vec2 {0.0f};
+
+    Input::ActionId m_newFileAction  = Input::s_invalidAction;
+    Input::ActionId m_saveFileAction = Input::s_invalidAction;
+    Input::ActionId m_openFileAction = Input::s_invalidAction;
 };
 
 /*****************************************************************************/
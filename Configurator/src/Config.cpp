@@ -4,158 +4,469 @@
 
 #include <cstring>
 
-#define INC_PTR(var)                                                                               \
-    do                                                                                             \
-    {                                                                                              \
-        BR_ASSERT((dataPtr + sizeof((var)) < endPtr), "Not enough data!");                         \
-        dataPtr += sizeof((var));                                                                  \
-    } while (0)
+/**
+ * Decodes the value of a record into its field.
+ * The length of the value is guaranteed to be at least the minimum length of the field.
+ */
+using FieldDecoder = void (*)(Config& config, const uint8_t* value, uint8_t len);
 
-Config::Config(const uint8_t* data, size_t len)
+struct FieldDescriptor
 {
-    BR_ASSERT(data != nullptr, "Pointer is null!");
-    BR_ASSERT(len >= 0, "Len is zero");
-
-    const uint8_t* dataPtr = reinterpret_cast<const uint8_t*>(data);
-    const uint8_t* endPtr  = reinterpret_cast<const uint8_t*>(data) + len;
-
-    sn = (dataPtr[0] << 24) | (dataPtr[1] << 16) | (dataPtr[2] << 8) | (dataPtr[3]);
-    INC_PTR(sn);
-
-    btName = std::string((const char*)dataPtr);
-    dataPtr += btName.size() + 1;    // std::string::size doesn't include the null-terminator.
-    BR_ASSERT(dataPtr < endPtr, "Not enough data!");
-
-    truckType = *dataPtr;
-    INC_PTR(truckType);
-
-    lastCalibDate = std::string((const char*)dataPtr);
-    dataPtr +=
-      lastCalibDate.size() + 1;    // std::string::size doesn't include the null-terminator.
-    BR_ASSERT(dataPtr < endPtr, "Not enough data!");
-
-    isLoraEn = *reinterpret_cast<const bool*>(dataPtr);
-    INC_PTR(isLoraEn);
-
-    isLogToFileEn = *reinterpret_cast<const bool*>(dataPtr);
-    INC_PTR(isLogToFileEn);
-
-    isDisplayEn = *reinterpret_cast<const bool*>(dataPtr);
-    INC_PTR(isDisplayEn);
+    uint8_t      minLen = 0;    // Smallest value a reader can make sense of.
+    FieldDecoder decode = nullptr;
+};
 
-    isIsaacEn = *reinterpret_cast<const bool*>(dataPtr);
-    INC_PTR(isIsaacEn);
-
-    isRelayOutEn = *reinterpret_cast<const bool*>(dataPtr);
-    INC_PTR(isRelayOutEn);
+static uint32_t ReadU32(const uint8_t* data)
+{
+    return ((uint32_t)data[0] << 24) | ((uint32_t)data[1] << 16) | ((uint32_t)data[2] << 8) |
+           ((uint32_t)data[3]);
+}
 
-    isDutyBoxEn = *reinterpret_cast<const bool*>(dataPtr);
-    INC_PTR(isDutyBoxEn);
+static uint8_t* WriteU32(uint8_t* data, uint32_t value)
+{
+    *data++ = (uint8_t)(value >> 24) & 0x000000FF;
+    *data++ = (uint8_t)(value >> 16) & 0x000000FF;
+    *data++ = (uint8_t)(value >> 8) & 0x000000FF;
+    *data++ = (uint8_t)value & 0x000000FF;
+    return data;
+}
 
-    dutyBoxSpeedLimit = *dataPtr;
-    INC_PTR(dutyBoxSpeedLimit);
+/**
+ * Number of chars of a string up to its first null-terminator.
+ * btName is allocated with 32 nulls, those must not be serialized.
+ */
+static size_t GetStringLen(const std::string& str, size_t maxLen)
+{
+    return std::min(strnlen(str.c_str(), str.size()), maxLen);
+}
 
-    sensor1Type = *dataPtr;
-    INC_PTR(sensor1Type);
+#define U8_FIELD(field)                                                                            \
+    FieldDescriptor                                                                                \
+    {                                                                                              \
+        1, [](Config& c, const uint8_t* v, uint8_t) { c.field = v[0]; }                            \
+    }
+#define BOOL_FIELD(field)                                                                          \
+    FieldDescriptor                                                                                \
+    {                                                                                              \
+        1, [](Config& c, const uint8_t* v, uint8_t) { c.field = v[0] != 0; }                       \
+    }
+#define STRING_FIELD(field)                                                                        \
+    FieldDescriptor                                                                                \
+    {                                                                                              \
+        0, [](Config& c, const uint8_t* v, uint8_t l) {                                            \
+            c.field.assign((const char*)v, strnlen((const char*)v, l));                            \
+        }                                                                                          \
+    }
 
-    sensor2Type = *dataPtr;
-    INC_PTR(sensor2Type);
+/**
+ * Decoders of every known tag, indexed by tag.
+ * Values longer than the minimum length are accepted so that a field can be widened by a future
+ * version without breaking this reader.
+ */
+static constexpr FieldDescriptor s_fields[CT_Count] = {
+  /* CT_Invalid */ FieldDescriptor {},
+  /* CT_SerialNumber */
+  FieldDescriptor {4, [](Config& c, const uint8_t* v, uint8_t) { c.sn = ReadU32(v); }},
+  STRING_FIELD(btName),
+  U8_FIELD(truckType),
+  STRING_FIELD(lastCalibDate),
+  BOOL_FIELD(isLoraEn),
+  BOOL_FIELD(isLogToFileEn),
+  BOOL_FIELD(isDisplayEn),
+  BOOL_FIELD(isIsaacEn),
+  BOOL_FIELD(isRelayOutEn),
+  BOOL_FIELD(isDutyBoxEn),
+  U8_FIELD(dutyBoxSpeedLimit),
+  U8_FIELD(sensor1Type),
+  U8_FIELD(sensor2Type),
+  U8_FIELD(sensor3Type),
+  U8_FIELD(sensor4Type),
+  U8_FIELD(lineA),
+  U8_FIELD(lineB),
+  U8_FIELD(lineC),
+  U8_FIELD(samplesToTake),
+  BOOL_FIELD(isTempSensorPresent),
+  U8_FIELD(unitType),
+  U8_FIELD(language),
+};
+
+#undef U8_FIELD
+#undef BOOL_FIELD
+#undef STRING_FIELD
+
+/**
+ * Size of the legacy configuration at the start of the data, 0 if the data is too short to hold
+ * one. The layout is fixed but for the two null-terminated strings.
+ */
+static size_t GetLegacyLen(const uint8_t* data, size_t len)
+{
+    // Every field but the serial number, the two strings and the truck type between them.
+    constexpr size_t trailingFields = CT_Count - 5;
 
-    sensor3Type = *dataPtr;
-    INC_PTR(sensor3Type);
+    auto findNull = [&](size_t from) {
+        const void* null = from < len ? memchr(data + from, '\0', len - from) : nullptr;
+        return null != nullptr ? size_t((const uint8_t*)null - data) : len;
+    };
 
-    sensor4Type = *dataPtr;
-    INC_PTR(sensor4Type);
+    size_t nameEnd = findNull(sizeof(uint32_t));
+    size_t dateEnd = nameEnd < len ? findNull(nameEnd + 2) : len;
+    if (dateEnd >= len || len - (dateEnd + 1) < trailingFields)
+    {
+        return 0;
+    }
+    return dateEnd + 1 + trailingFields;
+}
 
-    lineA = *dataPtr;
-    INC_PTR(lineA);
+/**
+ * True if the records of a versioned configuration exactly fill the payload its header announces.
+ */
+static bool IsWellFormedTlv(const uint8_t* data, size_t len)
+{
+    size_t payloadLen = ((size_t)data[6] << 8) | (size_t)data[7];
+    if (data[CONFIG_MAGIC_LEN] == 0 || data[CONFIG_MAGIC_LEN + 1] != 0 ||
+        payloadLen != len - CONFIG_HEADER_LEN)
+    {
+        return false;
+    }
 
-    lineB = *dataPtr;
-    INC_PTR(lineB);
+    size_t position = CONFIG_HEADER_LEN;
+    while (position + CONFIG_RECORD_HEADER_LEN <= len)
+    {
+        position += CONFIG_RECORD_HEADER_LEN + data[position + 1];
+    }
+    return position == len;
+}
 
-    lineC = *dataPtr;
-    INC_PTR(lineC);
+/**
+ * The magic alone doesn't tell the formats apart: it is also a valid legacy serial number.
+ * Data with the magic that isn't a well-formed versioned configuration but is exactly a legacy one
+ * is legacy. Anything else with the magic is decoded as versioned, reporting what is wrong.
+ */
+static bool IsVersioned(const uint8_t* data, size_t len)
+{
+    if (len < CONFIG_HEADER_LEN || memcmp(data, CONFIG_MAGIC, CONFIG_MAGIC_LEN) != 0)
+    {
+        return false;
+    }
+    if (IsWellFormedTlv(data, len))
+    {
+        return true;
+    }
+    if (GetLegacyLen(data, len) == len)
+    {
+        BR_TRACE("Configuration starts with the magic number but is a legacy configuration.");
+        return false;
+    }
+    return true;
+}
 
-    samplesToTake = *dataPtr;
-    INC_PTR(samplesToTake);
+/**
+ * Decodes a versioned configuration in a single pass over its records.
+ */
+static void DecodeTlv(Config& config, const uint8_t* data, size_t len)
+{
+    uint8_t version    = data[CONFIG_MAGIC_LEN];
+    size_t  payloadLen = ((size_t)data[6] << 8) | (size_t)data[7];
 
-    isTempSensorPresent = *reinterpret_cast<const bool*>(dataPtr);
-    INC_PTR(isTempSensorPresent);
+    if (version > CONFIG_FORMAT_VERSION)
+    {
+        BR_WARN("Configuration format v{} is newer than v{}, unknown fields will be ignored.",
+                version,
+                CONFIG_FORMAT_VERSION);
+    }
+    if (payloadLen > len - CONFIG_HEADER_LEN)
+    {
+        BR_ERROR("Configuration is truncated: header announces {} bytes, only {} are available.",
+                 payloadLen,
+                 len - CONFIG_HEADER_LEN);
+        payloadLen = len - CONFIG_HEADER_LEN;
+    }
 
-    unitType = *dataPtr;
-    INC_PTR(unitType);
+    const uint8_t* dataPtr  = data + CONFIG_HEADER_LEN;
+    const uint8_t* endPtr   = dataPtr + payloadLen;
+    size_t         records  = 0;
+    size_t         skipped  = 0;
+    size_t         tooShort = 0;
 
-    language = *dataPtr;
-    INC_PTR(language);
+    while (endPtr - dataPtr >= CONFIG_RECORD_HEADER_LEN)
+    {
+        uint8_t        tag   = dataPtr[0];
+        uint8_t        l     = dataPtr[1];
+        const uint8_t* value = dataPtr + CONFIG_RECORD_HEADER_LEN;
+        if (l > endPtr - value)
+        {
+            BR_ERROR("Record {} (tag {}) is truncated: {} bytes expected, {} available.",
+                     records,
+                     tag,
+                     l,
+                     endPtr - value);
+            break;
+        }
+
+        // Unknown tags fall back on the empty CT_Invalid descriptor.
+        const FieldDescriptor& field = s_fields[tag < CT_Count ? (size_t)tag : (size_t)CT_Invalid];
+        if (field.decode == nullptr)
+        {
+            skipped++;
+        }
+        else if (l < field.minLen)
+        {
+            tooShort++;
+        }
+        else
+        {
+            field.decode(config, value, l);
+        }
+
+        records++;
+        dataPtr = value + l;
+    }
 
-    BR_TRACE("Done loading data! {} bytes", endPtr - dataPtr);
+    if (tooShort != 0)
+    {
+        BR_WARN("{} records were too short to be decoded, default values were kept.", tooShort);
+    }
+    BR_TRACE("Done loading configuration v{}! {} records, {} unknown, {} bytes left.",
+             version,
+             records,
+             skipped,
+             endPtr - dataPtr);
 }
 
-
-size_t Config::Serialize(uint8_t** outData)
+/**
+ * Decodes a configuration written before the versioned format existed.
+ * Decoding stops at the first field that doesn't fit in the data, the remaining fields keep
+ * their default value.
+ */
+static void DecodeLegacy(Config& config, const uint8_t* data, size_t len)
 {
-    uint8_t* data = new uint8_t[GetSize()];
-    size_t   len  = 0;
+    const uint8_t* dataPtr = data;
+    const uint8_t* endPtr  = data + len;
+    const char*    missing = nullptr;
+
+    auto readU8 = [&](uint8_t& out, const char* name) {
+        if (missing == nullptr && dataPtr < endPtr)
+        {
+            out = *dataPtr++;
+        }
+        else if (missing == nullptr)
+        {
+            missing = name;
+        }
+    };
+    auto readBool = [&](bool& out, const char* name) {
+        uint8_t v = out;
+        readU8(v, name);
+        out = v != 0;
+    };
+    auto readString = [&](std::string& out, const char* name) {
+        const void* terminator =
+          missing == nullptr ? memchr(dataPtr, '\0', endPtr - dataPtr) : nullptr;
+        if (terminator != nullptr)
+        {
+            out.assign((const char*)dataPtr, (const uint8_t*)terminator - dataPtr);
+            dataPtr = (const uint8_t*)terminator + 1;
+        }
+        else if (missing == nullptr)
+        {
+            missing = name;
+        }
+    };
+
+    if (len >= sizeof(config.sn))
+    {
+        config.sn = ReadU32(dataPtr);
+        dataPtr += sizeof(config.sn);
+    }
+    else
+    {
+        missing = "sn";
+    }
+    readString(config.btName, "btName");
+    readU8(config.truckType, "truckType");
+    readString(config.lastCalibDate, "lastCalibDate");
+    readBool(config.isLoraEn, "isLoraEn");
+    readBool(config.isLogToFileEn, "isLogToFileEn");
+    readBool(config.isDisplayEn, "isDisplayEn");
+    readBool(config.isIsaacEn, "isIsaacEn");
+    readBool(config.isRelayOutEn, "isRelayOutEn");
+    readBool(config.isDutyBoxEn, "isDutyBoxEn");
+    readU8(config.dutyBoxSpeedLimit, "dutyBoxSpeedLimit");
+    readU8(config.sensor1Type, "sensor1Type");
+    readU8(config.sensor2Type, "sensor2Type");
+    readU8(config.sensor3Type, "sensor3Type");
+    readU8(config.sensor4Type, "sensor4Type");
+    readU8(config.lineA, "lineA");
+    readU8(config.lineB, "lineB");
+    readU8(config.lineC, "lineC");
+    readU8(config.samplesToTake, "samplesToTake");
+    readBool(config.isTempSensorPresent, "isTempSensorPresent");
+    readU8(config.unitType, "unitType");
+    readU8(config.language, "language");
+
+    if (missing != nullptr)
+    {
+        BR_ERROR("Legacy configuration is truncated: no data left for '{}'.", missing);
+    }
+    BR_TRACE("Done loading legacy configuration! {} bytes left.", endPtr - dataPtr);
+}
 
-    data[len++] = (uint8_t)(sn >> 24) & 0x000000FF;
-    data[len++] = (uint8_t)(sn >> 16) & 0x000000FF;
-    data[len++] = (uint8_t)(sn >> 8) & 0x000000FF;
-    data[len++] = (uint8_t)sn & 0x000000FF;
+Config::Config(const uint8_t* data, size_t len)
+{
+    if (data == nullptr || len == 0)
+    {
+        BR_ERROR("No configuration data to load!");
+        return;
+    }
 
-    for (const auto& c : btName)
+    if (IsVersioned(data, len))
+    {
+        DecodeTlv(*this, data, len);
+    }
+    else
     {
-        data[len++] = c;
+        DecodeLegacy(*this, data, len);
     }
-    // Add null-terminator.
-    data[len++] = '\0';
+}
 
-    data[len++] = truckType;
 
-    for (const auto& c : lastCalibDate)
+size_t Config::Serialize(uint8_t** outData, uint8_t format) const
+{
+    *outData = nullptr;
+    if (format != CF_Legacy)
     {
-        data[len++] = c;
+        // Cutting a string would silently save something else than what is shown.
+        for (const auto& [name, str] : {std::make_pair("btName", &btName),
+                                        std::make_pair("lastCalibDate", &lastCalibDate)})
+        {
+            size_t l = GetStringLen(*str, str->size());
+            if (l > CONFIG_MAX_VALUE_LEN)
+            {
+                BR_ERROR("'{}' is {} chars long, a configuration can only hold {}.",
+                         name,
+                         l,
+                         CONFIG_MAX_VALUE_LEN);
+                return 0;
+            }
+        }
     }
-    // Add null-terminator.
-    data[len++] = '\0';
-
-    data[len++] = isLoraEn;
-    data[len++] = isLogToFileEn;
-    data[len++] = isDisplayEn;
-    data[len++] = isIsaacEn;
-    data[len++] = isRelayOutEn;
-    data[len++] = isDutyBoxEn;
-    data[len++] = dutyBoxSpeedLimit;
 
-    data[len++] = sensor1Type;
-    data[len++] = sensor2Type;
-    data[len++] = sensor3Type;
-    data[len++] = sensor4Type;
+    uint8_t* data = new uint8_t[GetSize(format)];
+    uint8_t* ptr  = data;
 
-    data[len++] = lineA;
-    data[len++] = lineB;
-    data[len++] = lineC;
+    if (format == CF_Legacy)
+    {
+        auto writeString = [&](const std::string& str) {
+            size_t l = GetStringLen(str, str.size());
+            memcpy(ptr, str.c_str(), l);
+            ptr += l;
+            // Add null-terminator.
+            *ptr++ = '\0';
+        };
+
+        ptr = WriteU32(ptr, sn);
+        writeString(btName);
+        *ptr++ = truckType;
+        writeString(lastCalibDate);
+
+        *ptr++ = isLoraEn;
+        *ptr++ = isLogToFileEn;
+        *ptr++ = isDisplayEn;
+        *ptr++ = isIsaacEn;
+        *ptr++ = isRelayOutEn;
+        *ptr++ = isDutyBoxEn;
+        *ptr++ = dutyBoxSpeedLimit;
+
+        *ptr++ = sensor1Type;
+        *ptr++ = sensor2Type;
+        *ptr++ = sensor3Type;
+        *ptr++ = sensor4Type;
+
+        *ptr++ = lineA;
+        *ptr++ = lineB;
+        *ptr++ = lineC;
+
+        *ptr++ = samplesToTake;
+        *ptr++ = isTempSensorPresent;
+        *ptr++ = unitType;
+        *ptr++ = language;
+    }
+    else
+    {
+        size_t payloadLen = GetSize(format) - CONFIG_HEADER_LEN;
+
+        memcpy(ptr, CONFIG_MAGIC, CONFIG_MAGIC_LEN);
+        ptr += CONFIG_MAGIC_LEN;
+        *ptr++ = CONFIG_FORMAT_VERSION;
+        *ptr++ = 0;    // Reserved.
+        *ptr++ = (uint8_t)(payloadLen >> 8) & 0xFF;
+        *ptr++ = (uint8_t)payloadLen & 0xFF;
+
+        auto writeU8 = [&](uint8_t tag, uint8_t value) {
+            *ptr++ = tag;
+            *ptr++ = 1;
+            *ptr++ = value;
+        };
+        auto writeString = [&](uint8_t tag, const std::string& str) {
+            uint8_t l = (uint8_t)GetStringLen(str, CONFIG_MAX_VALUE_LEN);
+            *ptr++    = tag;
+            *ptr++    = l;
+            memcpy(ptr, str.c_str(), l);
+            ptr += l;
+        };
+
+        *ptr++ = CT_SerialNumber;
+        *ptr++ = sizeof(sn);
+        ptr    = WriteU32(ptr, sn);
+        writeString(CT_BtName, btName);
+        writeU8(CT_TruckType, truckType);
+        writeString(CT_LastCalibDate, lastCalibDate);
+
+        writeU8(CT_IsLoraEn, isLoraEn);
+        writeU8(CT_IsLogToFileEn, isLogToFileEn);
+        writeU8(CT_IsDisplayEn, isDisplayEn);
+        writeU8(CT_IsIsaacEn, isIsaacEn);
+        writeU8(CT_IsRelayOutEn, isRelayOutEn);
+        writeU8(CT_IsDutyBoxEn, isDutyBoxEn);
+        writeU8(CT_DutyBoxSpeedLimit, dutyBoxSpeedLimit);
+
+        writeU8(CT_Sensor1Type, sensor1Type);
+        writeU8(CT_Sensor2Type, sensor2Type);
+        writeU8(CT_Sensor3Type, sensor3Type);
+        writeU8(CT_Sensor4Type, sensor4Type);
+
+        writeU8(CT_LineA, lineA);
+        writeU8(CT_LineB, lineB);
+        writeU8(CT_LineC, lineC);
+
+        writeU8(CT_SamplesToTake, samplesToTake);
+        writeU8(CT_IsTempSensorPresent, isTempSensorPresent);
+        writeU8(CT_UnitType, unitType);
+        writeU8(CT_Language, language);
+    }
 
-    data[len++] = samplesToTake;
-    data[len++] = isTempSensorPresent;
-    data[len++] = unitType;
-    data[len++] = language;
+    size_t len = ptr - data;
+    BR_ASSERT(len == GetSize(format), "Serialized size doesn't match the computed size!");
 
     *outData = data;
     return len;
 }
 
 
-size_t Config::GetSize() const
+size_t Config::GetSize(uint8_t format) const
 {
-    // Total size in bytes.
-    size_t s = sizeof(Config);
-
-    // Remove the two strings, since we want the number of chars, not the size of std::string.
-    s -= sizeof(std::string) * 2;
+    // Every field but the serial number and the two strings is a single byte.
+    constexpr size_t byteFields = CT_Count - 4;
 
-    // Add the number of bytes contained in each strings.
-    s += btName.size();
-    s += lastCalibDate.size();
+    if (format == CF_Legacy)
+    {
+        // Strings are null-terminated.
+        return sizeof(sn) + byteFields + (GetStringLen(btName, btName.size()) + 1) +
+               (GetStringLen(lastCalibDate, lastCalibDate.size()) + 1);
+    }
 
-    return s;
+    // Each field is preceded by its tag and length.
+    return CONFIG_HEADER_LEN + ((CT_Count - 1) * CONFIG_RECORD_HEADER_LEN) + sizeof(sn) +
+           byteFields + GetStringLen(btName, CONFIG_MAX_VALUE_LEN) +
+           GetStringLen(lastCalibDate, CONFIG_MAX_VALUE_LEN);
 }
@@ -20,7 +20,16 @@
 
 /*****************************************************************************/
 /* Exported defines */
-
+// Identifies a versioned configuration, as opposed to the legacy fixed layout.
+#define CONFIG_MAGIC          "V21C"
+#define CONFIG_MAGIC_LEN      4
+#define CONFIG_FORMAT_VERSION 1
+// Magic, version, reserved byte and big-endian 16-bit payload length.
+#define CONFIG_HEADER_LEN 8
+// Tag and length bytes preceding the value of each record.
+#define CONFIG_RECORD_HEADER_LEN 2
+// Longest value a record can hold, its length is a single byte.
+#define CONFIG_MAX_VALUE_LEN 255
 
 /*****************************************************************************/
 /* Exported macro */
@@ -53,14 +62,63 @@ using Languages = enum {
     L_English = 1,
 };
 
+using ConfigFormats = enum {
+    CF_Legacy = 0,    // Fixed sequence of fields, no header. Read by older firmwares.
+    CF_Tlv    = 1,    // Header followed by tag-length-value records.
+};
+
+/**
+ * Tags of the records of a versioned configuration.
+ * Tags are part of the wire format: never re-number them, only append new ones.
+ * Readers skip the records whose tag they don't know.
+ */
+using ConfigTags = enum {
+    CT_Invalid             = 0,
+    CT_SerialNumber        = 1,
+    CT_BtName              = 2,
+    CT_TruckType           = 3,
+    CT_LastCalibDate       = 4,
+    CT_IsLoraEn            = 5,
+    CT_IsLogToFileEn       = 6,
+    CT_IsDisplayEn         = 7,
+    CT_IsIsaacEn           = 8,
+    CT_IsRelayOutEn        = 9,
+    CT_IsDutyBoxEn         = 10,
+    CT_DutyBoxSpeedLimit   = 11,
+    CT_Sensor1Type         = 12,
+    CT_Sensor2Type         = 13,
+    CT_Sensor3Type         = 14,
+    CT_Sensor4Type         = 15,
+    CT_LineA               = 16,
+    CT_LineB               = 17,
+    CT_LineC               = 18,
+    CT_SamplesToTake       = 19,
+    CT_IsTempSensorPresent = 20,
+    CT_UnitType            = 21,
+    CT_Language            = 22,
+    CT_Count
+};
+
 struct Config
 {
+    /**
+     * Decodes a configuration. Versioned configurations are recognized by their magic number,
+     * anything else is decoded as the legacy layout.
+     * Fields that are missing from the data keep their default value.
+     */
     Config(const uint8_t* data, size_t len);
     Config() = default;
 
-    size_t Serialize(uint8_t** outData);
+    /**
+     * Serializes the configuration into a buffer allocated with new[].
+     * The caller owns the buffer and must delete[] it.
+     *
+     * \return The number of bytes written in the buffer. 0 if a string is longer than
+     *         CONFIG_MAX_VALUE_LEN in the versioned format, nothing is allocated then.
+     */
+    size_t Serialize(uint8_t** outData, uint8_t format = CF_Tlv) const;
 
-    size_t GetSize() const;
+    size_t GetSize(uint8_t format = CF_Tlv) const;
 
     uint32_t    sn                  = 0;
     std::string btName              = std::string(32, '\0');
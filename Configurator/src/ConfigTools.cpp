@@ -0,0 +1,236 @@
+﻿#include "ConfigTools.h"
+
+#include "Config.h"
+
+#include "Brigerad.h"
+#include "Brigerad/Core/Time.h"
+#include "Brigerad/Debug/CommandLineTools.h"
+
+#include <random>
+
+BR_REGISTER_TOOL("config-fuzz",
+                 "[iterations] [seed] Decode mutated configurations.",
+                 [](const std::vector<std::string>& args) {
+                     size_t failures = FuzzConfigDecoder(
+                       Brigerad::CommandLineTools::GetArgument(args, 0, 1000000),
+                       (uint32_t)Brigerad::CommandLineTools::GetArgument(args, 1, 21));
+                     return failures == 0 ? 0 : 1;
+                 });
+BR_REGISTER_TOOL("config-benchmark",
+                 "[iterations] Time the decoding of configurations.",
+                 [](const std::vector<std::string>& args) {
+                     BenchmarkConfigDecoder(
+                       Brigerad::CommandLineTools::GetArgument(args, 0, 1000000));
+                     return 0;
+                 });
+
+/*****************************************************************************/
+/* Private functions */
+static std::vector<uint8_t> Serialize(const Config& config, uint8_t format)
+{
+    uint8_t* data = nullptr;
+    size_t   len  = config.Serialize(&data, format);
+    std::vector<uint8_t> bytes(data, data + len);
+    delete[] data;
+    return bytes;
+}
+
+/**
+ * Valid configurations to start the mutations from, in both formats.
+ */
+static std::vector<std::vector<uint8_t>> MakeSeeds()
+{
+    Config defaults;
+
+    Config filled;
+    filled.sn                = 123456;
+    filled.btName            = "Vision21-Unit";
+    filled.truckType         = TT_12Wheels;
+    filled.lastCalibDate     = "21-10-19";
+    filled.isLoraEn          = true;
+    filled.isDutyBoxEn       = true;
+    filled.dutyBoxSpeedLimit = 30;
+    filled.sensor1Type       = ST_Pneumatic;
+    filled.sensor3Type       = ST_Inclinometer;
+    filled.lineA             = 0x12;
+    filled.lineC             = 0xF0;
+    filled.unitType          = U_Imperial;
+    filled.language          = L_English;
+
+    // A legacy serial number that reads as the magic of the versioned format.
+    Config magicSn = filled;
+    magicSn.sn = ((uint32_t)'V' << 24) | ((uint32_t)'2' << 16) | ((uint32_t)'1' << 8) | 'C';
+
+    std::vector<std::vector<uint8_t>> seeds;
+    for (const Config* config : {&defaults, &filled, &magicSn})
+    {
+        seeds.push_back(Serialize(*config, CF_Tlv));
+        seeds.push_back(Serialize(*config, CF_Legacy));
+    }
+    return seeds;
+}
+
+static std::vector<uint8_t> Mutate(const std::vector<uint8_t>& seed, std::mt19937& rng)
+{
+    std::vector<uint8_t> data = seed;
+    auto random = [&](size_t max) { return max == 0 ? 0 : size_t(rng() % max); };
+
+    size_t mutations = 1 + random(4);
+    for (size_t m = 0; m < mutations; m++)
+    {
+        switch (random(7))
+        {
+            case 0:    // Flip a bit.
+                if (!data.empty())
+                {
+                    data[random(data.size())] ^= uint8_t(1 << random(8));
+                }
+                break;
+            case 1:    // Random byte.
+                if (!data.empty())
+                {
+                    data[random(data.size())] = uint8_t(rng());
+                }
+                break;
+            case 2:    // Truncate.
+                data.resize(random(data.size() + 1));
+                break;
+            case 3:    // Append random bytes.
+                for (size_t i = random(16); i > 0; i--)
+                {
+                    data.push_back(uint8_t(rng()));
+                }
+                break;
+            case 4:    // Insert a byte, shifting every record that follows.
+                data.insert(data.begin() + random(data.size() + 1), uint8_t(rng()));
+                break;
+            case 5:    // Remove a byte.
+                if (!data.empty())
+                {
+                    data.erase(data.begin() + random(data.size()));
+                }
+                break;
+            default:    // Nothing to do with the seed.
+                data.resize(random(CONFIG_HEADER_LEN + 300));
+                for (uint8_t& byte : data)
+                {
+                    byte = uint8_t(rng());
+                }
+                if (data.size() >= CONFIG_MAGIC_LEN && random(2) == 0)
+                {
+                    memcpy(data.data(), CONFIG_MAGIC, CONFIG_MAGIC_LEN);
+                }
+                break;
+        }
+    }
+    return data;
+}
+
+static std::string ToHex(const std::vector<uint8_t>& data)
+{
+    std::string hex;
+    for (uint8_t byte : data)
+    {
+        hex += fmt::format("{:02X}", byte);
+    }
+    return hex;
+}
+
+/**
+ * Decodes the data from a buffer of its exact size.
+ */
+static Config Decode(const std::vector<uint8_t>& data)
+{
+    // An empty vector may not have a buffer to read from.
+    std::unique_ptr<uint8_t[]> buffer(new uint8_t[std::max<size_t>(data.size(), 1)]);
+    std::copy(data.begin(), data.end(), buffer.get());
+    return Config(buffer.get(), data.size());
+}
+
+
+/*****************************************************************************/
+/* Exported functions */
+size_t FuzzConfigDecoder(size_t iterations, uint32_t seed)
+{
+    BR_PROFILE_FUNCTION();
+
+    std::vector<std::vector<uint8_t>> seeds    = MakeSeeds();
+    size_t                            failures = 0;
+
+    // Every valid configuration comes back the same, in its own format.
+    for (size_t i = 0; i < seeds.size(); i++)
+    {
+        uint8_t format = i % 2 == 0 ? CF_Tlv : CF_Legacy;
+        if (Serialize(Decode(seeds[i]), format) != seeds[i])
+        {
+            BR_ERROR("Seed {} doesn't survive a round trip: {}", i, ToHex(seeds[i]));
+            failures++;
+        }
+    }
+
+    // The decoder reports every broken input, that isn't what is tested here.
+    auto level = Brigerad::Log::GetClientLogger()->level();
+    Brigerad::Log::GetClientLogger()->set_level(spdlog::level::critical);
+
+    std::mt19937 rng(seed);
+    for (size_t i = 0; i < iterations; i++)
+    {
+        std::vector<uint8_t> input = Mutate(seeds[rng() % seeds.size()], rng);
+        std::vector<uint8_t> first = Serialize(Decode(input), CF_Tlv);
+        if (first.empty())
+        {
+            // A legacy string too long for the versioned format.
+            continue;
+        }
+
+        std::vector<uint8_t> second = Serialize(Decode(first), CF_Tlv);
+        if (first != second && failures++ < 10)
+        {
+            Brigerad::Log::GetClientLogger()->set_level(level);
+            BR_ERROR("Decoding isn't stable for {}", ToHex(input));
+            Brigerad::Log::GetClientLogger()->set_level(spdlog::level::critical);
+        }
+    }
+
+    Brigerad::Log::GetClientLogger()->set_level(level);
+    BR_INFO("Decoded {} mutated configurations from seed {}, {} failed checks.",
+            iterations,
+            seed,
+            failures);
+    return failures;
+}
+
+void BenchmarkConfigDecoder(size_t iterations)
+{
+    BR_PROFILE_FUNCTION();
+
+    // Without the trace of each decoding, that measures the logger.
+    auto level = Brigerad::Log::GetClientLogger()->level();
+    Brigerad::Log::GetClientLogger()->set_level(spdlog::level::info);
+
+    std::vector<std::vector<uint8_t>> seeds = MakeSeeds();
+    // The filled configuration, in each format.
+    for (size_t i : {2, 3})
+    {
+        const std::vector<uint8_t>& data = seeds[i];
+
+        // Keep the decoding from being optimized away.
+        uint64_t checksum = 0;
+        int64_t  start    = Brigerad::GetTimeNs();
+        for (size_t n = 0; n < iterations; n++)
+        {
+            Config config(data.data(), data.size());
+            checksum += config.sn + config.btName.size() + config.language;
+        }
+        double elapsedNs = double(Brigerad::GetTimeNs() - start);
+
+        BR_INFO("{:<8} {} bytes: {:.1f} ns/config, {:.1f} MB/s (checksum {})",
+                i == 2 ? "TLV" : "Legacy",
+                data.size(),
+                elapsedNs / double(iterations),
+                double(data.size() * iterations) / elapsedNs * 1e3,
+                checksum);
+    }
+
+    Brigerad::Log::GetClientLogger()->set_level(level);
+}
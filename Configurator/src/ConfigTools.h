@@ -0,0 +1,46 @@
+﻿/**
+ ******************************************************************************
+ * @addtogroup ConfigTools
+ * @{
+ * @file    ConfigTools
+ * @author  Samuel Martel
+ * @brief   Header for the ConfigTools module.
+ *
+ * @date 10/19/2026 2:30:00 PM
+ *
+ ******************************************************************************
+ */
+#ifndef _ConfigTools
+#define _ConfigTools
+
+/*****************************************************************************/
+/* Includes */
+#include <cstddef>
+#include <cstdint>
+
+/*****************************************************************************/
+/* Exported functions */
+/**
+ * Decodes mutated configurations: bit flips, truncations, bad lengths and random bytes, starting
+ * from valid ones of both formats. Checks that the valid ones survive a round trip and that the
+ * decoded mutations encode to a versioned configuration that decodes to the same bytes again.
+ * Each input gets a buffer of its exact size, an address sanitizer build catches any overread.
+ * Run with --config-fuzz [iterations] [seed].
+ *
+ * \return The number of failed checks.
+ */
+size_t FuzzConfigDecoder(size_t iterations, uint32_t seed);
+
+/**
+ * Times the decoding of the same configuration in both formats and prints the time per
+ * configuration and the throughput. Run with --config-benchmark [iterations].
+ */
+void BenchmarkConfigDecoder(size_t iterations);
+
+
+/* Have a wonderful day :) */
+#endif /* _ConfigTools */
+/**
+ * @}
+ */
+/****** END OF FILE ******/
@@ -7,7 +7,12 @@
 class Configurator : public Brigerad::Application
 {
 public:
-    Configurator() : Brigerad::Application("Vision21 Configurator") { PushLayer(new AppLayer()); }
+    Configurator() : Brigerad::Application("Vision21 Configurator")
+    {
+        // Mostly static forms, no need to keep the laptop busy redrawing them.
+        SetOnDemandRendering(true);
+        PushLayer(new AppLayer());
+    }
 
     ~Configurator() override = default;
 };
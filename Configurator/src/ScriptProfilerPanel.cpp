@@ -0,0 +1,222 @@
+﻿#include "ScriptProfilerPanel.h"
+
+#include "Brigerad.h"
+
+#include "ImGui/imgui.h"
+
+#include <algorithm>
+#include <numeric>
+
+using Brigerad::ScriptProfiler;
+
+// Height of a row of the flame graph, in pixels.
+static constexpr float s_flameRowHeight = 18.0f;
+// Narrower frames are not drawn, in pixels.
+static constexpr float s_flameMinWidth = 1.0f;
+// Rows of the function table.
+static constexpr size_t s_maxFunctionsShown = 50;
+
+
+void ScriptProfilerPanel::OnImGuiRender()
+{
+    BR_PROFILE_FUNCTION();
+
+    if (!m_isVisible)
+    {
+        return;
+    }
+
+    if (ScriptProfiler::IsRunning())
+    {
+        // Keep the results moving while sampling.
+        Brigerad::Application::Get().RequestRedraw();
+    }
+
+    if (!ImGui::Begin("Profileur Lua", &m_isVisible))
+    {
+        ImGui::End();
+        return;
+    }
+
+    RenderControls();
+    ImGui::Separator();
+
+    ScriptProfiler::Report report = ScriptProfiler::GetReport();
+    ImGui::Text("Temps echantillonne : %.2f ms", report.totalMs);
+
+    if (ImGui::CollapsingHeader("Fonctions", ImGuiTreeNodeFlags_DefaultOpen))
+    {
+        RenderFunctions(report);
+    }
+    if (ImGui::CollapsingHeader("Graphique en flammes", ImGuiTreeNodeFlags_DefaultOpen))
+    {
+        RenderFlameGraph(report);
+    }
+
+    ImGui::End();
+}
+
+
+void ScriptProfilerPanel::RenderControls()
+{
+    if (ScriptProfiler::IsRunning())
+    {
+        if (ImGui::Button("Arreter"))
+        {
+            ScriptProfiler::Stop();
+        }
+    }
+    else if (ImGui::Button("Demarrer"))
+    {
+        ScriptProfiler::Start(uint32_t(m_instructionsPerSample));
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Effacer"))
+    {
+        ScriptProfiler::Clear();
+    }
+
+    // Only taken into account on the next start.
+    ImGui::SliderInt("Instructions par echantillon", &m_instructionsPerSample, 100, 100000);
+
+    bool trace = ScriptProfiler::GetTraceOutput();
+    if (ImGui::Checkbox("Ecrire dans la trace", &trace))
+    {
+        ScriptProfiler::SetTraceOutput(trace);
+    }
+}
+
+
+void ScriptProfilerPanel::RenderFunctions(const ScriptProfiler::Report& report)
+{
+    std::vector<size_t> order(report.functions.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return report.functions[a].selfMs > report.functions[b].selfMs;
+    });
+    order.resize(std::min(order.size(), s_maxFunctionsShown));
+
+    ImGui::Columns(5, "scriptProfilerFunctions");
+    ImGui::SetColumnWidth(0, ImGui::GetWindowContentRegionWidth() * 0.5f);
+    ImGui::Text("Fonction");
+    ImGui::NextColumn();
+    ImGui::Text("Propre (ms)");
+    ImGui::NextColumn();
+    ImGui::Text("Total (ms)");
+    ImGui::NextColumn();
+    ImGui::Text("Echantillons");
+    ImGui::NextColumn();
+    ImGui::Text("Ligne");
+    ImGui::NextColumn();
+    ImGui::Separator();
+
+    for (size_t i : order)
+    {
+        const ScriptProfiler::FunctionStats& stats = report.functions[i];
+        ImGui::TextUnformatted(stats.name.c_str());
+        ImGui::NextColumn();
+        ImGui::Text("%.2f", stats.selfMs);
+        ImGui::NextColumn();
+        ImGui::Text("%.2f", stats.totalMs);
+        ImGui::NextColumn();
+        ImGui::Text("%u", stats.samples);
+        ImGui::NextColumn();
+        if (stats.hotLine >= 0)
+        {
+            ImGui::Text("%d", stats.hotLine);
+        }
+        ImGui::NextColumn();
+    }
+    ImGui::Columns(1);
+}
+
+
+// Frames of a row of the flame graph, with where they start horizontally.
+struct FlameFrame
+{
+    const ScriptProfiler::CallNode* node;
+    float                           x;
+};
+
+
+void ScriptProfilerPanel::RenderFlameGraph(const ScriptProfiler::Report& report)
+{
+    if (report.root.totalMs <= 0.0)
+    {
+        ImGui::TextDisabled("Aucun echantillon.");
+        return;
+    }
+
+    // Callers at the bottom, laid out one row at a time.
+    std::vector<std::vector<FlameFrame>> rows;
+    rows.push_back({});
+    float x = 0.0f;
+    for (const auto& child : report.root.children)
+    {
+        rows[0].push_back({&child, x});
+        x += float(child.totalMs / report.root.totalMs);
+    }
+    while (!rows.back().empty())
+    {
+        std::vector<FlameFrame> next;
+        for (const FlameFrame& frame : rows.back())
+        {
+            float childX = frame.x;
+            for (const auto& child : frame.node->children)
+            {
+                next.push_back({&child, childX});
+                childX += float(child.totalMs / report.root.totalMs);
+            }
+        }
+        rows.push_back(std::move(next));
+    }
+    rows.pop_back();
+
+    float  width  = ImGui::GetContentRegionAvail().x;
+    float  height = rows.size() * s_flameRowHeight;
+    ImVec2 origin = ImGui::GetCursorScreenPos();
+    ImGui::InvisibleButton("flameGraph", ImVec2(width, std::max(height, 1.0f)));
+    bool   isHovered = ImGui::IsItemHovered();
+    ImVec2 mouse     = ImGui::GetIO().MousePos;
+
+    ImDrawList* drawList = ImGui::GetWindowDrawList();
+    for (size_t depth = 0; depth < rows.size(); depth++)
+    {
+        float y = origin.y + height - (depth + 1) * s_flameRowHeight;
+        for (const FlameFrame& frame : rows[depth])
+        {
+            float w = float(frame.node->totalMs / report.root.totalMs) * width;
+            if (w < s_flameMinWidth)
+            {
+                continue;
+            }
+
+            const ScriptProfiler::FunctionStats& stats = report.functions[frame.node->function];
+
+            // Warmer for the frames doing the work themselves.
+            float  self  = float(frame.node->selfMs / frame.node->totalMs);
+            ImVec2 min   = {origin.x + frame.x * width, y};
+            ImVec2 max   = {min.x + w - 1.0f, y + s_flameRowHeight - 1.0f};
+            ImU32  color = ImGui::GetColorU32(ImVec4(0.9f, 0.7f - 0.5f * self, 0.2f, 1.0f));
+            drawList->AddRectFilled(min, max, color);
+
+            drawList->PushClipRect(min, max, true);
+            drawList->AddText(ImVec2(min.x + 2.0f, min.y + 2.0f),
+                              IM_COL32(0, 0, 0, 255),
+                              stats.name.c_str());
+            drawList->PopClipRect();
+
+            if (isHovered && mouse.x >= min.x && mouse.x < max.x && mouse.y >= min.y &&
+                mouse.y < max.y)
+            {
+                ImGui::BeginTooltip();
+                ImGui::TextUnformatted(stats.name.c_str());
+                ImGui::Text("Total : %.2f ms (%.1f%%)",
+                            frame.node->totalMs,
+                            100.0 * frame.node->totalMs / report.root.totalMs);
+                ImGui::Text("Propre : %.2f ms", frame.node->selfMs);
+                ImGui::EndTooltip();
+            }
+        }
+    }
+}
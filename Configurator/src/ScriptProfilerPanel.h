@@ -0,0 +1,61 @@
+﻿/**
+ ******************************************************************************
+ * @addtogroup ScriptProfilerPanel
+ * @{
+ * @file    ScriptProfilerPanel
+ * @author  Samuel Martel
+ * @brief   Header for the ScriptProfilerPanel module.
+ *
+ * @date 10/19/2026 9:45:00 PM
+ *
+ ******************************************************************************
+ */
+#ifndef _ScriptProfilerPanel
+#define _ScriptProfilerPanel
+
+/*****************************************************************************/
+/* Includes */
+#include "Brigerad/Script/ScriptProfiler.h"
+
+
+/*****************************************************************************/
+/* Exported defines */
+
+
+/*****************************************************************************/
+/* Exported macro */
+
+
+/*****************************************************************************/
+/* Exported types */
+/**
+ * Window controlling the Lua profiler, with the hottest functions and a flame graph of the calls.
+ */
+class ScriptProfilerPanel
+{
+public:
+    void OnImGuiRender();
+
+    bool& IsVisible() { return m_isVisible; }
+
+private:
+    void RenderControls();
+    void RenderFunctions(const Brigerad::ScriptProfiler::Report& report);
+    void RenderFlameGraph(const Brigerad::ScriptProfiler::Report& report);
+
+private:
+    bool m_isVisible = false;
+
+    int m_instructionsPerSample = 1000;
+};
+
+/*****************************************************************************/
+/* Exported functions */
+
+
+/* Have a wonderful day :) */
+#endif /* _ScriptProfilerPanel */
+/**
+ * @}
+ */
+/****** END OF FILE ******/
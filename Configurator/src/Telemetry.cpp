@@ -0,0 +1,406 @@
+﻿#include "Telemetry.h"
+
+#include "Brigerad.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+/*****************************************************************************/
+/* Log file format */
+#define TELEMETRY_LOG_MAGIC   "V21T"
+#define TELEMETRY_LOG_VERSION 1
+// Frames the log grows by when it is full, doubled each time.
+#define TELEMETRY_LOG_INITIAL_CAPACITY 65536
+
+struct TelemetryLogHeader
+{
+    char     magic[4];
+    uint8_t  version;
+    uint8_t  channelCount;
+    uint16_t frameSize;
+    uint32_t reserved;
+    uint32_t reserved2;
+    uint64_t frameCount;    // Updated after every frame, the log is valid even after a crash.
+};
+static_assert(sizeof(TelemetryLogHeader) == 24, "Log header must not have padding");
+
+
+/*****************************************************************************/
+/* TelemetryChannel */
+void TelemetryChannel::Append(const TelemetryPoint& point)
+{
+    m_times.push_back(point.time);
+    m_values.push_back(point.value);
+
+    // Every 8 samples complete a block of level 1, every 8 blocks of level 1 complete a block of
+    // level 2, and so on.
+    size_t count = m_values.size();
+    size_t level = 0;
+    while (count % s_branching == 0)
+    {
+        if (level == m_levels.size())
+        {
+            m_levels.emplace_back();
+        }
+
+        MinMax mm = {std::numeric_limits<float>::max(), std::numeric_limits<float>::lowest()};
+        for (size_t i = count - s_branching; i < count; i++)
+        {
+            const MinMax& child =
+              level == 0 ? MinMax {m_values[i], m_values[i]} : m_levels[level - 1][i];
+            mm.min = std::min(mm.min, child.min);
+            mm.max = std::max(mm.max, child.max);
+        }
+        m_levels[level].push_back(mm);
+
+        count = m_levels[level].size();
+        level++;
+    }
+}
+
+void TelemetryChannel::Clear()
+{
+    m_times.clear();
+    m_values.clear();
+    m_levels.clear();
+}
+
+size_t TelemetryChannel::LowerBound(double time) const
+{
+    return std::lower_bound(m_times.begin(), m_times.end(), time) - m_times.begin();
+}
+
+TelemetryChannel::MinMax TelemetryChannel::GetMinMax(size_t begin, size_t end) const
+{
+    BR_ASSERT(begin < end && end <= m_values.size(), "Invalid range!");
+
+    MinMax result = {std::numeric_limits<float>::max(), std::numeric_limits<float>::lowest()};
+    auto   take   = [&](size_t level, size_t i) {
+        const MinMax& mm = level == 0 ? MinMax {m_values[i], m_values[i]} : m_levels[level - 1][i];
+        result.min       = std::min(result.min, mm.min);
+        result.max       = std::max(result.max, mm.max);
+    };
+
+    // Consume the unaligned ends of the range at each level, then move the aligned middle up
+    // to the next level where it takes 8 times less entries.
+    size_t level = 0;
+    while (begin < end)
+    {
+        if (level < m_levels.size())
+        {
+            while (begin < end && begin % s_branching != 0)
+            {
+                take(level, begin++);
+            }
+            while (begin < end && end % s_branching != 0)
+            {
+                take(level, --end);
+            }
+            begin /= s_branching;
+            end /= s_branching;
+            level++;
+        }
+        else
+        {
+            while (begin < end)
+            {
+                take(level, begin++);
+            }
+        }
+    }
+
+    return result;
+}
+
+
+/*****************************************************************************/
+/* TelemetryLog */
+bool TelemetryLog::Create(const std::string& path)
+{
+    m_capacity = TELEMETRY_LOG_INITIAL_CAPACITY;
+    if (!m_file.Open(path,
+                     Brigerad::MappedFile::Mode::ReadWrite,
+                     sizeof(TelemetryLogHeader) + (m_capacity * sizeof(TelemetryFrame))))
+    {
+        return false;
+    }
+
+    TelemetryLogHeader header = {};
+    memcpy(header.magic, TELEMETRY_LOG_MAGIC, sizeof(header.magic));
+    header.version      = TELEMETRY_LOG_VERSION;
+    header.channelCount = TELEMETRY_CHANNEL_COUNT;
+    header.frameSize    = sizeof(TelemetryFrame);
+    header.frameCount   = 0;
+    memcpy(m_file.Data(), &header, sizeof(header));
+
+    return true;
+}
+
+bool TelemetryLog::OpenForReplay(const std::string& path)
+{
+    m_capacity = 0;
+    if (!m_file.Open(path, Brigerad::MappedFile::Mode::Read))
+    {
+        return false;
+    }
+
+    const auto* header = reinterpret_cast<const TelemetryLogHeader*>(m_file.Data());
+    if (m_file.Size() < sizeof(TelemetryLogHeader) ||
+        memcmp(header->magic, TELEMETRY_LOG_MAGIC, sizeof(header->magic)) != 0 ||
+        header->channelCount != TELEMETRY_CHANNEL_COUNT ||
+        header->frameSize != sizeof(TelemetryFrame))
+    {
+        BR_ERROR("'{}' is not a telemetry log.", path);
+        m_file.Close();
+        return false;
+    }
+
+    return true;
+}
+
+void TelemetryLog::Close()
+{
+    if (m_file.IsOpen() && m_capacity != 0)
+    {
+        // Give back the space reserved for the frames that never came.
+        m_file.Resize(sizeof(TelemetryLogHeader) + (GetFrameCount() * sizeof(TelemetryFrame)));
+    }
+    m_file.Close();
+    m_capacity = 0;
+}
+
+bool TelemetryLog::Append(const TelemetryFrame& frame)
+{
+    if (m_file.Data() == nullptr || m_capacity == 0)
+    {
+        return false;
+    }
+
+    auto*  header = reinterpret_cast<TelemetryLogHeader*>(m_file.Data());
+    size_t count  = (size_t)header->frameCount;
+    if (count == m_capacity)
+    {
+        if (!m_file.Resize(sizeof(TelemetryLogHeader) + (2 * m_capacity * sizeof(TelemetryFrame))))
+        {
+            // Unmapped, the frames written so far stay in the file and the header counts them.
+            m_file.Close();
+            m_capacity = 0;
+            return false;
+        }
+        m_capacity *= 2;
+        header = reinterpret_cast<TelemetryLogHeader*>(m_file.Data());
+        m_file.Flush();
+    }
+
+    auto* frames = reinterpret_cast<TelemetryFrame*>(m_file.Data() + sizeof(TelemetryLogHeader));
+    frames[count]      = frame;
+    header->frameCount = count + 1;
+    return true;
+}
+
+size_t TelemetryLog::GetFrameCount() const
+{
+    if (!m_file.IsOpen())
+    {
+        return 0;
+    }
+
+    // Don't trust the header of a log that was cut short.
+    const auto* header = reinterpret_cast<const TelemetryLogHeader*>(m_file.Data());
+    size_t      stored = (m_file.Size() - sizeof(TelemetryLogHeader)) / sizeof(TelemetryFrame);
+    return std::min((size_t)header->frameCount, stored);
+}
+
+const TelemetryFrame* TelemetryLog::GetFrames() const
+{
+    return reinterpret_cast<const TelemetryFrame*>(m_file.Data() + sizeof(TelemetryLogHeader));
+}
+
+void TelemetryLog::Replay(std::array<TelemetryChannel, TELEMETRY_CHANNEL_COUNT>& channels) const
+{
+    const TelemetryFrame* frames    = GetFrames();
+    size_t                count     = GetFrameCount();
+    uint64_t              elapsedMs = 0;
+
+    for (auto& channel : channels)
+    {
+        channel.Clear();
+    }
+    for (size_t i = 0; i < count; i++)
+    {
+        elapsedMs += i == 0 ? 0 : (uint32_t)(frames[i].timestamp - frames[i - 1].timestamp);
+        for (size_t c = 0; c < TELEMETRY_CHANNEL_COUNT; c++)
+        {
+            channels[c].Append({(double)elapsedMs / 1000.0, frames[i].values[c]});
+        }
+    }
+}
+
+
+/*****************************************************************************/
+/* TelemetryReader */
+static uint32_t ReadU32(const uint8_t* data)
+{
+    return ((uint32_t)data[0] << 24) | ((uint32_t)data[1] << 16) | ((uint32_t)data[2] << 8) |
+           ((uint32_t)data[3]);
+}
+
+bool TelemetryReader::Start(const std::string& port, const std::string& logPath)
+{
+    Brigerad::Scope<Brigerad::Serial> serial;
+    try
+    {
+        serial = Brigerad::CreateScope<Brigerad::Serial>(
+          port, Brigerad::Serial::Baudrates::Baud115200, Brigerad::Serial::Timeout::simpleTimeout(20));
+    }
+    catch (std::exception& e)
+    {
+        BR_ERROR("Unable to open '{}': {}", port, e.what());
+        return false;
+    }
+
+    return Start(std::move(serial), logPath);
+}
+
+bool TelemetryReader::Start(Brigerad::Scope<Brigerad::Serial> serial, const std::string& logPath)
+{
+    Stop();
+
+    m_serial         = std::move(serial);
+    std::string port = m_serial->GetPort();
+
+    if (!logPath.empty() && !m_log.Create(logPath))
+    {
+        BR_WARN("Telemetry of '{}' will not be logged.", port);
+    }
+
+    m_pendingLen    = 0;
+    m_lastTimestamp = 0;
+    m_elapsedMs     = 0;
+    m_frames        = 0;
+    m_dropped       = 0;
+    m_badFrames     = 0;
+    m_failed        = false;
+    m_running       = true;
+    m_thread        = std::thread(&TelemetryReader::ThreadMain, this);
+
+    BR_INFO("Reading telemetry from '{}'.", port);
+    return true;
+}
+
+void TelemetryReader::Stop()
+{
+    m_running = false;
+    if (m_thread.joinable())
+    {
+        m_thread.join();
+    }
+    m_serial.reset();
+    m_log.Close();
+}
+
+void TelemetryReader::Poll(std::array<TelemetryChannel, TELEMETRY_CHANNEL_COUNT>& channels)
+{
+    std::array<TelemetryPoint, 256> points;
+
+    for (size_t c = 0; c < TELEMETRY_CHANNEL_COUNT; c++)
+    {
+        size_t count = 0;
+        while ((count = m_rings[c].PopMany(points.data(), points.size())) != 0)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                channels[c].Append(points[i]);
+            }
+        }
+    }
+}
+
+void TelemetryReader::ThreadMain()
+{
+    std::array<uint8_t, 1024> buffer;
+
+    while (m_running)
+    {
+        try
+        {
+            // Block until at least one byte arrives or the timeout expires, then take everything
+            // that is available.
+            size_t toRead = std::clamp(m_serial->BytesAvailable(), (size_t)1, buffer.size());
+            size_t len    = m_serial->Read(buffer.data(), toRead);
+            Parse(buffer.data(), len);
+        }
+        catch (std::exception& e)
+        {
+            BR_ERROR("Telemetry stopped: {}", e.what());
+            m_failed  = true;
+            m_running = false;
+        }
+    }
+}
+
+void TelemetryReader::Parse(const uint8_t* data, size_t len)
+{
+    for (size_t i = 0; i < len; i++)
+    {
+        uint8_t b = data[i];
+
+        // Look for the sync bytes before accumulating a frame.
+        if ((m_pendingLen == 0 && b != TELEMETRY_SYNC_0) ||
+            (m_pendingLen == 1 && b != TELEMETRY_SYNC_1))
+        {
+            m_pendingLen = b == TELEMETRY_SYNC_0 ? 1 : 0;
+            m_pending[0] = b;
+            continue;
+        }
+
+        m_pending[m_pendingLen++] = b;
+        if (m_pendingLen == TELEMETRY_FRAME_LEN)
+        {
+            uint8_t sum = 0;
+            for (size_t j = 2; j < TELEMETRY_FRAME_LEN - 1; j++)
+            {
+                sum += m_pending[j];
+            }
+
+            if (sum == m_pending[TELEMETRY_FRAME_LEN - 1])
+            {
+                OnFrame(m_pending.data());
+            }
+            else
+            {
+                m_badFrames++;
+            }
+            m_pendingLen = 0;
+        }
+    }
+}
+
+void TelemetryReader::OnFrame(const uint8_t* data)
+{
+    TelemetryFrame frame;
+    frame.timestamp = ReadU32(data + 2);
+    for (size_t c = 0; c < TELEMETRY_CHANNEL_COUNT; c++)
+    {
+        frame.values[c] = (float)(int32_t)ReadU32(data + 6 + (4 * c)) * TELEMETRY_VALUE_UNIT;
+    }
+
+    // The timestamp of the unit wraps around after 49 days, the unsigned difference doesn't care.
+    m_elapsedMs += m_frames == 0 ? 0 : (uint32_t)(frame.timestamp - m_lastTimestamp);
+    m_lastTimestamp = frame.timestamp;
+
+    for (size_t c = 0; c < TELEMETRY_CHANNEL_COUNT; c++)
+    {
+        if (!m_rings[c].Push({(double)m_elapsedMs / 1000.0, frame.values[c]}))
+        {
+            m_dropped++;
+        }
+    }
+
+    if (m_log.IsOpen() && !m_log.Append(frame))
+    {
+        BR_ERROR("Telemetry is no longer logged, '{}' could not grow.", m_log.GetPath());
+    }
+    m_frames++;
+}
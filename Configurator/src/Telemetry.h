@@ -0,0 +1,187 @@
+﻿/**
+ ******************************************************************************
+ * @addtogroup Telemetry
+ * @{
+ * @file    Telemetry
+ * @author  Samuel Martel
+ * @brief   Header for the Telemetry module.
+ *
+ * @date 10/19/2026 10:45:00 AM
+ *
+ ******************************************************************************
+ */
+#ifndef _Telemetry
+#define _Telemetry
+
+/*****************************************************************************/
+/* Includes */
+#include "Brigerad/Utils/MappedFile.h"
+#include "Brigerad/Utils/RingBuffer.h"
+#include "Brigerad/Utils/Serial.h"
+
+#include <array>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*****************************************************************************/
+/* Exported defines */
+// Capteur 1 to 4, then Ligne A to C.
+#define TELEMETRY_CHANNEL_COUNT 7
+
+// Frame sent by a unit: sync bytes, big-endian timestamp in ms, one big-endian value per channel
+// in thousandths, then the 8-bit sum of everything between the sync bytes and the checksum.
+#define TELEMETRY_SYNC_0     0xA5
+#define TELEMETRY_SYNC_1     0x5A
+#define TELEMETRY_FRAME_LEN  (2 + 4 + (4 * TELEMETRY_CHANNEL_COUNT) + 1)
+#define TELEMETRY_VALUE_UNIT 0.001f
+
+// Points a channel can hold while waiting for the UI thread to pick them up.
+#define TELEMETRY_RING_CAPACITY 8192
+
+/*****************************************************************************/
+/* Exported types */
+struct TelemetryPoint
+{
+    double time  = 0.0;    // Seconds since the start of the acquisition.
+    float  value = 0.0f;
+};
+
+/**
+ * One frame received from a unit, which is also the record format of the telemetry log.
+ */
+struct TelemetryFrame
+{
+    uint32_t timestamp = 0;    // Milliseconds, as sent by the unit.
+    float    values[TELEMETRY_CHANNEL_COUNT] = {0.0f};
+};
+
+/**
+ * History of a channel, with a min/max pyramid to plot any range in O(pixels).
+ *
+ * Level n of the pyramid holds the min and max of each block of 8^n consecutive samples, so
+ * the min/max of any range is found by combining at most a few entries of each level.
+ */
+class TelemetryChannel
+{
+public:
+    struct MinMax
+    {
+        float min;
+        float max;
+    };
+
+    void Append(const TelemetryPoint& point);
+    void Clear();
+
+    size_t                     Size() const { return m_values.size(); }
+    const std::vector<double>& GetTimes() const { return m_times; }
+    const std::vector<float>&  GetValues() const { return m_values; }
+
+    /** Index of the first sample at or after time. */
+    size_t LowerBound(double time) const;
+
+    /** Min and max of the samples in [begin, end). The range must not be empty. */
+    MinMax GetMinMax(size_t begin, size_t end) const;
+
+private:
+    static constexpr size_t s_branching = 8;
+
+    std::vector<double>              m_times;
+    std::vector<float>               m_values;
+    std::vector<std::vector<MinMax>> m_levels;    // m_levels[0] is level 1, blocks of 8.
+};
+
+/**
+ * Log of every frame received, kept in a memory-mapped file so that writing a frame is a copy
+ * in the page cache and a session can be replayed later.
+ */
+class TelemetryLog
+{
+public:
+    bool Create(const std::string& path);
+    bool OpenForReplay(const std::string& path);
+    void Close();
+
+    /** False if the log couldn't grow to make room for the frame, it is then closed. */
+    bool Append(const TelemetryFrame& frame);
+
+    bool                  IsOpen() const { return m_file.IsOpen(); }
+    size_t                GetFrameCount() const;
+    const TelemetryFrame* GetFrames() const;
+    const std::string&    GetPath() const { return m_file.GetPath(); }
+
+    /** Load every frame of the log into the channels, replacing their content. */
+    void Replay(std::array<TelemetryChannel, TELEMETRY_CHANNEL_COUNT>& channels) const;
+
+private:
+    Brigerad::MappedFile m_file;
+    size_t               m_capacity = 0;    // In frames.
+};
+
+/**
+ * Reads the frames of a unit on a background thread.
+ *
+ * Each frame is written to the log and its values are pushed in one lock-free ring per channel,
+ * for the UI thread to pick up with Poll.
+ */
+class TelemetryReader
+{
+public:
+    TelemetryReader() = default;
+    ~TelemetryReader() { Stop(); }
+
+    bool Start(const std::string& port, const std::string& logPath);
+    /** Read from an already opened port, e.g. a Brigerad::SerialReplay. */
+    bool Start(Brigerad::Scope<Brigerad::Serial> serial, const std::string& logPath);
+    void Stop();
+
+    bool IsRunning() const { return m_running; }
+    bool HasFailed() const { return m_failed; }
+
+    /** Move the points received since the last call into the channels. UI thread only. */
+    void Poll(std::array<TelemetryChannel, TELEMETRY_CHANNEL_COUNT>& channels);
+
+    size_t GetFrameCount() const { return m_frames; }
+    size_t GetDroppedCount() const { return m_dropped; }
+    size_t GetErrorCount() const { return m_badFrames; }
+
+private:
+    void ThreadMain();
+    void Parse(const uint8_t* data, size_t len);
+    void OnFrame(const uint8_t* frame);
+
+private:
+    Brigerad::Scope<Brigerad::Serial> m_serial;
+    std::thread                       m_thread;
+    std::atomic<bool>                 m_running = false;
+    std::atomic<bool>                 m_failed  = false;
+
+    std::array<Brigerad::RingBuffer<TelemetryPoint, TELEMETRY_RING_CAPACITY>,
+               TELEMETRY_CHANNEL_COUNT>
+      m_rings;
+
+    TelemetryLog m_log;
+
+    // Parser state, owned by the reading thread.
+    std::array<uint8_t, TELEMETRY_FRAME_LEN> m_pending       = {0};
+    size_t                                   m_pendingLen    = 0;
+    uint32_t                                 m_lastTimestamp = 0;
+    uint64_t                                 m_elapsedMs     = 0;
+
+    std::atomic<size_t> m_frames    = 0;
+    std::atomic<size_t> m_dropped   = 0;
+    std::atomic<size_t> m_badFrames = 0;
+};
+
+/*****************************************************************************/
+/* Exported functions */
+
+
+/* Have a wonderful day :) */
+#endif /* _Telemetry */
+/**
+ * @}
+ */
+/****** END OF FILE ******/
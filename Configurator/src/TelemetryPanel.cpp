@@ -0,0 +1,254 @@
+﻿#include "TelemetryPanel.h"
+
+#include "Brigerad.h"
+#include "File.h"
+
+#include "Brigerad/Utils/SerialPortRegistry.h"
+
+#include "ImGui/imgui.h"
+
+#include <algorithm>
+#include <ctime>
+
+static const char* s_channelNames[TELEMETRY_CHANNEL_COUNT] = {
+  "Capteur 1", "Capteur 2", "Capteur 3", "Capteur 4", "Ligne A", "Ligne B", "Ligne C"};
+
+// Height of the plot of a channel, in pixels.
+static constexpr float s_plotHeight = 80.0f;
+
+
+void TelemetryPanel::OnImGuiRender()
+{
+    BR_PROFILE_FUNCTION();
+
+    if (!m_isVisible)
+    {
+        return;
+    }
+
+    if (m_reader.IsRunning())
+    {
+        m_reader.Poll(m_channels);
+        // Keep the plots moving while frames come in.
+        Brigerad::Application::Get().RequestRedraw();
+    }
+
+    if (!ImGui::Begin("Telemetrie", &m_isVisible))
+    {
+        ImGui::End();
+        return;
+    }
+
+    RenderConnection();
+    ImGui::Separator();
+
+    // Every channel is sampled in the same frame, the first one gives the time span.
+    const std::vector<double>& times = m_channels[0].GetTimes();
+    double                     last  = times.empty() ? 0.0 : times.back();
+
+    ImGui::SliderFloat("Fenetre (s)", &m_window, 0.5f, 600.0f, "%.1f", 2.0f);
+    ImGui::Checkbox("Suivre", &m_followLatest);
+    if (!m_followLatest)
+    {
+        ImGui::SameLine();
+        ImGui::SliderFloat("##scroll", &m_scroll, 0.0f, (float)std::max(last - m_window, 0.0));
+    }
+
+    double begin = m_followLatest ? std::max(last - m_window, 0.0) : (double)m_scroll;
+    double end   = begin + m_window;
+
+    for (size_t c = 0; c < TELEMETRY_CHANNEL_COUNT; c++)
+    {
+        RenderChannel(c, begin, end);
+    }
+
+    ImGui::End();
+}
+
+
+void TelemetryPanel::OnEvent(Brigerad::Event& e)
+{
+    Brigerad::EventDispatcher dispatcher(e);
+    dispatcher.Dispatch<Brigerad::SerialPortRemovedEvent>(
+      std::bind(&TelemetryPanel::OnSerialPortRemoved, this, std::placeholders::_1));
+}
+
+
+void TelemetryPanel::Close()
+{
+    m_reader.Stop();
+    m_replay.Close();
+}
+
+
+void TelemetryPanel::RenderConnection()
+{
+    if (m_reader.IsRunning())
+    {
+        if (ImGui::Button("Deconnecter"))
+        {
+            m_reader.Stop();
+        }
+    }
+    else
+    {
+        if (ImGui::BeginCombo("##port", m_port.c_str()))
+        {
+            for (const auto& port : *Brigerad::SerialPortRegistry::GetPorts())
+            {
+                std::string label = port.port + " - " + port.description;
+                if (ImGui::Selectable(label.c_str(), port.port == m_port))
+                {
+                    m_port = port.port;
+                }
+            }
+            ImGui::EndCombo();
+        }
+
+        ImGui::SameLine();
+        if (ImGui::Button("Connecter") && !m_port.empty())
+        {
+            Connect();
+        }
+        ImGui::SameLine();
+        if (ImGui::Button("Rejouer..."))
+        {
+            Replay();
+        }
+        ImGui::SameLine();
+        ImGui::Checkbox("Enregistrer", &m_logToFile);
+    }
+
+    ImGui::Text("Trames: %zu  Perdues: %zu  Invalides: %zu",
+                m_reader.GetFrameCount(),
+                m_reader.GetDroppedCount(),
+                m_reader.GetErrorCount());
+    if (m_reader.HasFailed())
+    {
+        ImGui::SameLine();
+        ImGui::TextColored(ImVec4 {1.0f, 0.3f, 0.3f, 1.0f}, "Connexion perdue");
+    }
+    if (m_replay.IsOpen())
+    {
+        ImGui::Text("Journal: %s", m_replay.GetPath().c_str());
+    }
+}
+
+
+void TelemetryPanel::RenderChannel(size_t channel, double begin, double end)
+{
+    const TelemetryChannel&    ch     = m_channels[channel];
+    const std::vector<double>& times  = ch.GetTimes();
+    const std::vector<float>&  values = ch.GetValues();
+
+    ImGui::TextUnformatted(s_channelNames[channel]);
+
+    ImVec2      size = {ImGui::GetContentRegionAvail().x, s_plotHeight};
+    ImVec2      pos  = ImGui::GetCursorScreenPos();
+    ImDrawList* dl   = ImGui::GetWindowDrawList();
+    dl->AddRectFilled(pos, {pos.x + size.x, pos.y + size.y}, IM_COL32(25, 25, 25, 255));
+    ImGui::Dummy(size);
+
+    size_t first = ch.LowerBound(begin);
+    size_t last  = ch.LowerBound(end);
+    if (first >= last || size.x < 1.0f)
+    {
+        return;
+    }
+
+    // The vertical scale fits what is visible.
+    TelemetryChannel::MinMax range = ch.GetMinMax(first, last);
+    float                    span  = std::max(range.max - range.min, 1e-6f);
+    float                    xRate = size.x / (float)(end - begin);
+    auto toX = [&](double t) { return pos.x + (float)(t - begin) * xRate; };
+    auto toY = [&](float v) { return pos.y + size.y - ((v - range.min) / span) * size.y; };
+
+    ImGui::SetCursorScreenPos(pos);
+    ImGui::Text("%.3f / %.3f", range.min, range.max);
+    ImGui::SetCursorScreenPos({pos.x, pos.y + size.y + ImGui::GetStyle().ItemSpacing.y});
+
+    const ImU32 color   = IM_COL32(90, 200, 255, 255);
+    size_t      columns = (size_t)size.x;
+    if (last - first <= columns)
+    {
+        // Few enough samples to draw each of them.
+        static std::vector<ImVec2> points;
+        points.clear();
+        for (size_t i = first; i < last; i++)
+        {
+            points.push_back({toX(times[i]), toY(values[i])});
+        }
+        dl->AddPolyline(points.data(), (int)points.size(), color, false, 1.0f);
+    }
+    else
+    {
+        // More samples than pixels, draw the min/max of the samples that fall in each column.
+        // The pyramid of the channel keeps this proportional to the width, not to the samples.
+        double colSpan = (end - begin) / (double)columns;
+        size_t start   = first;
+        for (size_t x = 0; x < columns && start < last; x++)
+        {
+            size_t stop = std::min(ch.LowerBound(begin + ((double)(x + 1) * colSpan)), last);
+            if (stop > start)
+            {
+                TelemetryChannel::MinMax mm = ch.GetMinMax(start, stop);
+                float                    px = pos.x + (float)x + 0.5f;
+                dl->AddLine({px, toY(mm.max)}, {px, toY(mm.min) + 1.0f}, color);
+                start = stop;
+            }
+        }
+    }
+}
+
+
+void TelemetryPanel::Connect()
+{
+    m_replay.Close();
+    for (auto& channel : m_channels)
+    {
+        channel.Clear();
+    }
+
+    std::string logPath;
+    if (m_logToFile)
+    {
+        char        name[64];
+        std::time_t now = std::time(nullptr);
+        std::strftime(name, sizeof(name), "telemetrie_%Y%m%d_%H%M%S.v21t", std::localtime(&now));
+        logPath = name;
+    }
+
+    m_reader.Start(m_port, logPath);
+    m_followLatest = true;
+}
+
+
+void TelemetryPanel::Replay()
+{
+    std::string path = File::OpenFile(FileTypes::All, FileMode::Open);
+    if (path.empty() == true)
+    {
+        // Path is empty, user did not pick a file.
+        return;
+    }
+
+    m_replay.Close();
+    if (m_replay.OpenForReplay(path))
+    {
+        m_replay.Replay(m_channels);
+        m_followLatest = false;
+        m_scroll       = 0.0f;
+    }
+}
+
+
+bool TelemetryPanel::OnSerialPortRemoved(Brigerad::SerialPortRemovedEvent& e)
+{
+    if (e.GetPort().port == m_port)
+    {
+        // The unit was unplugged, close the log cleanly rather than waiting for a read to fail.
+        m_reader.Stop();
+        m_port.clear();
+    }
+    return false;
+}
@@ -0,0 +1,79 @@
+﻿/**
+ ******************************************************************************
+ * @addtogroup TelemetryPanel
+ * @{
+ * @file    TelemetryPanel
+ * @author  Samuel Martel
+ * @brief   Header for the TelemetryPanel module.
+ *
+ * @date 10/19/2026 11:30:00 AM
+ *
+ ******************************************************************************
+ */
+#ifndef _TelemetryPanel
+#define _TelemetryPanel
+
+/*****************************************************************************/
+/* Includes */
+#include "Telemetry.h"
+
+#include "Brigerad/Events/SerialEvents.h"
+
+#include <string>
+
+/*****************************************************************************/
+/* Exported defines */
+
+
+/*****************************************************************************/
+/* Exported macro */
+
+
+/*****************************************************************************/
+/* Exported types */
+/**
+ * Window plotting the telemetry of a unit, live from a serial port or replayed from a log.
+ */
+class TelemetryPanel
+{
+public:
+    void OnImGuiRender();
+    void OnEvent(Brigerad::Event& e);
+    void Close();
+
+    bool& IsVisible() { return m_isVisible; }
+
+private:
+    void RenderConnection();
+    void RenderChannel(size_t channel, double begin, double end);
+
+    void Connect();
+    void Replay();
+
+    bool OnSerialPortRemoved(Brigerad::SerialPortRemovedEvent& e);
+
+private:
+    bool m_isVisible = false;
+
+    TelemetryReader                                       m_reader;
+    TelemetryLog                                          m_replay;
+    std::array<TelemetryChannel, TELEMETRY_CHANNEL_COUNT> m_channels;
+
+    std::string m_port;
+    bool        m_logToFile = true;
+
+    float m_window       = 10.0f;    // Seconds shown in the plots.
+    bool  m_followLatest = true;
+    float m_scroll       = 0.0f;    // Start of the plots when not following, in seconds.
+};
+
+/*****************************************************************************/
+/* Exported functions */
+
+
+/* Have a wonderful day :) */
+#endif /* _TelemetryPanel */
+/**
+ * @}
+ */
+/****** END OF FILE ******/
@@ -0,0 +1,63 @@
+#!/usr/bin/env python3
+# Simulates a unit sending telemetry on a pseudo-terminal, to try the Telemetrie window of the
+# Configurator without hardware. Connect the Configurator to the printed port.
+#
+# Frame: 0xA5 0x5A, big-endian timestamp in ms (u32), one big-endian value per channel in
+# thousandths (i32), then the 8-bit sum of the timestamp and the values.
+
+import argparse
+import math
+import os
+import random
+import struct
+import time
+import tty
+
+CHANNEL_COUNT = 7
+
+
+def make_frame(timestamp_ms, values):
+    payload = struct.pack(">I", timestamp_ms & 0xFFFFFFFF)
+    payload += b"".join(struct.pack(">i", int(round(v * 1000.0))) for v in values)
+    return b"\xA5\x5A" + payload + bytes([sum(payload) & 0xFF])
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Simulated telemetry unit")
+    parser.add_argument("--rate", type=float, default=1000.0, help="frames per second")
+    parser.add_argument("--noise", type=float, default=0.05, help="noise amplitude")
+    parser.add_argument("--corrupt", type=float, default=0.0,
+                        help="fraction of frames sent with a bad checksum")
+    args = parser.parse_args()
+
+    master, slave = os.openpty()
+    tty.setraw(slave)
+    print("Telemetry on {}".format(os.ttyname(slave)), flush=True)
+
+    period = 1.0 / args.rate
+    start = time.monotonic()
+    sent = 0
+    while True:
+        now = time.monotonic() - start
+        values = [(c + 1) * 10.0 * math.sin(2.0 * math.pi * (0.2 + 0.1 * c) * now)
+                  + random.uniform(-args.noise, args.noise) for c in range(CHANNEL_COUNT)]
+        frame = bytearray(make_frame(int(now * 1000.0), values))
+        if random.random() < args.corrupt:
+            frame[-1] ^= 0xFF
+        try:
+            os.write(master, frame)
+        except BlockingIOError:
+            pass
+        sent += 1
+
+        # Catch up on the schedule rather than drifting.
+        delay = start + sent * period - time.monotonic()
+        if delay > 0:
+            time.sleep(delay)
+
+
+if __name__ == "__main__":
+    try:
+        main()
+    except KeyboardInterrupt:
+        pass